@@ -49,6 +49,39 @@ enum
 #define ClearAuth(x)         ((x)->flags &= ~AM_DOING_AUTH)
 #define IsDoingAuth(x)       ((x)->flags &  AM_DOING_AUTH)
 
+/** Outcome of an ident query, as remembered by the ident cache. */
+enum ident_result
+{
+  IDENT_ANSWERED,
+  IDENT_REFUSED,
+  IDENT_TIMEDOUT,
+  IDENT_RESULT_COUNT
+};
+
+enum
+{
+  IDENT_CACHE_SIZE  = 0x4000,  /**< Slots in the ident cache; must be a power of two */
+  IDENT_CACHE_PROBE = 8        /**< Maximum probe distance */
+};
+
+/** Ident outcomes recently seen from an address or network. */
+struct ident_cache
+{
+  uint64_t key;                /**< As returned by ipcache_prefix_key(); 0 marks an unused slot */
+  uintmax_t expires;           /**< Time after which the slot may be reused */
+  unsigned short answered;     /**< Number of answered queries */
+  unsigned short failed;       /**< Number of refused or timed out queries */
+};
+
+/** Counters shown in STATS t. */
+struct ident_stats
+{
+  unsigned int result[IDENT_RESULT_COUNT];
+  unsigned int skipped;        /**< Queries not even attempted because of the cache */
+  unsigned int rtt;            /**< Smoothed round-trip time of answered queries in ms */
+  unsigned int timeout;        /**< Current timeout in seconds */
+};
+
 struct Client;
 
 /** Stores state of the DNS and RFC 1413 ident lookups for a client. */
@@ -59,8 +92,11 @@ struct AuthRequest
   struct Client *client;  /**< Pointer to Client structure for request. */
   fde_t fd;               /**< File descriptor for identd queries. */
   uintmax_t timeout;      /**< Time when query expires. */
+  uintmax_t ident_start;  /**< Time in ms the ident query was started */
+  uintmax_t ident_timeout;  /**< Time the ident query expires */
 };
 
+extern const struct ident_stats *auth_get_ident_stats(void);
 extern void auth_init(void);
 extern void start_auth(struct Client *);
 extern void delete_auth(struct AuthRequest *);
@@ -39,9 +39,16 @@
 enum
 {
   MSG_FLOOD_NOTICED  = 0x00000001U,
-  JOIN_FLOOD_NOTICED = 0x00000002U
+  JOIN_FLOOD_NOTICED = 0x00000002U,
+  SIZE_MOVE_PENDING  = 0x00000004U
 };
 
+/*
+ * Channels are also indexed by member count, in buckets of powers of
+ * two; bucket n holds the channels with 2^(n-1) to 2^n - 1 members.
+ */
+enum { CHANNEL_SIZE_BUCKETS = 33 };
+
 #define SetFloodNoticed(x)   ((x)->flags |= MSG_FLOOD_NOTICED)
 #define IsSetFloodNoticed(x) ((x)->flags & MSG_FLOOD_NOTICED)
 #define ClearFloodNoticed(x) ((x)->flags &= ~MSG_FLOOD_NOTICED)
@@ -50,6 +57,10 @@ enum
 #define IsSetJoinFloodNoticed(x) ((x)->flags & JOIN_FLOOD_NOTICED)
 #define ClearJoinFloodNoticed(x) ((x)->flags &= ~JOIN_FLOOD_NOTICED)
 
+#define SetSizeMovePending(x)   ((x)->flags |= SIZE_MOVE_PENDING)
+#define IsSizeMovePending(x)    ((x)->flags & SIZE_MOVE_PENDING)
+#define ClearSizeMovePending(x) ((x)->flags &= ~SIZE_MOVE_PENDING)
+
 struct Client;
 
 /*! \brief Mode structure for channels */
@@ -63,13 +74,17 @@ struct Mode
 /*! \brief Channel structure */
 struct Channel
 {
-  dlink_node node;
-
+  /* What hash_find_channel() looks at comes first */
   struct Channel *hnextch;
-  struct Mode mode;
+  size_t name_len;
+  char name[CHANNELLEN + 1];
 
-  char topic[TOPICLEN + 1];
-  char topic_info[NICKLEN + USERLEN + HOSTLEN + 3];
+  dlink_node node;
+  dlink_node size_node;      /**< Link in channel_size_list */
+  dlink_node size_pending_node;  /**< Link in the list of channels waiting to change buckets */
+  unsigned int size_bucket;  /**< Index into channel_size_list */
+  struct Mode mode;
+  struct Topic *topic;  /**< NULL if there's neither a topic nor a setter */
 
   uintmax_t creationtime;
   uintmax_t topic_time;
@@ -88,11 +103,18 @@ struct Channel
   dlink_list invexlist;
 
   float number_joined;
+};
 
-  char name[CHANNELLEN + 1];
-  size_t name_len;
+/*! \brief Topic of a channel, allocated from a pool by size class */
+struct Topic
+{
+  const char *info;  /**< n!u\@h of the setter; shared, see intern.h */
+  char text[];       /**< Topic */
 };
 
+#define ChannelTopic(x)      ((x)->topic ? (x)->topic->text : "")
+#define ChannelTopicInfo(x)  ((x)->topic ? (x)->topic->info : "")
+
 /*! \brief Membership structure */
 struct Membership
 {
@@ -108,17 +130,25 @@ struct Membership
 struct Ban
 {
   dlink_node node;
-  char name[NICKLEN + 1];
-  char user[USERLEN + 1];
-  char host[HOSTLEN + 1];
-  char who[NICKLEN + USERLEN + HOSTLEN + 3];
-  size_t len;
-  uintmax_t when;
-  struct irc_ssaddr addr;
-  int bits;
-  int type;
+  const char *who;       /**< Who set it; shared, see intern.c */
+  uintmax_t when;        /**< When it was set */
+  unsigned short len;    /**< Length of name, user and host combined */
+  unsigned char user;    /**< Offset of the user part in data */
+  unsigned char host;    /**< Offset of the host part in data */
+  unsigned short bits;   /**< Mask length of HM_IPV4/HM_IPV6 bans */
+  unsigned short type;   /**< HM_HOST, HM_IPV4 or HM_IPV6 */
+  char data[];           /**< Address of HM_IPV4/HM_IPV6 bans, then name,
+                              user and host, each NUL-terminated */
 };
 
+#define BanName(x)  ((x)->data + BanAddrSize(x))
+#define BanUser(x)  ((x)->data + (x)->user)
+#define BanHost(x)  ((x)->data + (x)->host)
+#define BanAddr(x)  ((const struct irc_ssaddr *)(x)->data)
+#define BanAddrSize(x)  ((x)->type == HM_IPV4 ? sizeof(struct sockaddr_in) : \
+                         (x)->type == HM_IPV6 ? sizeof(struct sockaddr_in6) : 0)
+#define BanSize(x)  (sizeof(struct Ban) + BanAddrSize(x) + (x)->len + 3)
+
 /*! \brief Invite structure */
 struct Invite
 {
@@ -130,6 +160,7 @@ struct Invite
 };
 
 extern dlink_list channel_list;
+extern dlink_list channel_size_list[CHANNEL_SIZE_BUCKETS];
 
 extern int channel_check_name(const char *, const int);
 extern int can_send(struct Channel *, struct Client *, struct Membership *, const char *, int);
@@ -141,8 +172,13 @@ extern void channel_do_join_0(struct Client *);
 extern void channel_do_part(struct Client *, char *, const char *);
 extern void remove_ban(struct Ban *, dlink_list *);
 extern void channel_init(void);
+extern void channel_reserve(unsigned int, unsigned int);
 extern void add_user_to_channel(struct Channel *, struct Client *, unsigned int, int);
 extern void remove_user_from_channel(struct Membership *);
+extern unsigned int channel_size_bucket(unsigned int);
+extern void channel_size_hold(void);
+extern void channel_size_release(void);
+extern int channel_size_stale(void);
 extern void channel_member_names(struct Client *, struct Channel *, int);
 extern void add_invite(struct Channel *, struct Client *);
 extern void del_invite(struct Invite *);
@@ -34,6 +34,7 @@
 #include "dbuf.h"
 #include "channel.h"
 #include "auth.h"
+#include "password.h"
 
 
 /*
@@ -104,7 +105,8 @@ enum
   CAP_EXTENDED_JOIN  = 0x00000008U,  /**< ircv3.1 extended-join client capability */
   CAP_ACCOUNT_NOTIFY = 0x00000010U,  /**< ircv3.1 account-notify client capability */
   CAP_INVITE_NOTIFY  = 0x00000020U,  /**< ircv3.2 invite-notify client capability */
-  CAP_CHGHOST        = 0x00000040U   /**< ircv3.2 chghost client capability */
+  CAP_CHGHOST        = 0x00000040U,  /**< ircv3.2 chghost client capability */
+  CAP_BATCH          = 0x00000080U   /**< ircv3.2 batch client capability */
 };
 
 #define HasCap(x, y) ((x)->connection->cap_active & (y))
@@ -137,7 +139,9 @@ enum
   FLAGS_SERVICE       = 0x00200000U,  /**< Client/server is a network service */
   FLAGS_SSL           = 0x00400000U,  /**< User is connected via TLS/SSL */
   FLAGS_SQUIT         = 0x00800000U,
-  FLAGS_EXEMPTXLINE   = 0x01000000U   /**< Client is exempt from x-lines */
+  FLAGS_EXEMPTXLINE   = 0x01000000U,  /**< Client is exempt from x-lines */
+  FLAGS_ZIP           = 0x02000000U,  /**< We offered compression to this server */
+  FLAGS_BATCH         = 0x04000000U   /**< Output is held back for a batch */
 };
 
 #define HasFlag(x, y) ((x)->flags &   (y))
@@ -276,11 +280,13 @@ struct Server
 /*! \brief ListTask structure */
 struct ListTask
 {
-  dlink_node node;  /**< Embedded list node used to link into listing_client_list */
   dlink_list show_mask; /**< Channels to show */
   dlink_list hide_mask; /**< Channels to hide */
 
-  unsigned int hash_index; /**< The hash bucket we are currently in */
+  unsigned int only_unmasked; /**< Only the channels named in show_mask are listed */
+  unsigned int bucket;        /**< channel_size_list bucket being listed; walked downwards */
+  unsigned int bucket_min;    /**< Last channel_size_list bucket to be listed */
+  struct ListSnapshot *snapshot; /**< Shared listing being sent, if any */
   unsigned int users_min;
   unsigned int users_max;
   unsigned int created_min;
@@ -290,6 +296,34 @@ struct ListTask
   char topic[TOPICLEN + 1];
 };
 
+enum
+{
+  BURST_CLIENTS,
+  BURST_CHANNELS
+};
+
+/*! \brief BurstTask structure */
+struct BurstTask
+{
+  dlink_node node;          /**< Embedded list node used to link into bursting_server_list */
+  dlink_node *cursor;       /**< Next client, or channel, to be sent */
+  dlink_node *channels;     /**< First channel to be sent; later ones were created during the burst */
+  unsigned int stage;       /**< BURST_CLIENTS, then BURST_CHANNELS */
+  struct dbuf_queue held;   /**< Other traffic queued while clients are sent */
+};
+
+/*
+ * The first CONNECTION_HOT_SIZE bytes of a Connection hold what is looked
+ * at for every line sent or parsed; connections are allocated on
+ * CONNECTION_ALIGN boundaries so those take up as few cache lines as
+ * possible. client.c fails to compile if the hot part outgrows its budget.
+ */
+enum
+{
+  CONNECTION_ALIGN = 64,
+  CONNECTION_HOT_SIZE = 128
+};
+
 /*! \brief Connection structure
  *
  * Allocated only for local clients, that are directly connected
@@ -297,21 +331,57 @@ struct ListTask
  */
 struct Connection
 {
-  dlink_node   lclient_node;
+  /* Hot part: send_message(), the fanout loops and the parser */
+  struct dbuf_queue buf_sendq;  /**< Interactive lane */
+  struct BurstTask *burst_task;
+  struct zip_link *zip;  /**< Compression state of server links */
+  dlink_list confs;      /**< Configuration record associated */
+  uintmax_t serial;      /**< Used to enforce 1 send per nick */
 
+  struct
+  {
+    unsigned int messages;      /**< Statistics: protocol messages sent */
+    uintmax_t bytes;             /**< Statistics: total bytes sent */
+  } send;
+
+  unsigned int cap_active;  /**< Active capabilities (to us) */
   unsigned int registration;
+
+  /* Anti-flood stuff. We track how many messages were parsed and how
+   * many we were allowed in the current second, and apply a simple
+   * decay to avoid flooding.
+   *   -- adrian
+   */
+  int allow_read;       /**< How many we're allowed to read in this second */
+  int sent_parsed;      /**< How many messages we've parsed in this second */
+
+  uintmax_t    lasttime;   /**< Last time data read from socket */
+
+  /* End of the hot part */
+  struct dbuf_queue buf_recvq;
+
+  struct
+  {
+    unsigned int messages;      /**< Statistics: protocol messages received */
+    uintmax_t bytes;             /**< Statistics: total bytes received */
+  } recv;
+
+  uintmax_t    since;      /**< Last time we parsed something */
+
+  struct dbuf_queue buf_ctlq;   /**< Control lane: PING and PONG of server links */
+  struct dbuf_queue buf_bulkq;  /**< Bulk lane: bursts and LIST output */
+  struct dbuf_queue *sendq_partial;  /**< Lane a line was partly written from */
+  unsigned int sendq_turn;      /**< Interactive blocks written in a row */
+
+  dlink_node   lclient_node;
+
   unsigned int cap_client;  /**< Client capabilities (from us) */
-  unsigned int cap_active;  /**< Active capabilities (to us) */
   unsigned int       caps;  /**< Capabilities bit-field */
 
   unsigned int operflags;     /**< IRC Operator privilege flags */
   unsigned int random_ping; /**< Holding a 32bit value used for PING cookies */
 
-  uintmax_t serial;     /**< Used to enforce 1 send per nick */
-
-  uintmax_t    lasttime;   /**< Last time data read from socket */
   uintmax_t    firsttime;  /**< Time client was created */
-  uintmax_t    since;      /**< Last time we parsed something */
   uintmax_t    last_join_time;   /**< When this client last joined a channel */
   uintmax_t    last_leave_time;  /**< When this client last left a channel */
   int          join_leave_count; /**< Count of JOIN/LEAVE in less than
@@ -324,16 +394,7 @@ struct Connection
 
   unsigned int received_number_of_privmsgs;
 
-  struct ListTask  *list_task;
-
-  struct dbuf_queue buf_sendq;
-  struct dbuf_queue buf_recvq;
-
-  struct
-  {
-    unsigned int messages;      /**< Statistics: protocol messages sent/received */
-    uintmax_t bytes;             /**< Statistics: total bytes sent/received */
-  } recv, send;
+  dlink_list       cursors;  /**< Replies still being sent, see cursor.c */
 
   struct
   {
@@ -341,26 +402,20 @@ struct Connection
     uintmax_t last_attempt;  /**< Last time the AWAY/INVITE/KNOCK/NICK request was issued */
   } away, invite, knock, nick;
 
-  struct AuthRequest auth;
+  struct AuthRequest *auth;  /**< Ident and DNS lookups, while in progress */
   struct Listener *listener;   /**< Listener accepted from */
   dlink_list        acceptlist; /**< Clients I'll allow to talk to me */
   dlink_list        watches;   /**< Chain of Watch pointer blocks */
-  dlink_list        confs;     /**< Configuration record associated */
   dlink_list        invited;   /**< Chain of invite pointer blocks */
+  struct password_verdict passwords[PASSWORD_VERDICTS];  /**< Cached verdicts of encrypted password checks */
+  unsigned int      password_count;  /**< Entries of passwords in use */
+  struct password_job *password_job;  /**< Password check in progress */
   struct irc_ssaddr ip;
   int               aftype;    /**< Makes life easier for DNS res in IPV6 */
   int               country_id; /**< ID corresponding to a ISO 3166 country code */
 
   fde_t             fd;
 
-  /* Anti-flood stuff. We track how many messages were parsed and how
-   * many we were allowed in the current second, and apply a simple
-   * decay to avoid flooding.
-   *   -- adrian
-   */
-  int allow_read;       /**< How many we're allowed to read in this second */
-  int sent_parsed;      /**< How many messages we've parsed in this second */
-
   char *password;  /**< Password supplied by the client/server */
 };
 
@@ -389,7 +444,6 @@ struct Client
   dlink_list        channel;   /**< Chain of channel pointer blocks */
   dlink_list        svstags;   /**< List of ServicesTag items */
 
-  char away[AWAYLEN + 1]; /**< Client's AWAY message. Can be set/unset via AWAY command */
   char name[HOSTLEN + 1]; /**< Unique name for a client nick or host */
   char id[IDLEN + 1];       /**< Client ID, unique ID per client */
   char account[ACCOUNTLEN + 1]; /**< Services account */
@@ -403,33 +457,36 @@ struct Client
    */
   char              username[USERLEN + 1]; /* client's username */
 
+  char             *certfp;  /**< SSL certificate fingerprint */
+
   /*
+   * The following are shared with other clients, see intern.c, and are
+   * never NULL. They're set with client_set_host(), client_set_info(),
+   * client_set_away() and client_set_sockhost() only.
+   *
    * client->host contains the resolved name or ip address
    * as a string for the user, it may be fiddled with for oper spoofing etc.
    * once it's changed the *real* address goes away. This should be
    * considered a read-only field after the client has registered.
-   */
-  char              host[HOSTLEN + 1];     /* client's hostname */
-
-  /*
+   *
    * client->info for unix clients will normally contain the info from the
    * gcos field in /etc/passwd but anything can go here.
    */
-  char              info[REALLEN + 1]; /* Free form additional client info */
+  const char       *host;  /**< Client's hostname, at most HOSTLEN */
+  const char       *info;  /**< Free form additional client info, at most REALLEN */
+  const char       *away;  /**< Client's AWAY message, at most AWAYLEN */
 
   /*
    * client->sockhost contains the ip address gotten from the socket as a
    * string, this field should be considered read-only once the connection
-   * has been made. (set in s_bsd.c only)
+   * has been made.
    */
-  char              sockhost[HOSTIPLEN + 1]; /* This is the host name from the
-                                                socket ip address as string */
-  char             *certfp;  /**< SSL certificate fingerprint */
+  const char       *sockhost;  /**< Client's IP address as string, at most HOSTIPLEN */
 };
 
 
 extern struct Client me;
-extern dlink_list listing_client_list;
+extern dlink_list bursting_server_list;
 extern dlink_list global_client_list;
 extern dlink_list global_server_list;   /* global servers on the network              */
 extern dlink_list local_client_list;  /* local clients only ON this server          */
@@ -450,10 +507,16 @@ extern void exit_client(struct Client *, const char *);
 extern void conf_try_ban(struct Client *, int, const char *);
 extern void check_conf_klines(void);
 extern void client_init(void);
+extern void client_set_host(struct Client *, const char *);
+extern void client_set_info(struct Client *, const char *);
+extern void client_set_away(struct Client *, const char *);
+extern void client_set_sockhost(struct Client *, const char *);
+extern void client_reserve(unsigned int);
 extern void dead_link_on_write(struct Client *, int);
 extern void dead_link_on_read(struct Client *, int);
 extern void exit_aborted_clients(void);
 extern void free_exited_clients(void);
+extern void free_split_clients(void);
 extern struct Client *make_client(struct Client *);
 extern struct Client *find_chasing(struct Client *, const char *);
 extern struct Client *find_person(const struct Client *, const char *);
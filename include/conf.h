@@ -52,7 +52,9 @@ enum
   CONF_FLAGS_EXEMPTRESV      = 0x00001000U,
   CONF_FLAGS_SSL             = 0x00002000U,
   CONF_FLAGS_WEBIRC          = 0x00004000U,
-  CONF_FLAGS_EXEMPTXLINE     = 0x00008000U
+  CONF_FLAGS_EXEMPTXLINE     = 0x00008000U,
+  CONF_FLAGS_COMPRESSED      = 0x00010000U,
+  CONF_FLAGS_BSIZE           = 0x00020000U
 };
 
 /* Macros for struct MaskItem */
@@ -70,6 +72,8 @@ enum
 #define IsConfAllowAutoConn(x)    ((x)->flags & CONF_FLAGS_ALLOW_AUTO_CONN)
 #define SetConfAllowAutoConn(x)   ((x)->flags |= CONF_FLAGS_ALLOW_AUTO_CONN)
 #define ClearConfAllowAutoConn(x) ((x)->flags &= ~CONF_FLAGS_ALLOW_AUTO_CONN)
+#define IsConfCompressed(x)       ((x)->flags & CONF_FLAGS_COMPRESSED)
+#define IsConfBsize(x)            ((x)->flags & CONF_FLAGS_BSIZE)
 #define IsConfRedir(x)            ((x)->flags & CONF_FLAGS_REDIR)
 #define IsConfSSL(x)              ((x)->flags & CONF_FLAGS_SSL)
 #define IsConfDatabase(x)         ((x)->flags & CONF_FLAGS_IN_DATABASE)
@@ -178,6 +182,7 @@ struct config_general_entry
   unsigned int anti_spam_exit_message_time;
   unsigned int max_accept;
   unsigned int max_watch;
+  unsigned int memory_budget;  /**< In megabytes */
   unsigned int whowas_history_length;
   unsigned int away_time;
   unsigned int away_count;
@@ -308,6 +313,7 @@ extern void read_conf_files(int);
 extern int attach_conf(struct Client *, struct MaskItem *);
 extern int attach_connect_block(struct Client *, const char *, const char *);
 extern int check_client(struct Client *);
+extern int conf_password_pending(struct Client *);
 
 
 extern void detach_conf(struct Client *, enum maskitem_type);
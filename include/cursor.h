@@ -0,0 +1,72 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file cursor.h
+ * \brief Replies that are sent in slices bounded by the sendq.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_cursor_h
+#define INCLUDED_cursor_h
+
+#include "list.h"
+
+struct Client;
+struct Cursor;
+
+/*! \brief What a kind of cursor sends, and how */
+struct CursorType
+{
+  unsigned int bulk;  /**< Output goes to the bulk lane */
+
+  /** Sends the next item of the reply; returns 0 once the reply is complete */
+  int (*step)(struct Client *, struct Cursor *);
+
+  /** Frees Cursor::data, may be NULL */
+  void (*free)(struct Cursor *);
+
+  /** Memory held by Cursor::data, may be NULL */
+  size_t (*memory)(const struct Cursor *);
+};
+
+/*! \brief Cursor structure */
+struct Cursor
+{
+  dlink_node node;    /**< Embedded list node used to link into cursor_list */
+  dlink_node cnode;   /**< Embedded list node used to link into Connection::cursors */
+  struct Client *client_p;
+  const struct CursorType *type;
+  dlink_node *pos;    /**< Next list item to be sent; moved on by cursor_unlink() */
+  unsigned int index; /**< Next hash bucket, or line, to be sent */
+  void *data;         /**< State of the command */
+};
+
+extern dlink_list cursor_list;
+
+extern void cursor_start(struct Client *, const struct CursorType *, dlink_node *, void *);
+extern void cursor_run_all(void);
+extern void cursor_unlink(const dlink_node *);
+extern struct Cursor *cursor_find(const struct Client *, const struct CursorType *);
+extern void cursor_free(struct Cursor *);
+extern void cursor_free_all(struct Client *);
+extern void cursor_free_type(const struct CursorType *);
+extern void cursor_count_memory(unsigned int *, size_t *);
+#endif /* INCLUDED_cursor_h */
@@ -47,6 +47,7 @@ struct dbuf_queue
 };
 
 extern void dbuf_init(void);
+extern size_t dbuf_memory(void);
 extern struct dbuf_block *dbuf_alloc(void);
 extern void dbuf_ref_free(struct dbuf_block *);
 extern void dbuf_add(struct dbuf_queue *, struct dbuf_block *);
@@ -110,12 +110,42 @@
 
 #define CONNECTTIMEOUT  30      /* Recommended value: 30 */
 #define IDENT_TIMEOUT 10
+#define IDENT_TIMEOUT_MIN 2          /* lower bound of the adaptive ident timeout */
+#define IDENT_CACHE_TIME 600         /* how long ident outcomes are remembered */
+#define IDENT_NETWORK_FAILS 4        /* failures from an IPv4 /24 or IPv6 /64 before it is skipped */
+#define DNS_CACHE_SIZE 8192     /* default for SET DNSCACHE */
+#define PRESSURE_SOFT_PERCENT 75  /* share of the budget above which long replies wait */
+#define PRESSURE_HARD_PERCENT 90  /* share of the budget above which load is shed */
+#define PRESSURE_DROP_MAX 8     /* clients dropped per io_loop() pass under pressure */
+#define PRESSURE_SENDQ_MIN 65536  /* sendq size below which clients aren't dropped */
+#define PASSWORD_WORKERS 2      /* threads verifying encrypted passwords */
+#define PASSWORD_VERDICTS 4     /* password verdicts remembered per connection */
+#define ZIP_LEVEL 6             /* zlib compression level of server links */
+#define BURST_WATERMARK 65536   /* sendq size at which a burst waits for the link */
+#define SENDQ_CONTROL_MAX 16384 /* limit of the control lane of a sendq */
+#define LIST_SNAPSHOT_TIME 30   /* seconds an unfiltered LIST may lag behind */
+#define SENDQ_INTERACTIVE_WEIGHT 4  /* interactive sendq blocks written per bulk block */
+#define RELINK_DELAY 5          /* seconds until a link lost to a transient split is retried */
+#define RELINK_MIN_UPTIME 120   /* seconds a link must have been up to be retried that fast */
+#define SPLIT_HISTORY_CHUNK 4096  /* users of a netsplit added to WHOWAS per io_loop() pass */
+#define BSIZE_SENDQ_SCALE 8     /* bytes a BSIZE may reserve per byte of the link's sendq */
 
 #define MIN_JOIN_LEAVE_TIME  60
 #define MAX_JOIN_LEAVE_COUNT  25
 #define OPER_SPAM_COUNTDOWN   5
 #define JOIN_LEAVE_COUNT_EXPIRE_TIME 120
 
+/*
+ * Connection throttle aggregation. Besides the single host (an IPv4
+ * address or an IPv6 /64), connects are throttled per network prefix,
+ * which may burst THROTTLE_NETWORK_FACTOR times general::throttle_count
+ * connections within general::throttle_time.
+ */
+#define THROTTLE_HOST_IPV6      64
+#define THROTTLE_NETWORK_IPV4   24
+#define THROTTLE_NETWORK_IPV6   48
+#define THROTTLE_NETWORK_FACTOR 8
+
 #define MIN_SPAM_NUM 5
 #define MIN_SPAM_TIME 60
 #endif /* INCLUDED_defaults_h */
@@ -35,6 +35,8 @@
 struct Client;
 struct Channel;
 struct UserHost;
+struct ListTask;
+struct CursorType;
 
 enum
 {
@@ -60,9 +62,12 @@ extern struct Client *hash_find_client(const char *);
 extern struct Client *hash_find_server(const char *);
 extern struct Channel *hash_find_channel(const char *);
 extern void *hash_get_bucket(int, unsigned int);
+extern uintmax_t hash_get_generation(int);
 
-extern void free_list_task(struct Client *);
-extern void safe_list_channels(struct Client *, int);
+extern const struct CursorType list_cursor_type;
+extern void free_list_task(struct ListTask *);
+extern void safe_list_channels(struct Client *, struct ListTask *);
+extern void list_snapshot_count_memory(unsigned int *, size_t *);
 
 extern unsigned int strhash(const char *);
 #endif  /* INCLUDED_hash_h */
@@ -0,0 +1,38 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file intern.h
+ * \brief Shared, reference counted strings.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_intern_h
+#define INCLUDED_intern_h
+
+/* Shared strings are equal if and only if they're the same string */
+#define intern_equal(a, b) ((a) == (b))
+
+extern const char *intern_get(const char *);
+extern const char *intern_ref(const char *);
+extern void intern_release(const char *);
+extern void intern_count_memory(unsigned int *const, unsigned int *const,
+                                size_t *const, size_t *const);
+#endif /* INCLUDED_intern_h */
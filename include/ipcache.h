@@ -35,17 +35,47 @@
  */
 enum { IP_HASH_SIZE = 0x1000 };
 
+/*
+ * Connection throttle table. Open addressing with linear probing;
+ * the size must be a power of two.
+ */
+enum
+{
+  IP_THROTTLE_SIZE  = 0x10000,
+  IP_THROTTLE_PROBE = 8
+};
+
+/** Aggregation levels the connection throttle is applied at */
+enum ip_throttle_level
+{
+  IP_THROTTLE_HOST,     /**< IPv4 /32, IPv6 /64 */
+  IP_THROTTLE_NETWORK,  /**< IPv4 /24, IPv6 /48 */
+  IP_THROTTLE_LEVELS
+};
+
 struct ip_entry
 {
   dlink_node node;                /**< Doubly linked list node */
   struct irc_ssaddr ip;           /**< Holds an IPv6 or IPv4 address */
   unsigned int count;             /**< Number of registered users using this IP */
-  unsigned int connection_count;  /**< Number of connections from this IP in the last throttle_time duration */
-  uintmax_t last_attempt;         /**< The last time someone connected from this IP */
+};
+
+/*
+ * Token bucket state for one address prefix, kept as a theoretical
+ * arrival time (GCRA). A slot whose tat lies in the past holds a full
+ * bucket and may be reused by any other prefix.
+ */
+struct ip_throttle
+{
+  uint64_t key;  /**< Hashed prefix and aggregation level; 0 marks an unused slot */
+  uint64_t tat;  /**< Earliest time in milliseconds the bucket is full again */
 };
 
 extern struct ip_entry *ipcache_find_or_add_address(const struct irc_ssaddr *);
 extern void ipcache_remove_address(const struct irc_ssaddr *);
+extern uint64_t ipcache_prefix_key(const struct irc_ssaddr *, unsigned int, unsigned int);
+extern int ipcache_throttle_check(const struct irc_ssaddr *);
+extern void ipcache_throttle_get_stats(unsigned int *const, size_t *const, unsigned int *const);
 extern void ipcache_get_stats(unsigned int *const, size_t *const);
 extern void ipcache_init(void);
 #endif
@@ -41,6 +41,7 @@ struct SetOptions
   unsigned int joinfloodtime;
   unsigned int joinfloodcount;
   unsigned int ident_timeout; /* timeout for identd lookups        */
+  unsigned int dns_cache_size;  /* max. number of cached dns answers */
   int spam_num;
   unsigned int spam_time;
 };
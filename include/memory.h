@@ -29,6 +29,7 @@
 
 extern void outofmemory(void);
 extern void *xcalloc(size_t);
+extern void *xcalloc_aligned(size_t, size_t);
 extern void *xrealloc(void *, size_t);
 extern void xfree(void *);
 extern void *xstrdup(const char *);
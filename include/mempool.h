@@ -44,23 +44,28 @@
 * details. */
 typedef struct mp_pool_t mp_pool_t;
 
+extern int mp_pool_hugepages;
+
 extern void mp_pool_init(void);
 extern void *mp_pool_get(mp_pool_t *);
 extern void mp_pool_release(void *);
-extern mp_pool_t *mp_pool_new(size_t, size_t);
+extern mp_pool_t *mp_pool_new(const char *, size_t, size_t);
+extern void mp_pool_reserve(mp_pool_t *, size_t);
 extern void mp_pool_clean(mp_pool_t *, int, int);
 extern void mp_pool_destroy(mp_pool_t *);
 extern void mp_pool_assert_ok(mp_pool_t *);
 extern void mp_pool_log_status(mp_pool_t *);
 extern void mp_pool_garbage_collect(void *);
-
-#undef MEMPOOL_STATS
+extern const mp_pool_t *mp_pool_get_list(void);
 
 struct mp_pool_t
 {
   /** Next pool. A pool is usually linked into the mp_allocated_pools list. */
   mp_pool_t *next;
 
+  /** Name of the pool, as shown by STATS z. */
+  const char *name;
+
   /** Doubly-linked list of chunks in which no items have been allocated.
    * The front of the list is the most recently emptied chunk. */
   struct mp_chunk_t *empty_chunks;
@@ -90,7 +95,22 @@ struct mp_pool_t
   /** Size to allocate for each item, including overhead and alignment
    * padding. */
   size_t item_alloc_size;
-#ifdef MEMPOOL_STATS
+
+  /** Size of the memory allocated for each chunk, including overhead. */
+  size_t chunk_alloc_size;
+
+  /** Whether chunks are mapped as transparent huge pages. */
+  int hugepages;
+
+  /** Number of chunks, including empty ones. */
+  int n_chunks;
+
+  /** Number of items currently allocated. */
+  unsigned int n_items;
+
+  /** Highest value of <b>n_items</b> ever. */
+  unsigned int max_items;
+
   /** Total number of items allocated ever. */
   uint64_t total_items_allocated;
 
@@ -99,6 +119,5 @@ struct mp_pool_t
 
   /** Total number of chunks freed ever. */
   uint64_t total_chunks_freed;
-#endif
 };
 #endif
@@ -65,6 +65,7 @@ struct MotdCache
   dlink_node   node;     /**< Next MotdCache in list. */
   char        *path;     /**< Pathname of file. */
   unsigned int ref;      /**< Number of references to this entry. */
+  unsigned int sending;  /**< Number of cursors sending this entry. */
   unsigned int maxcount; /**< Number of lines allocated for message. */
   unsigned int count;    /**< Actual number of lines used in message. */
   uintmax_t    modtime;  /**< Last modification time from file. */
@@ -0,0 +1,64 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file password.h
+ * \brief Asynchronous verification of encrypted passwords.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_password_h
+#define INCLUDED_password_h
+
+struct Client;
+struct MaskItem;
+
+enum password_result
+{
+  PASSWORD_MISMATCH,
+  PASSWORD_MATCH,
+  PASSWORD_PENDING
+};
+
+/** Verdict of a crypt() comparison, cached until registration or OPER is done */
+struct password_verdict
+{
+  uint64_t digest;  /**< Keyed digest of the encrypted and the plaintext password */
+  int match;        /**< Whether both matched */
+};
+
+/** Statistics of the password workers */
+struct password_stats
+{
+  unsigned int queued;   /**< Jobs handed to the workers */
+  unsigned int hits;     /**< Checks answered from a verdict cache */
+  unsigned int synchronous;  /**< Checks that had to be done on the main loop */
+  unsigned int pending;  /**< Jobs currently queued or running */
+  unsigned int busy;     /**< Checks that had to wait for the client's current job */
+};
+
+extern void password_set_context(struct Client *, int);
+extern int password_check(const char *, const char *);
+extern enum password_result password_verify(struct Client *, const char *,
+                                            const struct MaskItem *, const char *);
+extern void password_forget(struct Client *);
+extern void password_free(struct Client *);
+extern const struct password_stats *password_get_stats(void);
+#endif /* INCLUDED_password_h */
@@ -0,0 +1,60 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file pressure.h
+ * \brief Global budget for send and receive queue memory.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_pressure_h
+#define INCLUDED_pressure_h
+
+enum pressure_level
+{
+  PRESSURE_NONE,
+  PRESSURE_SOFT,  /**< Replies such as LIST are held back */
+  PRESSURE_HARD   /**< Load is shed */
+};
+
+/** Statistics of the memory pressure governor */
+struct pressure_stats
+{
+  size_t memory;               /**< Memory currently used by dbufs */
+  size_t peak;                 /**< Highest value of memory */
+  enum pressure_level level;   /**< Current level */
+  unsigned int soft;           /**< Times the soft watermark was crossed */
+  unsigned int hard;           /**< Times the hard watermark was crossed */
+  unsigned int deferred;       /**< Cursor passes held back */
+  unsigned int dropped;        /**< Clients dropped for the size of their sendq */
+  uintmax_t dropped_bytes;     /**< Sendq bytes those clients had queued */
+  unsigned int shed;           /**< Unregistered connections closed */
+  unsigned int refused;        /**< Connections refused */
+  unsigned int warned;         /**< Connections warned */
+};
+
+extern size_t pressure_budget(void);
+extern size_t pressure_watermark(enum pressure_level);
+extern void pressure_check(void);
+extern int pressure_defer(void);
+extern int pressure_accept(void);
+extern int pressure_warn(void);
+extern const struct pressure_stats *pressure_get_stats(void);
+#endif /* INCLUDED_pressure_h */
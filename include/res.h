@@ -114,7 +114,11 @@ typedef void (*dns_callback_fnc)(void *, const struct irc_ssaddr *, const char *
 
 extern void resolver_init(void);
 extern void restart_resolver(void);
+extern void resolver_flush(void);
 extern void delete_resolver_queries(const void *);
 extern void gethost_byname_type(dns_callback_fnc , void *, const char *, int);
 extern void gethost_byaddr(dns_callback_fnc, void *, const struct irc_ssaddr *);
+extern void resolver_cache_trim(void);
+extern void resolver_count_memory(unsigned int *const, size_t *const, unsigned int *const,
+                                  unsigned int *const, unsigned int *const);
 #endif
@@ -56,12 +56,24 @@ enum
  */
 struct Channel;
 struct Client;
+struct Connection;
+struct dbuf_queue;
 
 /* send.c prototypes */
 extern void sendq_unblocked(fde_t *, void *);
+extern struct dbuf_queue *sendq_next(struct Connection *);
+extern void sendq_consume(struct Connection *, struct dbuf_queue *, size_t);
+extern size_t sendq_length(const struct Connection *);
+extern void sendq_clear(struct Connection *);
 extern void send_queued_write(struct Client *);
 extern void send_queued_all(void);
 extern void sendto_one(struct Client *, const char *, ...) AFP(2,3);
+extern void sendto_one_control(struct Client *, const char *, ...) AFP(2,3);
+extern void sendto_burst(struct Client *, const char *, ...) AFP(2,3);
+extern void sendto_bulk_begin(struct Client *);
+extern void sendto_bulk_end(void);
+extern void sendto_batch_begin(const char *, const char *);
+extern void sendto_batch_end(void);
 extern void sendto_one_numeric(struct Client *, const struct Client *, enum irc_numerics, ...);
 extern void sendto_one_notice(struct Client *, const struct Client *, const char *, ...) AFP(3,4);
 extern void sendto_channel_butone(struct Client *, const struct Client *,
@@ -71,6 +83,7 @@ extern void sendto_common_channels_local(struct Client *, int, unsigned int, uns
                                          const char *, ...) AFP(5,6);
 extern void sendto_channel_local(const struct Client *, struct Channel *, unsigned int,
                                  unsigned int, unsigned int, const char *, ...)  AFP(6,7);
+extern void sendto_channel_local_joins(struct Channel *, struct Client *const [], unsigned int);
 extern void sendto_server(const struct Client *, const unsigned int,
                           const unsigned int, const char *, ...) AFP(4,5);
 extern void sendto_match_butone(const struct Client *, const struct Client *,
@@ -73,7 +73,9 @@ enum
   CAPAB_SVS     = 0x00000800U,  /**< Supports services */
   CAPAB_DLN     = 0x00001000U,  /**< Can do DLINE message */
   CAPAB_UNDLN   = 0x00002000U,  /**< Can do UNDLINE message */
-  CAPAB_CHW     = 0x00004000U   /**< Can do channel wall @# */
+  CAPAB_CHW     = 0x00004000U,  /**< Can do channel wall @# */
+  CAPAB_ZIP     = 0x00008000U,  /**< Can do compressed links */
+  CAPAB_BSIZE   = 0x00010000U   /**< Announces the size of its burst */
 };
 
 /*
@@ -91,9 +93,15 @@ extern void add_capability(const char *, unsigned int);
 extern void delete_capability(const char *);
 extern unsigned int find_capability(const char *);
 extern const char *get_capabilities(const struct Client *);
+extern void send_capabilities(struct Client *, const struct MaskItem *);
+extern void server_burst(struct Client *);
+extern void server_burst_continue(struct Client *);
+extern void server_burst_unlink(const dlink_node *);
+extern void free_burst_task(struct Client *);
 extern void write_links_file(void *);
 extern void read_links_file(void);
 extern void try_connections(void *);
+extern int server_relink(const struct Client *);
 extern int serv_connect(struct MaskItem *, struct Client *);
 extern struct Client *find_servconn_in_progress(const char *);
 extern struct Server *make_server(struct Client *);
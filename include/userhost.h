@@ -30,7 +30,7 @@
 struct UserHost
 {
   struct UserHost *next;
-  char host[HOSTIPLEN + 1];
+  const char *host;  /* Shared string, see intern.h */
   unsigned int gcount;  /* Global user count on this addr */
   unsigned int lcount;  /* Local user count on this addr */
 };
@@ -31,26 +31,36 @@
 #include "client.h"
 
 
+/*
+ * Whowas records are variable length and live in an arena, see whowas.c.
+ * The nick name is stored first in Whowas::name and followed by the user
+ * name, IP address and services account, which Whowas::username,
+ * Whowas::sockhost and Whowas::account are offsets to. Host names, real
+ * names and server names are shared strings; see intern.h.
+ */
 struct Whowas
 {
   dlink_node hnode;  /**< List node; linked into whowas_hash */
-  dlink_node cnode;  /**< List node; linked into client->whowas_list */
-  dlink_node lnode;  /**< List node; linked into whowas_list */
-  unsigned int hashv;  /**< Hash value derived from Whowas::name */
-  unsigned int shide;  /**< Client's server is hidden */
-  uintmax_t logoff;  /**< When the client logged off */
-  char account[ACCOUNTLEN + 1];  /**< Services account */
-  char name[NICKLEN + 1];  /**< Client's nick name */
-  char username[USERLEN + 1];  /**< Client's user name */
-  char hostname[HOSTLEN + 1];  /**< Client's host name */
-  char sockhost[HOSTIPLEN + 1];  /**< Client's IP address as string */
-  char realname[REALLEN + 1];  /**< Client's real name/gecos */
-  char servername[HOSTLEN + 1];  /**< Name of the server the client is using */
+  dlink_node *cnode;  /**< List node linked into client->whowas_list, or NULL */
   struct Client *online;  /**< Pointer to new nick name for chasing or NULL */
+  uintmax_t logoff;  /**< When the client logged off */
+  const char *hostname;  /**< Client's host name */
+  const char *realname;  /**< Client's real name/gecos */
+  const char *servername;  /**< Name of the server the client is using */
+  unsigned int hashv;  /**< Hash value derived from Whowas::name */
+  unsigned short size;  /**< Size of the record in the arena */
+  unsigned char shide;  /**< Client's server is hidden */
+  unsigned char username;  /**< Offset of the user name */
+  unsigned char sockhost;  /**< Offset of the IP address as string */
+  unsigned char account;  /**< Offset of the services account */
+  char name[];  /**< Client's nick name, followed by the other strings */
 };
 
+#define WhowasUser(x)     ((x)->name + (x)->username)
+#define WhowasSockhost(x) ((x)->name + (x)->sockhost)
+#define WhowasAccount(x)  ((x)->name + (x)->account)
+
 extern const dlink_list *whowas_get_hash(unsigned int);
-extern void whowas_init(void);
 extern void whowas_trim(void);
 extern void whowas_add_history(struct Client *, const int);
 extern void whowas_off_history(struct Client *);
@@ -0,0 +1,53 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file zip.h
+ * \brief Stream compression of server links.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_zip_h
+#define INCLUDED_zip_h
+
+#include "dbuf.h"
+
+struct Client;
+
+/** Per-link compression statistics */
+struct zip_stats
+{
+  uintmax_t in;        /**< Bytes inflated */
+  uintmax_t in_wire;   /**< Compressed bytes received */
+  uintmax_t out;       /**< Bytes deflated */
+  uintmax_t out_wire;  /**< Compressed bytes produced */
+  uintmax_t cpu;       /**< Microseconds of CPU time spent in zlib */
+};
+
+extern int zip_available(void);
+extern void zip_start(struct Client *);
+extern void zip_start_inflate(struct Client *);
+extern struct dbuf_queue *zip_deflate(struct Client *, int);
+extern int zip_inflate(struct Client *, const char *, size_t);
+extern size_t zip_queued(const struct Client *);
+extern void zip_flush_all(void);
+extern void zip_free(struct Client *);
+extern const struct zip_stats *zip_get_stats(const struct Client *);
+#endif /* INCLUDED_zip_h */
@@ -1,10 +1,9 @@
 AC_DEFUN([AX_MEMPOOL_CHUNKSIZES],[
   AC_DEFINE([MP_CHUNK_SIZE_CHANNEL], 1024*1024, [Size of the channel mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_MEMBER], 2048*1024, [Size of the channel-member mempool chunk.])
-  AC_DEFINE([MP_CHUNK_SIZE_BAN], 1024*1024, [Size of the ban mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_INVITE], 4*1024, [Size of the invite mempool chunk.])
+  AC_DEFINE([MP_CHUNK_SIZE_TOPIC], 64*1024, [Size of the channel topic mempool chunks.])
   AC_DEFINE([MP_CHUNK_SIZE_CLIENT], 1024*1024, [Size of the client mempool chunk.])
-  AC_DEFINE([MP_CHUNK_SIZE_CONNECTION], 512*1024, [Size of the connection mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_DNODE], 32*1024, [Size of the dlink_node mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_DBUF], 512*1024, [Size of the dbuf mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_AUTH], 128*1024, [Size of the auth mempool chunk.])
@@ -12,5 +11,4 @@ AC_DEFUN([AX_MEMPOOL_CHUNKSIZES],[
   AC_DEFINE([MP_CHUNK_SIZE_WATCH], 8*1024, [Size of the watch mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_USERHOST], 128*1024, [Size of the userhost mempool chunk.])
   AC_DEFINE([MP_CHUNK_SIZE_IP_ENTRY], 128*1024, [Size of the ip_entry mempool chunk.])
-  AC_DEFINE([MP_CHUNK_SIZE_WHOWAS], 256*1024, [Size of the Whowas mempool chunk.])
 ])
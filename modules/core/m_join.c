@@ -193,7 +193,7 @@ ms_join(struct Client *source_p, int parc, char *parv[])
   {
     remove_our_modes(chptr, source_p);
 
-    if (chptr->topic[0])
+    if (ChannelTopic(chptr)[0])
     {
       channel_set_topic(chptr, "", "", 0, 0);
       sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s TOPIC %s :",
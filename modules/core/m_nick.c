@@ -347,9 +347,9 @@ uid_from_server(struct Client *source_p, int parc, char *parv[])
   strlcpy(client_p->account, parv[9], sizeof(client_p->account));
   strlcpy(client_p->name, parv[1], sizeof(client_p->name));
   strlcpy(client_p->id, parv[8], sizeof(client_p->id));
-  strlcpy(client_p->sockhost, parv[7], sizeof(client_p->sockhost));
-  strlcpy(client_p->info, parv[parc - 1], sizeof(client_p->info));
-  strlcpy(client_p->host, parv[6], sizeof(client_p->host));
+  client_set_sockhost(client_p, parv[7]);
+  client_set_info(client_p, parv[parc - 1]);
+  client_set_host(client_p, parv[6]);
   strlcpy(client_p->username, parv[5], sizeof(client_p->username));
 
   hash_add_client(client_p);
@@ -43,6 +43,7 @@
 #include "parse.h"
 #include "memory.h"
 #include "modules.h"
+#include "zip.h"
 
 
 /*! Parses server flags to be potentially set
@@ -70,129 +71,6 @@ server_set_flags(struct Client *client_p, const char *flags)
   }
 }
 
-/*
- * send_tb
- *
- * inputs       - pointer to Client
- *              - pointer to channel
- * output       - NONE
- * side effects - Called on a server burst when
- *                server is CAPAB_TBURST capable
- */
-static void
-server_send_tburst(struct Client *client_p, const struct Channel *chptr)
-{
-  /*
-   * We may also send an empty topic here, but only if topic_time isn't 0,
-   * i.e. if we had a topic that got unset.  This is required for syncing
-   * topics properly.
-   *
-   * Imagine the following scenario: Our downlink introduces a channel
-   * to us with a TS that is equal to ours, but the channel topic on
-   * their side got unset while the servers were in splitmode, which means
-   * their 'topic' is newer.  They simply wanted to unset it, so we have to
-   * deal with it in a more sophisticated fashion instead of just resetting
-   * it to their old topic they had before.  Read m_tburst.c:ms_tburst
-   * for further information   -Michael
-   */
-  if (chptr->topic_time)
-    sendto_one(client_p, ":%s TBURST %ju %s %ju %s :%s", me.id,
-               chptr->creationtime, chptr->name,
-               chptr->topic_time,
-               chptr->topic_info,
-               chptr->topic);
-}
-
-/* sendnick_TS()
- *
- * inputs       - client (server) to send nick towards
- *          - client to send nick for
- * output       - NONE
- * side effects - NICK message is sent towards given client_p
- */
-static void
-server_send_client(struct Client *client_p, struct Client *target_p)
-{
-  dlink_node *node = NULL;
-  char ubuf[IRCD_BUFSIZE] = "";
-
-  if (!IsClient(target_p))
-    return;
-
-  send_umode(target_p, 0, 0, ubuf);
-
-  if (ubuf[0] == '\0')
-  {
-    ubuf[0] = '+';
-    ubuf[1] = '\0';
-  }
-
-  sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
-             target_p->servptr->id,
-             target_p->name, target_p->hopcount + 1,
-             target_p->tsinfo,
-             ubuf, target_p->username, target_p->host,
-             target_p->sockhost, target_p->id,
-             target_p->account, target_p->info);
-
-  if (!EmptyString(target_p->certfp))
-    sendto_one(client_p, ":%s CERTFP %s", target_p->id, target_p->certfp);
-
-  if (target_p->away[0])
-    sendto_one(client_p, ":%s AWAY :%s", target_p->id, target_p->away);
-
-
-  DLINK_FOREACH(node, target_p->svstags.head)
-  {
-    const struct ServicesTag *svstag = node->data;
-    char *m = ubuf;
-
-    for (const struct user_modes *tab = umode_tab; tab->c; ++tab)
-      if (svstag->umodes & tab->flag)
-        *m++ = tab->c;
-    *m = '\0';
-
-    sendto_one(client_p, ":%s SVSTAG %s %ju %u +%s :%s", me.id, target_p->id,
-               target_p->tsinfo, svstag->numeric, ubuf, svstag->tag);
-  }
-}
-
-/* burst_all()
- *
- * inputs       - pointer to server to send burst to
- * output       - NONE
- * side effects - complete burst of channels/nicks is sent to client_p
- */
-static void
-server_burst(struct Client *client_p)
-{
-  dlink_node *node = NULL;
-
-  DLINK_FOREACH(node, global_client_list.head)
-  {
-    struct Client *target_p = node->data;
-
-    if (target_p->from != client_p)
-      server_send_client(client_p, target_p);
-  }
-
-  DLINK_FOREACH(node, channel_list.head)
-  {
-    struct Channel *chptr = node->data;
-
-    if (dlink_list_length(&chptr->members))
-    {
-      channel_send_modes(client_p, chptr);
-
-      if (IsCapable(client_p, CAPAB_TBURST))
-        server_send_tburst(client_p, chptr);
-    }
-  }
-
-  /* Always send a PING after connect burst is done */
-  sendto_one(client_p, "PING :%s", me.id);
-}
-
 /* server_estab()
  *
  * inputs       - pointer to a struct Client
@@ -232,7 +110,7 @@ server_estab(struct Client *client_p)
   {
     sendto_one(client_p, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-    sendto_one(client_p, "CAPAB :%s", get_capabilities(NULL));
+    send_capabilities(client_p, conf);
 
     sendto_one(client_p, "SERVER %s 1 :%s%s",
                me.name, ConfigServerHide.hidden ? "(H) " : "", me.info);
@@ -241,6 +119,9 @@ server_estab(struct Client *client_p)
   sendto_one(client_p, ":%s SVINFO %u %u 0 :%ju", me.id, TS_CURRENT, TS_MIN,
              CurrentTime);
 
+  /* Everything past our SVINFO is compressed, if we agreed to */
+  zip_start(client_p);
+
   /* *WARNING*
   **    In the following code in place of plain server's
   **    name we send what is returned by get_client_name
@@ -349,21 +230,8 @@ server_estab(struct Client *client_p)
                target_p->info);
   }
 
+  /* The burst ends with EOB; it continues from io_loop() if the link backs up */
   server_burst(client_p);
-
-  if (IsCapable(client_p, CAPAB_EOB))
-  {
-    DLINK_FOREACH_PREV(node, global_server_list.tail)
-    {
-      struct Client *target_p = node->data;
-
-      if (target_p->from == client_p)
-        continue;
-
-      if (IsMe(target_p) || HasFlag(target_p, FLAGS_EOB))
-        sendto_one(client_p, ":%s EOB", target_p->id);
-    }
-  }
 }
 
 /* set_server_gecos()
@@ -385,9 +253,9 @@ server_set_gecos(struct Client *client_p, const char *info)
   }
 
   if (!EmptyString(s))
-    strlcpy(client_p->info, s, sizeof(client_p->info));
+    client_set_info(client_p, s);
   else
-    strlcpy(client_p->info, "(Unknown Location)", sizeof(client_p->info));
+    client_set_info(client_p, "(Unknown Location)");
 }
 
 /* mr_server()
@@ -555,7 +423,7 @@ mr_server(struct Client *source_p, int parc, char *parv[])
   if (parc == 6)  /* TBR: compatibility 'mode' */
   {
     strlcpy(source_p->id, sid, sizeof(source_p->id));
-    strlcpy(source_p->info, parv[parc - 1], sizeof(source_p->info));
+    client_set_info(source_p, parv[parc - 1]);
     server_set_flags(source_p, parv[4]);
   }
   else
@@ -743,7 +611,7 @@ ms_sid(struct Client *source_p, int parc, char *parv[])
 
   if (parc == 6)  /* TBR: compatibility 'mode' */
   {
-    strlcpy(target_p->info, parv[parc - 1], sizeof(target_p->info));
+    client_set_info(target_p, parv[parc - 1]);
     server_set_flags(target_p, parv[4]);
   }
   else
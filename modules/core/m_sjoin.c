@@ -38,6 +38,7 @@
 #include "modules.h"
 #include "server.h"
 #include "conf.h"
+#include "hostmask.h"
 #include "misc.h"
 
 
@@ -45,9 +46,18 @@ static char modebuf[MODEBUFLEN];
 static char parabuf[MODEBUFLEN];
 static char sendbuf[MODEBUFLEN];
 static const char *para[MAXMODEPARAMS];
+
+/* Members of the SJOIN being processed; a UID takes two bytes at least */
+static struct Client *joined[IRCD_BUFSIZE / 2];
+static struct
+{
+  struct Client *client_p;
+  unsigned int flags;
+} members[IRCD_BUFSIZE / 2];
 static char *mbuf;
 static int pargs;
 
+static void sjoin_add_mode(struct Channel *, const char *, char, const char *);
 static void set_final_mode(struct Mode *, struct Mode *);
 static void remove_our_modes(struct Channel *, struct Client *);
 static void remove_a_mode(struct Channel *, struct Client *, int, char);
@@ -84,6 +94,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
   char           *up = NULL;
   int            len_uid = 0;
   int            isnew = 0;
+  unsigned int   joined_count = 0;
+  unsigned int   member_count = 0;
   int            buflen = 0;
   int            slen;
   unsigned       int fl;
@@ -229,7 +241,7 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
     clear_ban_cache_list(&chptr->locmembers);
     clear_invite_list(&chptr->invites);
 
-    if (chptr->topic[0])
+    if (ChannelTopic(chptr)[0])
     {
       channel_set_topic(chptr, "", "", 0, 0);
       sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s TOPIC %s :",
@@ -375,108 +387,14 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
     if (!IsMember(target_p, chptr))
     {
       add_user_to_channel(chptr, target_p, fl, !have_many_uids);
-
-      sendto_channel_local(NULL, chptr, 0, CAP_EXTENDED_JOIN, 0, ":%s!%s@%s JOIN %s %s :%s",
-                           target_p->name, target_p->username,
-                           target_p->host, chptr->name, target_p->account, target_p->info);
-      sendto_channel_local(NULL, chptr, 0, 0, CAP_EXTENDED_JOIN, ":%s!%s@%s JOIN :%s",
-                           target_p->name, target_p->username,
-                           target_p->host, chptr->name);
-
-      if (target_p->away[0])
-        sendto_channel_local(target_p, chptr, 0, CAP_AWAY_NOTIFY, 0,
-                             ":%s!%s@%s AWAY :%s",
-                             target_p->name, target_p->username,
-                             target_p->host, target_p->away);
+      joined[joined_count++] = target_p;
     }
 
-    if (fl & CHFL_CHANOP)
+    if (fl)
     {
-      *mbuf++ = 'o';
-      para[pargs++] = target_p->name;
-
-      if (pargs >= MAXMODEPARAMS)
-      {
-        /*
-         * Ok, the code is now going to "walk" through
-         * sendbuf, filling in para strings. So, I will use sptr
-         * to point into the sendbuf.
-         * Notice, that ircsprintf() returns the number of chars
-         * successfully inserted into string.
-         * - Dianora
-         */
-
-        sptr = sendbuf;
-        *mbuf = '\0';
-
-        for (lcount = 0; lcount < MAXMODEPARAMS; ++lcount)
-        {
-          slen = sprintf(sptr, " %s", para[lcount]);  /* see? */
-          sptr += slen;  /* ready for next */
-        }
-
-        sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, chptr->name, modebuf, sendbuf);
-        mbuf = modebuf;
-        *mbuf++ = '+';
-
-        sendbuf[0] = '\0';
-        pargs = 0;
-      }
-    }
-
-    if (fl & CHFL_HALFOP)
-    {
-      *mbuf++ = 'h';
-      para[pargs++] = target_p->name;
-
-      if (pargs >= MAXMODEPARAMS)
-      {
-        sptr = sendbuf;
-        *mbuf = '\0';
-
-        for (lcount = 0; lcount < MAXMODEPARAMS; ++lcount)
-        {
-          slen = sprintf(sptr, " %s", para[lcount]);
-          sptr += slen;
-        }
-
-        sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, chptr->name, modebuf, sendbuf);
-
-        mbuf = modebuf;
-        *mbuf++ = '+';
-
-        sendbuf[0] = '\0';
-        pargs = 0;
-      }
-    }
-
-    if (fl & CHFL_VOICE)
-    {
-      *mbuf++ = 'v';
-      para[pargs++] = target_p->name;
-
-      if (pargs >= MAXMODEPARAMS)
-      {
-        sptr = sendbuf;
-        *mbuf = '\0';
-
-        for (lcount = 0; lcount < MAXMODEPARAMS; ++lcount)
-        {
-          slen = sprintf(sptr, " %s", para[lcount]);
-          sptr += slen;
-        }
-
-        sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s MODE %s %s%s",
-                             servername, chptr->name, modebuf, sendbuf);
-
-        mbuf = modebuf;
-        *mbuf++ = '+';
-
-        sendbuf[0] = '\0';
-        pargs = 0;
-      }
+      members[member_count].client_p = target_p;
+      members[member_count].flags = fl;
+      ++member_count;
     }
 
   nextnick:
@@ -495,6 +413,25 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
     }
   }
 
+  /*
+   * Local members get all of the JOINs first, then the modes. Their
+   * output is written once we're done.
+   */
+  sendto_batch_begin(NULL, NULL);
+  sendto_channel_local_joins(chptr, joined, joined_count);
+
+  for (unsigned int i = 0; i < member_count; ++i)
+  {
+    target_p = members[i].client_p;
+
+    if (members[i].flags & CHFL_CHANOP)
+      sjoin_add_mode(chptr, servername, 'o', target_p->name);
+    if (members[i].flags & CHFL_HALFOP)
+      sjoin_add_mode(chptr, servername, 'h', target_p->name);
+    if (members[i].flags & CHFL_VOICE)
+      sjoin_add_mode(chptr, servername, 'v', target_p->name);
+  }
+
   *mbuf = '\0';
   *(uid_ptr - 1) = '\0';
 
@@ -520,6 +457,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
                          servername, chptr->name, modebuf, sendbuf);
   }
 
+  sendto_batch_end();
+
   /*
    * If this happens, it's the result of a malformed SJOIN
    * a remnant from the old persistent channel code. *sigh*
@@ -540,6 +479,52 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
   return 0;
 }
 
+/* sjoin_add_mode()
+ *
+ * inputs       - pointer to channel
+ *              - name the MODE is sent from
+ *              - mode letter
+ *              - nick the mode is given to
+ * output       - NONE
+ * side effects - the mode is added to modebuf. Once it holds
+ *                MAXMODEPARAMS parameters, the MODE is sent to local
+ *                members.
+ */
+static void
+sjoin_add_mode(struct Channel *chptr, const char *servername, char letter,
+               const char *name)
+{
+  char *sptr = sendbuf;
+
+  *mbuf++ = letter;
+  para[pargs++] = name;
+
+  if (pargs < MAXMODEPARAMS)
+    return;
+
+  /*
+   * Ok, the code is now going to "walk" through
+   * sendbuf, filling in para strings. So, I will use sptr
+   * to point into the sendbuf.
+   * Notice, that ircsprintf() returns the number of chars
+   * successfully inserted into string.
+   * - Dianora
+   */
+  *mbuf = '\0';
+
+  for (int lcount = 0; lcount < MAXMODEPARAMS; ++lcount)
+    sptr += sprintf(sptr, " %s", para[lcount]);  /* see? */
+
+  sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s MODE %s %s%s",
+                       servername, chptr->name, modebuf, sendbuf);
+
+  mbuf = modebuf;
+  *mbuf++ = '+';
+
+  sendbuf[0] = '\0';
+  pargs = 0;
+}
+
 /* set_final_mode
  *
  * inputs	- channel mode
@@ -737,7 +722,7 @@ remove_ban_list(struct Channel *chptr, struct Client *source_p,
 
     *mbuf++ = c;
     cur_len += plen;
-    pbuf += sprintf(pbuf, "%s!%s@%s ", ban->name, ban->user, ban->host);
+    pbuf += sprintf(pbuf, "%s!%s@%s ", BanName(ban), BanUser(ban), BanHost(ban));
     ++count;
 
     remove_ban(ban, list);
@@ -53,7 +53,7 @@ do_away(struct Client *source_p, const char *message)
     /* Marking as not away */
     if (source_p->away[0])
     {
-      source_p->away[0] = '\0';
+      client_set_away(source_p, "");
 
       /* We now send this only if they were away before --is */
       sendto_server(source_p, 0, 0, ":%s AWAY", source_p->id);
@@ -82,7 +82,7 @@ do_away(struct Client *source_p, const char *message)
     sendto_one_numeric(source_p, &me, RPL_NOWAWAY);
   }
 
-  strlcpy(source_p->away, message, sizeof(source_p->away));
+  client_set_away(source_p, message);
   sendto_common_channels_local(source_p, 1, CAP_AWAY_NOTIFY, 0, ":%s!%s@%s AWAY :%s",
                                source_p->name, source_p->username,
                                source_p->host, source_p->away);
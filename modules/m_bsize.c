@@ -0,0 +1,134 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file m_bsize.c
+ * \brief Includes required functions for processing the BSIZE command.
+ * \version $Id$
+ */
+
+#include "stdinc.h"
+#include "client.h"
+#include "channel.h"
+#include "conf.h"
+#include "conf_class.h"
+#include "ircd.h"
+#include "modules.h"
+#include "server.h"
+#include "parse.h"
+
+
+static unsigned int
+bsize_count(const char *str)
+{
+  unsigned long count = strtoul(str, NULL, 10);
+
+  return count > UINT_MAX ? UINT_MAX : count;
+}
+
+/*! \brief BSIZE command handler
+ *
+ * \param source_p Pointer to allocated Client struct from which the message
+ *                 originally comes from.  This can be a local or remote client.
+ * \param parc     Integer holding the number of supplied arguments.
+ * \param parv     Argument vector where parv[0] .. parv[parc-1] are non-NULL
+ *                 pointers.
+ * \note Valid arguments for this command are:
+ *      - parv[0] = command
+ *      - parv[1] = number of users
+ *      - parv[2] = number of channels
+ *      - parv[3] = number of channel members
+ */
+static int
+ms_bsize(struct Client *source_p, int parc, char *parv[])
+{
+  const struct MaskItem *conf = NULL;
+  unsigned int users = 0, channels = 0, members = 0;
+  double bytes = 0, limit = 0;
+
+  /* Only meaningful at the start of a burst from a directly linked server */
+  if (!IsServer(source_p) || !MyConnect(source_p) || HasFlag(source_p, FLAGS_EOB))
+    return 0;
+
+  /* ..whose connect {} block says we may believe it */
+  conf = source_p->connection->confs.head->data;
+  if (!IsConfBsize(conf))
+    return 0;
+
+  users = bsize_count(parv[1]);
+  channels = bsize_count(parv[2]);
+  members = bsize_count(parv[3]);
+
+  /*
+   * Don't reserve more than BSIZE_SENDQ_SCALE times the sendq of the
+   * link's class. If the announcement asks for more, each count is cut
+   * down by the same share.
+   */
+  bytes = (double)users * sizeof(struct Client) +
+          (double)channels * sizeof(struct Channel) +
+          (double)members * sizeof(struct Membership);
+  limit = (double)get_sendq(&source_p->connection->confs) * BSIZE_SENDQ_SCALE;
+
+  if (bytes > limit)
+  {
+    const double share = limit / bytes;
+
+    users *= share;
+    channels *= share;
+    members *= share;
+  }
+
+  client_reserve(users);
+  channel_reserve(channels, members);
+  return 0;
+}
+
+static struct Message bsize_msgtab =
+{
+  .cmd = "BSIZE",
+  .args_min = 4,
+  .args_max = MAXPARA,
+  .handlers[UNREGISTERED_HANDLER] = m_ignore,
+  .handlers[CLIENT_HANDLER] = m_ignore,
+  .handlers[SERVER_HANDLER] = ms_bsize,
+  .handlers[ENCAP_HANDLER] = m_ignore,
+  .handlers[OPER_HANDLER] = m_ignore
+};
+
+static void
+module_init(void)
+{
+  mod_add_cmd(&bsize_msgtab);
+  add_capability("BSIZE", CAPAB_BSIZE);
+}
+
+static void
+module_exit(void)
+{
+  mod_del_cmd(&bsize_msgtab);
+  delete_capability("BSIZE");
+}
+
+struct module module_entry =
+{
+  .version = "$Revision$",
+  .modinit = module_init,
+  .modexit = module_exit,
+};
@@ -58,7 +58,8 @@ static struct capabilities
   _CAP(CAP_EXTENDED_JOIN, 0, "extended-join"),
   _CAP(CAP_ACCOUNT_NOTIFY, 0, "account-notify"),
   _CAP(CAP_INVITE_NOTIFY, 0, "invite-notify"),
-  _CAP(CAP_CHGHOST, 0, "chghost")
+  _CAP(CAP_CHGHOST, 0, "chghost"),
+  _CAP(CAP_BATCH, 0, "batch")
 #undef _CAP
 };
 
@@ -400,6 +400,12 @@ static const struct InfoStruct info_table[] =
     &ConfigGeneral.max_watch,
     "Maximum nicknames on watch list"
   },
+  {
+    "memory_budget",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.memory_budget,
+    "Megabytes of queued data before load is shed"
+  },
   {
     "max_accept",
     OUTPUT_DECIMAL,
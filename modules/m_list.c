@@ -37,17 +37,21 @@
 #include "user.h"
 #include "memory.h"
 #include "isupport.h"
+#include "cursor.h"
 
 
 static void
 do_list(struct Client *source_p, char *arg)
 {
   int no_masked_channels = 1;
+  struct Cursor *cursor = cursor_find(source_p, &list_cursor_type);
 
-  if (source_p->connection->list_task)
+  if (cursor)
   {
-    free_list_task(source_p);
+    cursor_free(cursor);
+    sendto_bulk_begin(source_p);  /* Behind what was listed so far */
     sendto_one_numeric(source_p, &me, RPL_LISTEND);
+    sendto_bulk_end();
     return;
   }
 
@@ -55,8 +59,6 @@ do_list(struct Client *source_p, char *arg)
   lt->users_max = UINT_MAX;
   lt->created_max = UINT_MAX;
   lt->topicts_max = UINT_MAX;
-  source_p->connection->list_task = lt;
-  dlinkAdd(source_p, &lt->node, &listing_client_list);
 
   if (!EmptyString(arg))
   {
@@ -153,14 +155,18 @@ do_list(struct Client *source_p, char *arg)
 
     if (errors)
     {
-      free_list_task(source_p);
+      free_list_task(lt);
       sendto_one_numeric(source_p, &me, ERR_LISTSYNTAX);
       return;
     }
   }
 
+  sendto_bulk_begin(source_p);
   sendto_one_numeric(source_p, &me, RPL_LISTSTART);
-  safe_list_channels(source_p, no_masked_channels && lt->show_mask.head != NULL);
+  sendto_bulk_end();
+
+  lt->only_unmasked = no_masked_channels && lt->show_mask.head != NULL;
+  safe_list_channels(source_p, lt);
 }
 
 /*! \brief LIST command handler
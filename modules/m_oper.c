@@ -37,6 +37,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "packet.h"
+#include "password.h"
 
 
 /*! \brief Blindly opers up given source_p, using conf info.
@@ -125,6 +126,7 @@ static int
 m_oper(struct Client *source_p, int parc, char *parv[])
 {
   struct MaskItem *conf = NULL;
+  char resume[IRCD_BUFSIZE];
   const char *const opername = parv[1];
   const char *const password = parv[2];
 
@@ -164,23 +166,34 @@ m_oper(struct Client *source_p, int parc, char *parv[])
     }
   }
 
-  if (match_conf_password(password, conf))
+  snprintf(resume, sizeof(resume), "OPER %s :%s", opername, password);
+
+  switch (password_verify(source_p, password, conf, resume))
   {
-    if (attach_conf(source_p, conf))
-    {
-      sendto_one_notice(source_p, &me, ":Can't attach conf!");
-      failed_oper_notice(source_p, opername, "can't attach conf!");
+    case PASSWORD_PENDING:
+      /*
+       * We're called again with the same arguments once the verdict is
+       * known, or this is dropped if another check is still running
+       */
+      return 0;
+    case PASSWORD_MATCH:
+      password_forget(source_p);
+      break;
+    default:
+      password_forget(source_p);
+      sendto_one_numeric(source_p, &me, ERR_PASSWDMISMATCH);
+      failed_oper_notice(source_p, opername, "password mismatch");
       return 0;
-    }
-
-    oper_up(source_p);
   }
-  else
+
+  if (attach_conf(source_p, conf))
   {
-    sendto_one_numeric(source_p, &me, ERR_PASSWDMISMATCH);
-    failed_oper_notice(source_p, opername, "password mismatch");
+    sendto_one_notice(source_p, &me, ":Can't attach conf!");
+    failed_oper_notice(source_p, opername, "can't attach conf!");
+    return 0;
   }
 
+  oper_up(source_p);
   return 0;
 }
 
@@ -105,8 +105,8 @@ ms_ping(struct Client *source_p, int parc, char *parv[])
 
   const char *const destination = parv[2];  /* Will get NULL or pointer (parc >= 2!!) */
   if (EmptyString(destination) || ((target_p = hash_find_server(destination)) && IsMe(target_p)))
-    sendto_one(source_p, ":%s PONG %s :%s", ID_or_name(&me, source_p),
-               me.name, ID_or_name(source_p, source_p));
+    sendto_one_control(source_p, ":%s PONG %s :%s", ID_or_name(&me, source_p),
+                       me.name, ID_or_name(source_p, source_p));
   else if (target_p)
   {
     if (target_p->from != source_p->from)
@@ -35,6 +35,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "misc.h"
+#include "res.h"
 
 
 /* SET AUTOCONN */
@@ -135,6 +136,29 @@ quote_identtimeout(struct Client *source_p, const char *arg, int newval)
                       GlobalSetOptions.ident_timeout);
 }
 
+/* SET DNSCACHE */
+static void
+quote_dnscache(struct Client *source_p, const char *arg, int newval)
+{
+  if (!HasUMode(source_p, UMODE_ADMIN))
+  {
+    sendto_one_numeric(source_p, &me, ERR_NOPRIVS, "set");
+    return;
+  }
+
+  if (newval >= 0)
+  {
+    GlobalSetOptions.dns_cache_size = newval;
+    resolver_cache_trim();
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed DNSCACHE to %u",
+                         get_oper_name(source_p), GlobalSetOptions.dns_cache_size);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":DNSCACHE is currently %u",
+                      GlobalSetOptions.dns_cache_size);
+}
+
 /* SET MAX */
 static void
 quote_max(struct Client *source_p, const char *arg, int newval)
@@ -261,6 +285,7 @@ static const struct SetStruct set_cmd_table[] =
   /* -------------------------------------------------------- */
   { "AUTOCONN",         quote_autoconn,         1,      1 },
   { "AUTOCONNALL",      quote_autoconnall,      0,      1 },
+  { "DNSCACHE",         quote_dnscache,         0,      1 },
   { "FLOODCOUNT",       quote_floodcount,       0,      1 },
   { "FLOODTIME",        quote_floodtime,        0,      1 },
   { "IDENTTIMEOUT",     quote_identtimeout,     0,      1 },
@@ -47,10 +47,19 @@
 #include "parse.h"
 #include "modules.h"
 #include "whowas.h"
+#include "intern.h"
+#include "mempool.h"
+#include "pressure.h"
 #include "watch.h"
+#include "res.h"
 #include "reslib.h"
 #include "motd.h"
 #include "ipcache.h"
+#include "password.h"
+#include "zip.h"
+#include "cursor.h"
+#include "hash.h"
+#include "memory.h"
 
 
 static void
@@ -212,6 +221,10 @@ stats_connect(struct Client *source_p, int parc, char *parv[])
       *p++ = 'A';
     if (IsConfSSL(conf))
       *p++ = 'S';
+    if (IsConfCompressed(conf))
+      *p++ = 'Z';
+    if (IsConfBsize(conf))
+      *p++ = 'B';
     if (p == buf)
       *p++ = '*';
 
@@ -282,11 +295,16 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   size_t channel_except_memory = 0;
   size_t channel_invex_memory = 0;
 
-  unsigned int safelist_count = 0;
-  size_t safelist_memory = 0;
+  unsigned int cursor_count = 0;
+  size_t cursor_memory = 0;
+  unsigned int list_snapshot_count = 0;
+  size_t list_snapshot_memory = 0;
 
   size_t wwm = 0;               /* whowas array memory used       */
   size_t mem_ips_stored = 0;        /* memory used by ip address hash */
+  unsigned int throttle_rejected[IP_THROTTLE_LEVELS];
+  unsigned int dns_cached = 0, dns_hits = 0, dns_misses = 0, dns_coalesced = 0;
+  size_t dns_cached_memory = 0;
 
   unsigned int local_client_count  = 0;
   unsigned int remote_client_count = 0;
@@ -301,6 +319,11 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   unsigned int listener_count = 0;
   size_t listener_memory = 0;
 
+  unsigned int intern_count = 0, intern_refs = 0;
+  size_t intern_memory = 0, intern_unshared = 0;
+
+  const struct pressure_stats *const ps = pressure_get_stats();
+
 
   DLINK_FOREACH(node, global_client_list.head)
   {
@@ -328,31 +351,19 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
     channel_invites += dlink_list_length(&chptr->invites);
 
     channel_bans += dlink_list_length(&chptr->banlist);
-    channel_ban_memory += dlink_list_length(&chptr->banlist) * sizeof(struct Ban);
+    DLINK_FOREACH(node2, chptr->banlist.head)
+      channel_ban_memory += BanSize((const struct Ban *)node2->data);
 
     channel_except += dlink_list_length(&chptr->exceptlist);
-    channel_except_memory += dlink_list_length(&chptr->exceptlist) * sizeof(struct Ban);
+    DLINK_FOREACH(node2, chptr->exceptlist.head)
+      channel_except_memory += BanSize((const struct Ban *)node2->data);
 
     channel_invex += dlink_list_length(&chptr->invexlist);
-    channel_invex_memory += dlink_list_length(&chptr->invexlist) * sizeof(struct Ban);
+    DLINK_FOREACH(node2, chptr->invexlist.head)
+      channel_invex_memory += BanSize((const struct Ban *)node2->data);
   }
 
-  safelist_count = dlink_list_length(&listing_client_list);
-  if (safelist_count)
-  {
-    safelist_memory = safelist_count * sizeof(struct ListTask);
-
-    DLINK_FOREACH(node, listing_client_list.head)
-    {
-      const struct Client *acptr = node->data;
-
-      DLINK_FOREACH(node2, acptr->connection->list_task->show_mask.head)
-        safelist_memory += strlen(node2->data);
-
-      DLINK_FOREACH(node2, acptr->connection->list_task->hide_mask.head)
-        safelist_memory += strlen(node2->data);
-    }
-  }
+  cursor_count_memory(&cursor_count, &cursor_memory);
 
   watch_count_memory(&watch_list_headers, &watch_list_memory);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -414,8 +425,29 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      channel_invites * sizeof(struct Invite));
 
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
-                     "z :Safelist %u(%zu)",
-                     safelist_count, safelist_memory);
+                     "z :Cursors %u(%zu)",
+                     cursor_count, cursor_memory);
+
+  list_snapshot_count_memory(&list_snapshot_count, &list_snapshot_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :LIST snapshot %u(%zu)",
+                     list_snapshot_count, list_snapshot_memory);
+
+  intern_count_memory(&intern_count, &intern_refs, &intern_memory, &intern_unshared);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Shared strings %u(%zu) references %u(%zu) ratio %.2f",
+                     intern_count, intern_memory, intern_refs, intern_unshared,
+                     intern_count ? (double)intern_refs / intern_count : 0.0);
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Queued data %zu peak %zu budget %zu soft %zu hard %zu level %u",
+                     ps->memory, ps->peak, pressure_budget(),
+                     pressure_watermark(PRESSURE_SOFT), pressure_watermark(PRESSURE_HARD),
+                     ps->level);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Memory pressure soft %u hard %u deferred %u dropped %u(%ju) shed %u refused %u warned %u",
+                     ps->soft, ps->hard, ps->deferred, ps->dropped, ps->dropped_bytes,
+                     ps->shed, ps->refused, ps->warned);
 
   whowas_count_memory(&wwu, &wwm);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -423,11 +455,24 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
 
   motd_memory_count(source_p);
 
+  resolver_count_memory(&dns_cached, &dns_cached_memory, &dns_hits,
+                        &dns_misses, &dns_coalesced);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :DNS cache %u(%zu) hits %u misses %u shared %u",
+                     dns_cached, dns_cached_memory, dns_hits, dns_misses,
+                     dns_coalesced);
+
   ipcache_get_stats(&number_ips_stored, &mem_ips_stored);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :iphash %u(%zu)",
                      number_ips_stored, mem_ips_stored);
 
+  number_ips_stored = 0;
+  ipcache_throttle_get_stats(&number_ips_stored, &mem_ips_stored, throttle_rejected);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Connect throttle %u(%zu)",
+                     number_ips_stored, mem_ips_stored);
+
   local_client_memory_used = local_client_count *(sizeof(struct Client) + sizeof(struct Connection));
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Local client Memory in use: %u(%zu)",
@@ -437,6 +482,19 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Remote client Memory in use: %u(%zu)",
                      remote_client_count, remote_client_memory_used);
+
+  for (const mp_pool_t *pool = mp_pool_get_list(); pool; pool = pool->next)
+  {
+    const unsigned int slots = (pool->n_chunks - pool->n_empty_chunks) * pool->new_chunk_capacity;
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "z :Pool %s size %zu items %u(%zu) max %u chunks %d(%zu) empty %d fill %u%%%s",
+                       pool->name, pool->item_size, pool->n_items, pool->n_items * pool->item_size,
+                       pool->max_items, pool->n_chunks,
+                       pool->n_chunks * pool->chunk_alloc_size, pool->n_empty_chunks,
+                       slots ? (unsigned int)((uint64_t)pool->n_items * 100 / slots) : 100,
+                       pool->hugepages ? " hugepages" : "");
+  }
 }
 
 static void
@@ -453,6 +511,103 @@ stats_dns_servers(struct Client *source_p, int parc, char *parv[])
   }
 }
 
+/*! \brief State of a STATS reply that walks the address table */
+struct StatsTask
+{
+  unsigned int type;  /**< Type of AddressRec reported */
+  unsigned char letter;  /**< For RPL_ENDOFSTATS */
+  void (*report)(struct Client *, const struct MaskItem *);
+};
+
+/* Cursors started by the stats handler being run, see do_stats() */
+static unsigned int stats_cursors;
+
+/* stats_atable_step()
+ *
+ * input	- client to report to
+ *		- its cursor, walking atable
+ * output	- 0 once the reply is complete, 1 otherwise
+ * side effects - entries of the next atable bucket are reported
+ */
+static int
+stats_atable_step(struct Client *source_p, struct Cursor *cursor)
+{
+  const struct StatsTask *const st = cursor->data;
+  dlink_node *node;
+
+  if (cursor->index == ATABLE_SIZE)
+  {
+    sendto_one_numeric(source_p, &me, RPL_ENDOFSTATS, st->letter);
+    return 0;
+  }
+
+  DLINK_FOREACH(node, atable[cursor->index].head)
+  {
+    const struct AddressRec *arec = node->data;
+
+    if (arec->type == st->type)
+      st->report(source_p, arec->conf);
+  }
+
+  ++cursor->index;
+  return 1;
+}
+
+static void
+stats_atable_free(struct Cursor *cursor)
+{
+  xfree(cursor->data);
+}
+
+static size_t
+stats_atable_memory(const struct Cursor *cursor)
+{
+  return sizeof(struct StatsTask);
+}
+
+static const struct CursorType stats_cursor_type =
+{
+  .bulk = 1,
+  .step = stats_atable_step,
+  .free = stats_atable_free,
+  .memory = stats_atable_memory
+};
+
+/* stats_atable()
+ *
+ * input	- client to report to
+ *		- letter of the request
+ *		- type of AddressRec to report
+ *		- function reporting one of them
+ * output	- none
+ * side effects - the reply, including RPL_ENDOFSTATS, is sent through a
+ *		  cursor, so a long list of klines follows as the client
+ *		  reads it
+ */
+static void
+stats_atable(struct Client *source_p, unsigned char letter, unsigned int type,
+             void (*report)(struct Client *, const struct MaskItem *))
+{
+  struct StatsTask *const st = xcalloc(sizeof(*st));
+
+  st->type = type;
+  st->letter = letter;
+  st->report = report;
+
+  ++stats_cursors;
+  cursor_start(source_p, &stats_cursor_type, NULL, st);
+}
+
+static void
+report_deny(struct Client *source_p, const struct MaskItem *conf)
+{
+  /* Don't report a temporary dline as permanent dline */
+  if (conf->until)
+    return;
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'D', conf->host, conf->reason);
+}
+
 /* stats_deny()
  *
  * input	- client to report to
@@ -462,25 +617,17 @@ stats_dns_servers(struct Client *source_p, int parc, char *parv[])
 static void
 stats_deny(struct Client *source_p, int parc, char *parv[])
 {
-  dlink_node *node;
-
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(node, atable[i].head)
-    {
-      const struct AddressRec *arec = node->data;
-
-      if (arec->type != CONF_DLINE)
-        continue;
+  stats_atable(source_p, *parv[1], CONF_DLINE, report_deny);
+}
 
-      const struct MaskItem *conf = arec->conf;
-      /* Don't report a temporary dline as permanent dline */
-      if (conf->until)
-        continue;
+static void
+report_tdeny(struct Client *source_p, const struct MaskItem *conf)
+{
+  /* Don't report a permanent dline as temporary dline */
+  if (!conf->until)
+    return;
 
-      sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'D', conf->host, conf->reason);
-    }
-  }
+  sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'd', conf->host, conf->reason);
 }
 
 /* stats_tdeny()
@@ -492,25 +639,13 @@ stats_deny(struct Client *source_p, int parc, char *parv[])
 static void
 stats_tdeny(struct Client *source_p, int parc, char *parv[])
 {
-  dlink_node *node;
-
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(node, atable[i].head)
-    {
-      const struct AddressRec *arec = node->data;
-
-      if (arec->type != CONF_DLINE)
-        continue;
-
-      const struct MaskItem *conf = arec->conf;
-      /* Don't report a permanent dline as temporary dline */
-      if (!conf->until)
-        continue;
+  stats_atable(source_p, *parv[1], CONF_DLINE, report_tdeny);
+}
 
-      sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'd', conf->host, conf->reason);
-    }
-  }
+static void
+report_exempt(struct Client *source_p, const struct MaskItem *conf)
+{
+  sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'e', conf->host, "");
 }
 
 /* stats_exempt()
@@ -522,27 +657,13 @@ stats_tdeny(struct Client *source_p, int parc, char *parv[])
 static void
 stats_exempt(struct Client *source_p, int parc, char *parv[])
 {
-  dlink_node *node;
-
   if (ConfigGeneral.stats_e_disabled)
   {
     sendto_one_numeric(source_p, &me, ERR_NOPRIVILEGES);
     return;
   }
 
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(node, atable[i].head)
-    {
-      const struct AddressRec *arec = node->data;
-
-      if (arec->type != CONF_EXEMPT)
-        continue;
-
-      const struct MaskItem *conf = arec->conf;
-      sendto_one_numeric(source_p, &me, RPL_STATSDLINE, 'e', conf->host, "");
-    }
-  }
+  stats_atable(source_p, *parv[1], CONF_EXEMPT, report_exempt);
 }
 
 static void
@@ -631,30 +752,16 @@ show_iline_prefix(const struct Client *source_p, const struct MaskItem *conf)
 }
 
 static void
-report_auth(struct Client *source_p, int parc, char *parv[])
+report_auth(struct Client *source_p, const struct MaskItem *conf)
 {
-  dlink_node *node;
-
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(node, atable[i].head)
-    {
-      const struct AddressRec *arec = node->data;
-
-      if (arec->type != CONF_CLIENT)
-        continue;
-
-      const struct MaskItem *conf = arec->conf;
-      if (!HasUMode(source_p, UMODE_OPER) && IsConfDoSpoofIp(conf))
-        continue;
+  if (!HasUMode(source_p, UMODE_OPER) && IsConfDoSpoofIp(conf))
+    return;
 
-      sendto_one_numeric(source_p, &me, RPL_STATSILINE, 'I',
-                         conf->name == NULL ? "*" : conf->name,
-                         show_iline_prefix(source_p, conf),
-                         conf->host, conf->port,
-                         conf->class->name);
-    }
-  }
+  sendto_one_numeric(source_p, &me, RPL_STATSILINE, 'I',
+                     conf->name == NULL ? "*" : conf->name,
+                     show_iline_prefix(source_p, conf),
+                     conf->host, conf->port,
+                     conf->class->name);
 }
 
 static void
@@ -688,45 +795,29 @@ stats_auth(struct Client *source_p, int parc, char *parv[])
                        conf->class->name);
   }
   else  /* They are opered, or allowed to see all auth blocks */
-    report_auth(source_p, 0, NULL);
+    stats_atable(source_p, *parv[1], CONF_CLIENT, report_auth);
 }
 
-/* report_Klines()
- * Inputs: Client to report to,
- *         type(==0 for perm, !=0 for temporary)
- *         mask
- * Output: None
- * Side effects: Reports configured K(or k)-lines to source_p.
- */
 static void
-report_Klines(struct Client *source_p, int tkline)
+report_kline(struct Client *source_p, const struct MaskItem *conf)
 {
-  dlink_node *node;
-  char c = '\0';
-
-  if (tkline)
-    c = 'k';
-  else
-    c = 'K';
-
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(node, atable[i].head)
-    {
-      const struct AddressRec *arec = node->data;
+  /* Don't report a temporary kline as permanent kline */
+  if (conf->until)
+    return;
 
-      if (arec->type != CONF_KLINE)
-        continue;
+  sendto_one_numeric(source_p, &me, RPL_STATSKLINE, 'K', conf->host, conf->user,
+                     conf->reason);
+}
 
-      const struct MaskItem *conf = arec->conf;
-      if ((!tkline && conf->until) ||
-          (tkline && !conf->until))
-        continue;
+static void
+report_tkline(struct Client *source_p, const struct MaskItem *conf)
+{
+  /* Don't report a permanent kline as temporary kline */
+  if (!conf->until)
+    return;
 
-      sendto_one_numeric(source_p, &me, RPL_STATSKLINE, c, conf->host, conf->user,
-                         conf->reason);
-    }
-  }
+  sendto_one_numeric(source_p, &me, RPL_STATSKLINE, 'k', conf->host, conf->user,
+                     conf->reason);
 }
 
 static void
@@ -761,7 +852,7 @@ stats_tklines(struct Client *source_p, int parc, char *parv[])
                        conf->host, conf->user, conf->reason);
   }
   else  /* They are opered, or allowed to see all klines */
-    report_Klines(source_p, 1);
+    stats_atable(source_p, *parv[1], CONF_KLINE, report_tkline);
 }
 
 static void
@@ -797,7 +888,7 @@ stats_klines(struct Client *source_p, int parc, char *parv[])
                        conf->host, conf->user, conf->reason);
   }
   else  /* They are opered, or allowed to see all klines */
-    report_Klines(source_p, 0);
+    stats_atable(source_p, *parv[1], CONF_KLINE, report_kline);
 }
 
 static void
@@ -909,6 +1000,10 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
   dlink_node *node;
   struct ServerStatistics tmp;
   struct ServerStatistics *sp = &tmp;
+  unsigned int throttle_active = 0, throttle_rejected[IP_THROTTLE_LEVELS];
+  size_t throttle_memory = 0;
+  const struct ident_stats *const ident = auth_get_ident_stats();
+  const struct password_stats *const password = password_get_stats();
 
   memcpy(sp, &ServerStats, sizeof(struct ServerStatistics));
 
@@ -959,6 +1054,22 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :auth successes %u fails %u",
                      sp->is_asuc, sp->is_abad);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :ident answered %u refused %u timed out %u skipped %u",
+                     ident->result[IDENT_ANSWERED], ident->result[IDENT_REFUSED],
+                     ident->result[IDENT_TIMEDOUT], ident->skipped);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :ident rtt %ums timeout %us",
+                     ident->rtt, ident->timeout);
+  ipcache_throttle_get_stats(&throttle_active, &throttle_memory, throttle_rejected);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :throttled host %u network %u",
+                     throttle_rejected[IP_THROTTLE_HOST],
+                     throttle_rejected[IP_THROTTLE_NETWORK]);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :crypt queued %u pending %u cached %u synchronous %u busy %u",
+                     password->queued, password->pending, password->hits,
+                     password->synchronous, password->busy);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :Client Server");
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -1051,6 +1162,7 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
   dlink_node *node;
   uintmax_t sendB = 0, recvB = 0;
   uintmax_t uptime = 0;
+  const struct zip_stats *zip = NULL;
 
   if (ConfigServerHide.flatten_links && !HasUMode(source_p, UMODE_OPER))
   {
@@ -1072,7 +1184,7 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
     /* ":%s 211 %s %s %u %u %ju %u %ju :%u %u %s" */
     sendto_one_numeric(source_p, &me, RPL_STATSLINKINFO,
                get_client_name(target_p, HasUMode(source_p, UMODE_ADMIN) ? SHOW_IP : MASK_IP),
-               dbuf_length(&target_p->connection->buf_sendq),
+               sendq_length(target_p->connection),
                target_p->connection->send.messages,
                target_p->connection->send.bytes >> 10,
                target_p->connection->recv.messages,
@@ -1080,6 +1192,15 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
                (unsigned int)(CurrentTime - target_p->connection->firsttime),
                (CurrentTime > target_p->connection->since) ? (unsigned int)(CurrentTime - target_p->connection->since) : 0,
                HasUMode(source_p, UMODE_OPER) ? get_capabilities(target_p) : "TS");
+
+    if (HasUMode(source_p, UMODE_OPER) && (zip = zip_get_stats(target_p)))
+      sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                         "? :%s compressed out %ju/%ju (%.1f%%) in %ju/%ju (%.1f%%) cpu %jums",
+                         target_p->name, zip->out_wire, zip->out,
+                         zip->out ? 100.0 * zip->out_wire / zip->out : 100.0,
+                         zip->in_wire, zip->in,
+                         zip->in ? 100.0 * zip->in_wire / zip->in : 100.0,
+                         zip->cpu / 1000);
   }
 
   sendB >>= 10;
@@ -1171,7 +1292,7 @@ stats_L_list(struct Client *source_p, const char *name, int doall, int wilds,
 
     sendto_one_numeric(source_p, &me, RPL_STATSLINKINFO,
                        get_client_name(target_p, type),
-                       dbuf_length(&target_p->connection->buf_sendq),
+                       sendq_length(target_p->connection),
                        target_p->connection->send.messages,
                        target_p->connection->send.bytes >> 10,
                        target_p->connection->recv.messages,
@@ -1272,6 +1393,7 @@ static void
 do_stats(struct Client *source_p, int parc, char *parv[])
 {
   const unsigned char statchar = *parv[1];
+  const unsigned int cursors = stats_cursors;
   const struct StatsStruct *tab;
 
   if (statchar == '\0')
@@ -1293,7 +1415,9 @@ do_stats(struct Client *source_p, int parc, char *parv[])
                          source_p->host, source_p->servptr->name);
   }
 
-  sendto_one_numeric(source_p, &me, RPL_ENDOFSTATS, statchar);
+  /* A reply sent through a cursor ends itself */
+  if (stats_cursors == cursors)
+    sendto_one_numeric(source_p, &me, RPL_ENDOFSTATS, statchar);
 }
 
 /*
@@ -1371,6 +1495,7 @@ static void
 module_exit(void)
 {
   mod_del_cmd(&stats_msgtab);
+  cursor_free_type(&stats_cursor_type);
 }
 
 struct module module_entry =
@@ -33,6 +33,7 @@
 #include "log.h"
 #include "parse.h"
 #include "modules.h"
+#include "zip.h"
 
 
 /*! \brief SVINFO command handler
@@ -112,6 +113,8 @@ ms_svinfo(struct Client *source_p, int parc, char *parv[])
           get_client_name(source_p, MASK_IP), CurrentTime, theirtime, deltat);
   }
 
+  /* Everything past their SVINFO is compressed, if we agreed to */
+  zip_start_inflate(source_p);
   return 0;
 }
 
@@ -94,7 +94,7 @@ ms_tburst(struct Client *source_p, int parc, char *parv[])
 
   if (accept_remote)
   {
-    int topic_differs = strncmp(chptr->topic, topic, sizeof(chptr->topic) - 1);
+    int topic_differs = strncmp(ChannelTopic(chptr), topic, TOPICLEN);
     int hidden_server = (ConfigServerHide.hide_servers || IsHidden(source_p));
 
     channel_set_topic(chptr, topic, setby, remote_topic_ts, 0);
@@ -107,11 +107,11 @@ ms_tburst(struct Client *source_p, int parc, char *parv[])
       if (!IsClient(source_p))
         sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s TOPIC %s :%s",
                              hidden_server ? me.name : source_p->name,
-                             chptr->name, chptr->topic);
+                             chptr->name, ChannelTopic(chptr));
       else
         sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s!%s@%s TOPIC %s :%s",
                              source_p->name, source_p->username, source_p->host,
-                             chptr->name, chptr->topic);
+                             chptr->name, ChannelTopic(chptr));
     }
   }
 
@@ -94,12 +94,12 @@ m_topic(struct Client *source_p, int parc, char *parv[])
 
       sendto_server(source_p, 0, 0, ":%s TOPIC %s :%s",
                     source_p->id, chptr->name,
-                    chptr->topic);
+                    ChannelTopic(chptr));
       sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s!%s@%s TOPIC %s :%s",
                            source_p->name,
                            source_p->username,
                            source_p->host,
-                           chptr->name, chptr->topic);
+                           chptr->name, ChannelTopic(chptr));
     }
     else
       sendto_one_numeric(source_p, &me, ERR_CHANOPRIVSNEEDED, chptr->name);
@@ -108,14 +108,14 @@ m_topic(struct Client *source_p, int parc, char *parv[])
   {
     if (!SecretChannel(chptr) || IsMember(source_p, chptr))
     {
-      if (chptr->topic[0] == '\0')
+      if (ChannelTopic(chptr)[0] == '\0')
         sendto_one_numeric(source_p, &me, RPL_NOTOPIC, chptr->name);
       else
       {
         sendto_one_numeric(source_p, &me, RPL_TOPIC,
-                           chptr->name, chptr->topic);
+                           chptr->name, ChannelTopic(chptr));
         sendto_one_numeric(source_p, &me, RPL_TOPICWHOTIME, chptr->name,
-                           chptr->topic_info,
+                           ChannelTopicInfo(chptr),
                            chptr->topic_time);
       }
     }
@@ -166,19 +166,19 @@ ms_topic(struct Client *source_p, int parc, char *parv[])
 
   sendto_server(source_p, 0, 0, ":%s TOPIC %s :%s",
                 source_p->id, chptr->name,
-                chptr->topic);
+                ChannelTopic(chptr));
 
   if (!IsClient(source_p))
     sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s TOPIC %s :%s",
                          (IsHidden(source_p) || ConfigServerHide.hide_servers) ? me.name : source_p->name,
-                         chptr->name, chptr->topic);
+                         chptr->name, ChannelTopic(chptr));
 
   else
     sendto_channel_local(NULL, chptr, 0, 0, 0, ":%s!%s@%s TOPIC %s :%s",
                          source_p->name,
                          source_p->username,
                          source_p->host,
-                         chptr->name, chptr->topic);
+                         chptr->name, ChannelTopic(chptr));
   return 0;
 }
 
@@ -52,7 +52,7 @@ do_user(struct Client *source_p,
   source_p->connection->registration &= ~REG_NEED_USER;
   source_p->servptr = &me;  /* Don't take the clients word for it, ever */
 
-  strlcpy(source_p->info, realname, sizeof(source_p->info));
+  client_set_info(source_p, realname);
 
   if (!HasFlag(source_p, FLAGS_GOTID))
     strlcpy(source_p->username, username, sizeof(source_p->username));
@@ -113,8 +113,8 @@ mr_webirc(struct Client *source_p, int parc, char *parv[])
   source_p->connection->aftype = res->ai_family;
   freeaddrinfo(res);
 
-  strlcpy(source_p->sockhost, addr, sizeof(source_p->sockhost));
-  strlcpy(source_p->host, host, sizeof(source_p->host));
+  client_set_sockhost(source_p, addr);
+  client_set_host(source_p, host);
 
   /* Check dlines now, k-lines will be checked on registration */
   if ((conf = find_dline_conf(&source_p->connection->ip,
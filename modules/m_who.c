@@ -38,6 +38,8 @@
 #include "conf.h"
 #include "parse.h"
 #include "modules.h"
+#include "cursor.h"
+#include "memory.h"
 
 
 enum { WHO_MAX_REPLIES = 500 };
@@ -234,37 +236,99 @@ who_global(struct Client *source_p, const char *mask, int server_oper)
   }
 }
 
+/*! \brief State of a WHO reply on a channel that is being sent */
+struct WhoTask
+{
+  unsigned int is_member;
+  unsigned int server_oper;
+  char name[CHANNELLEN + 1];  /**< Channel name reported */
+  char *mask;                 /**< Mask given, for RPL_ENDOFWHO */
+};
+
+/* who_channel_step()
+ *
+ * inputs	- pointer to client requesting who
+ *		- pointer to its cursor, walking the channel's members
+ * output	- 0 once the reply is complete, 1 otherwise
+ * side effects - do a who on the next member of the channel
+ */
+static int
+who_channel_step(struct Client *source_p, struct Cursor *cursor)
+{
+  const struct WhoTask *const wt = cursor->data;
+
+  if (cursor->pos == NULL)
+  {
+    sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, wt->mask);
+    return 0;
+  }
+
+  const struct Membership *member = cursor->pos->data;
+  const struct Client *target_p = member->client_p;
+
+  cursor->pos = cursor->pos->next;
+
+  if (wt->is_member || !HasUMode(target_p, UMODE_INVISIBLE))
+  {
+    if (wt->server_oper)
+      if (!HasUMode(target_p, UMODE_OPER) ||
+          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
+        return 1;
+    do_who(source_p, target_p, wt->name, get_member_status(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
+  }
+
+  return 1;
+}
+
+static void
+who_channel_free(struct Cursor *cursor)
+{
+  struct WhoTask *const wt = cursor->data;
+
+  xfree(wt->mask);
+  xfree(wt);
+}
+
+static size_t
+who_channel_memory(const struct Cursor *cursor)
+{
+  const struct WhoTask *const wt = cursor->data;
+
+  return sizeof(*wt) + strlen(wt->mask) + 1;
+}
+
+static const struct CursorType who_cursor_type =
+{
+  .step = who_channel_step,
+  .free = who_channel_free,
+  .memory = who_channel_memory
+};
+
 /* do_who_on_channel()
  *
  * inputs	- pointer to client requesting who
- *		- pointer to channel to do who on
- *		- The "real name" of this channel
- *		- int if source_p is a server oper or not
+ *		- pointer to channel to do who on, or NULL
+ *		- mask given, for RPL_ENDOFWHO
  *		- int if client is member or not
  *		- int server_op flag
  * output	- NONE
- * side effects - do a who on given channel
+ * side effects - do a who on given channel. The reply goes out through
+ *		  a cursor, so big channels follow as the client reads.
  */
 static void
-do_who_on_channel(struct Client *source_p, struct Channel *chptr,
+do_who_on_channel(struct Client *source_p, struct Channel *chptr, const char *mask,
                   int is_member, int server_oper)
 {
-  dlink_node *node = NULL;
+  struct WhoTask *const wt = xcalloc(sizeof(*wt));
 
-  DLINK_FOREACH(node, chptr->members.head)
-  {
-    struct Membership *member = node->data;
-    struct Client *target_p = member->client_p;
+  wt->is_member = is_member;
+  wt->server_oper = server_oper;
+  wt->mask = xstrdup(mask);
 
-    if (is_member || !HasUMode(target_p, UMODE_INVISIBLE))
-    {
-      if (server_oper)
-        if (!HasUMode(target_p, UMODE_OPER) ||
-            (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-          continue;
-      do_who(source_p, target_p, chptr->name, get_member_status(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
-    }
-  }
+  if (chptr)
+    strlcpy(wt->name, chptr->name, sizeof(wt->name));
+
+  cursor_start(source_p, &who_cursor_type, chptr ? chptr->members.head : NULL, wt);
 }
 
 /*! \brief WHO command handler
@@ -306,12 +370,15 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((chptr = hash_find_channel(mask)))
     {
       if (HasUMode(source_p, UMODE_ADMIN) || IsMember(source_p, chptr))
-        do_who_on_channel(source_p, chptr, 1, server_oper);
+        do_who_on_channel(source_p, chptr, mask, 1, server_oper);
       else if (!SecretChannel(chptr))
-        do_who_on_channel(source_p, chptr, 0, server_oper);
+        do_who_on_channel(source_p, chptr, mask, 0, server_oper);
+      else
+        do_who_on_channel(source_p, NULL, mask, 0, server_oper);
     }
+    else
+      do_who_on_channel(source_p, NULL, mask, 0, server_oper);
 
-    sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
     return 0;
   }
 
@@ -340,12 +407,9 @@ m_who(struct Client *source_p, int parc, char *parv[])
   if (!strcmp(mask, "*"))
   {
     if ((node = source_p->channel.head))
-    {
       chptr = ((struct Membership *)node->data)->chptr;
-      do_who_on_channel(source_p, chptr, 1, server_oper);
-    }
 
-    sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
+    do_who_on_channel(source_p, chptr, "*", 1, server_oper);
     return 0;
   }
 
@@ -381,6 +445,7 @@ static void
 module_exit(void)
 {
   mod_del_cmd(&who_msgtab);
+  cursor_free_type(&who_cursor_type);
 }
 
 struct module module_entry =
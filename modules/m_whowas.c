@@ -38,58 +38,109 @@
 #include "conf.h"
 #include "parse.h"
 #include "modules.h"
+#include "cursor.h"
+#include "memory.h"
 
 
 enum { WHOWAS_MAX_REPLIES = 20 };  /* Only applies to remote clients */
 
-static void
-do_whowas(struct Client *source_p, const int parc, char *parv[])
+/*! \brief State of a WHOWAS reply that is being sent */
+struct WhowasTask
 {
-  int cur = 0;
-  int max = -1;
-  dlink_node *node;
-
-  if (parc > 2 && !EmptyString(parv[2]))
-    max = atoi(parv[2]);
+  int cur;     /**< Entries sent so far */
+  int max;     /**< Entries to send at most, or -1 */
+  char *name;  /**< Nick asked for */
+};
 
-  if (!MyConnect(source_p) && (max <= 0 || max > WHOWAS_MAX_REPLIES))
-    max = WHOWAS_MAX_REPLIES;
+/* whowas_step()
+ *
+ * inputs	- pointer to client requesting whowas
+ *		- pointer to its cursor, walking a whowas hash bucket
+ * output	- 0 once the reply is complete, 1 otherwise
+ * side effects - the next entry of the nick is sent
+ */
+static int
+whowas_step(struct Client *source_p, struct Cursor *cursor)
+{
+  struct WhowasTask *const wt = cursor->data;
 
-  DLINK_FOREACH(node, whowas_get_hash(strhash(parv[1]))->head)
+  if (cursor->pos == NULL || (wt->max > 0 && wt->cur >= wt->max))
   {
-    const struct Whowas *whowas = node->data;
-
-    if (!irccmp(parv[1], whowas->name))
-    {
-      sendto_one_numeric(source_p, &me, RPL_WHOWASUSER, whowas->name,
-                         whowas->username, whowas->hostname,
-                         whowas->realname);
-
-      if (HasUMode(source_p, UMODE_OPER))
-        sendto_one_numeric(source_p, &me, RPL_WHOISACTUALLY, whowas->name,
-                           whowas->username, whowas->hostname,
-                           whowas->sockhost);
-
-      if (strcmp(whowas->account, "*"))
-        sendto_one_numeric(source_p, &me, RPL_WHOISACCOUNT, whowas->name, whowas->account, "was");
-
-      if ((whowas->shide || ConfigServerHide.hide_servers) && !HasUMode(source_p, UMODE_OPER))
-        sendto_one_numeric(source_p, &me, RPL_WHOISSERVER, whowas->name,
-                           ConfigServerInfo.network_name, date_ctime(whowas->logoff));
-      else
-        sendto_one_numeric(source_p, &me, RPL_WHOISSERVER, whowas->name,
-                           whowas->servername, date_ctime(whowas->logoff));
-      ++cur;
-    }
-
-    if (max > 0 && cur >= max)
-      break;
+    if (!wt->cur)
+      sendto_one_numeric(source_p, &me, ERR_WASNOSUCHNICK, wt->name);
+
+    sendto_one_numeric(source_p, &me, RPL_ENDOFWHOWAS, wt->name);
+    return 0;
   }
 
-  if (!cur)
-    sendto_one_numeric(source_p, &me, ERR_WASNOSUCHNICK, parv[1]);
+  const struct Whowas *whowas = cursor->pos->data;
+
+  cursor->pos = cursor->pos->next;
+
+  if (irccmp(wt->name, whowas->name))
+    return 1;
+
+  sendto_one_numeric(source_p, &me, RPL_WHOWASUSER, whowas->name,
+                     WhowasUser(whowas), whowas->hostname,
+                     whowas->realname);
+
+  if (HasUMode(source_p, UMODE_OPER))
+    sendto_one_numeric(source_p, &me, RPL_WHOISACTUALLY, whowas->name,
+                       WhowasUser(whowas), whowas->hostname,
+                       WhowasSockhost(whowas));
+
+  if (strcmp(WhowasAccount(whowas), "*"))
+    sendto_one_numeric(source_p, &me, RPL_WHOISACCOUNT, whowas->name, WhowasAccount(whowas), "was");
+
+  if ((whowas->shide || ConfigServerHide.hide_servers) && !HasUMode(source_p, UMODE_OPER))
+    sendto_one_numeric(source_p, &me, RPL_WHOISSERVER, whowas->name,
+                       ConfigServerInfo.network_name, date_ctime(whowas->logoff));
+  else
+    sendto_one_numeric(source_p, &me, RPL_WHOISSERVER, whowas->name,
+                       whowas->servername, date_ctime(whowas->logoff));
+  ++wt->cur;
+  return 1;
+}
+
+static void
+whowas_task_free(struct Cursor *cursor)
+{
+  struct WhowasTask *const wt = cursor->data;
+
+  xfree(wt->name);
+  xfree(wt);
+}
+
+static size_t
+whowas_task_memory(const struct Cursor *cursor)
+{
+  const struct WhowasTask *const wt = cursor->data;
+
+  return sizeof(*wt) + strlen(wt->name) + 1;
+}
+
+static const struct CursorType whowas_cursor_type =
+{
+  .step = whowas_step,
+  .free = whowas_task_free,
+  .memory = whowas_task_memory
+};
+
+static void
+do_whowas(struct Client *source_p, const int parc, char *parv[])
+{
+  struct WhowasTask *const wt = xcalloc(sizeof(*wt));
+
+  wt->max = -1;
+  wt->name = xstrdup(parv[1]);
+
+  if (parc > 2 && !EmptyString(parv[2]))
+    wt->max = atoi(parv[2]);
+
+  if (!MyConnect(source_p) && (wt->max <= 0 || wt->max > WHOWAS_MAX_REPLIES))
+    wt->max = WHOWAS_MAX_REPLIES;
 
-  sendto_one_numeric(source_p, &me, RPL_ENDOFWHOWAS, parv[1]);
+  cursor_start(source_p, &whowas_cursor_type, whowas_get_hash(strhash(parv[1]))->head, wt);
 }
 
 /*! \brief WHOWAS command handler
@@ -182,6 +233,7 @@ static void
 module_exit(void)
 {
   mod_del_cmd(&whowas_msgtab);
+  cursor_free_type(&whowas_cursor_type);
 }
 
 struct module module_entry =
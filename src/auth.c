@@ -51,6 +51,8 @@
 #include "log.h"
 #include "send.h"
 #include "mempool.h"
+#include "ipcache.h"
+#include "misc.h"
 
 
 enum
@@ -61,6 +63,7 @@ enum
   REPORT_DO_ID,
   REPORT_FIN_ID,
   REPORT_FAIL_ID,
+  REPORT_SKIP_ID,
   REPORT_IP_MISMATCH,
   REPORT_HOST_TOOLONG
 };
@@ -73,6 +76,7 @@ static const char *const HeaderMessages[] =
   [REPORT_DO_ID] = ":*** Checking Ident",
   [REPORT_FIN_ID] = ":*** Got Ident response",
   [REPORT_FAIL_ID] = ":*** No Ident response",
+  [REPORT_SKIP_ID] = ":*** Skipping Ident check",
   [REPORT_IP_MISMATCH] = ":*** Your forward and reverse DNS do not match, ignoring hostname",
   [REPORT_HOST_TOOLONG] = ":*** Your hostname is too long, ignoring hostname"
 };
@@ -80,20 +84,146 @@ static const char *const HeaderMessages[] =
 #define sendheader(c, i) sendto_one_notice((c), &me, "%s", HeaderMessages[(i)])
 
 static dlink_list auth_list;
+static mp_pool_t *auth_pool;
+static struct ident_cache ident_cache[IDENT_CACHE_SIZE];
+static struct ident_stats ident_stats;
 static void read_auth_reply(fde_t *, void *);
+static void auth_read_timeout(fde_t *, void *);
 static void auth_connect_callback(fde_t *, int, void *);
 
 
+static uintmax_t
+auth_time_ms(void)
+{
+  return SystemTime.tv_sec * 1000 + SystemTime.tv_usec / 1000;
+}
+
+/*
+ * ident_cache_find - find the cache slot of an address prefix, or claim
+ * one if asked to. Expired slots are reused; if the probe window is
+ * full, the slot expiring first is sacrificed.
+ */
+static struct ident_cache *
+ident_cache_find(uint64_t key, int claim)
+{
+  struct ident_cache *victim = NULL;
+
+  for (unsigned int i = 0; i < IDENT_CACHE_PROBE; ++i)
+  {
+    struct ident_cache *const slot = &ident_cache[(key + i) & (IDENT_CACHE_SIZE - 1)];
+
+    if (slot->key == key)
+    {
+      if (slot->expires > CurrentTime)
+        return slot;
+
+      victim = slot;
+      break;
+    }
+
+    if (victim == NULL || slot->expires < victim->expires)
+      victim = slot;
+  }
+
+  if (!claim)
+    return NULL;
+
+  victim->key = key;
+  victim->answered = victim->failed = 0;
+  return victim;
+}
+
+/*
+ * ident_cache_skip - whether ident is known to be unavailable from
+ * the client's address or network
+ */
+static int
+ident_cache_skip(const struct irc_ssaddr *addr)
+{
+  const struct ident_cache *slot;
+
+  if ((slot = ident_cache_find(ipcache_prefix_key(addr, 32, 128), 0)) && slot->answered == 0)
+    return 1;
+
+  if ((slot = ident_cache_find(ipcache_prefix_key(addr, 24, 64), 0)) &&
+      slot->answered == 0 && slot->failed >= IDENT_NETWORK_FAILS)
+    return 1;
+
+  return 0;
+}
+
+/*
+ * ident_cache_add - remember the outcome of an ident query and adapt
+ * the timeout to the observed round-trip times
+ */
+static void
+ident_cache_add(struct AuthRequest *auth, enum ident_result result)
+{
+  const struct irc_ssaddr *const addr = &auth->client->connection->ip;
+  const uint64_t key[] = { ipcache_prefix_key(addr, 32, 128), ipcache_prefix_key(addr, 24, 64) };
+
+  ++ident_stats.result[result];
+
+  for (unsigned int i = 0; i < sizeof(key) / sizeof(key[0]); ++i)
+  {
+    struct ident_cache *const slot = ident_cache_find(key[i], 1);
+
+    slot->expires = CurrentTime + IDENT_CACHE_TIME;
+
+    if (result == IDENT_ANSWERED)
+      slot->answered = IRCD_MIN(slot->answered + 1, USHRT_MAX);
+    else
+      slot->failed = IRCD_MIN(slot->failed + 1, USHRT_MAX);
+  }
+
+  if (result == IDENT_ANSWERED)
+  {
+    const uintmax_t rtt = auth_time_ms() - auth->ident_start;
+
+    /* Same smoothing as the TCP retransmission timer */
+    if (ident_stats.rtt == 0)
+      ident_stats.rtt = IRCD_MAX(rtt, 1);
+    else
+      ident_stats.rtt = (ident_stats.rtt * 7 + rtt) / 8;
+  }
+}
+
+/*
+ * ident_timeout - time an ident query gets: four times the smoothed
+ * round-trip time, bounded by IDENT_TIMEOUT_MIN and SET IDENTTIMEOUT
+ */
+static unsigned int
+ident_timeout(void)
+{
+  unsigned int timeout = GlobalSetOptions.ident_timeout;
+
+  if (ident_stats.rtt)
+    timeout = IRCD_MIN(timeout, IRCD_MAX((ident_stats.rtt * 4 + 999) / 1000, IDENT_TIMEOUT_MIN));
+
+  return timeout;
+}
+
+/*
+ * auth_get_ident_stats - counters for STATS t
+ */
+const struct ident_stats *
+auth_get_ident_stats(void)
+{
+  ident_stats.timeout = ident_timeout();
+  return &ident_stats;
+}
+
+
 /*
- * make_auth_request - allocate a new auth request
+ * make_auth_request - allocate a new auth request. It is freed again
+ * by delete_auth() once the lookups are done.
  */
 static struct AuthRequest *
 make_auth_request(struct Client *client)
 {
-  struct AuthRequest *const auth = &client->connection->auth;
-
-  memset(auth, 0, sizeof(*auth));
+  struct AuthRequest *const auth = mp_pool_get(auth_pool);
 
+  client->connection->auth = auth;
   auth->client = client;
   auth->timeout = CurrentTime + CONNECTTIMEOUT;
 
@@ -113,11 +243,7 @@ release_auth_client(struct AuthRequest *auth)
   if (IsDoingAuth(auth) || IsDNSPending(auth))
     return;
 
-  if (IsInAuth(auth))
-  {
-    dlinkDelete(&auth->node, &auth_list);
-    ClearInAuth(auth);
-  }
+  delete_auth(auth);
 
   /*
    * When a client has auth'ed, we want to start reading what it sends
@@ -180,7 +306,7 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
       sendheader(auth->client, REPORT_HOST_TOOLONG);
     else
     {
-      strlcpy(auth->client->host, name, sizeof(auth->client->host));
+      client_set_host(auth->client, name);
       sendheader(auth->client, REPORT_FIN_DNS);
     }
   }
@@ -194,10 +320,13 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
  * authsenderr - handle auth send errors
  */
 static void
-auth_error(struct AuthRequest *auth)
+auth_error(struct AuthRequest *auth, enum ident_result result)
 {
   ++ServerStats.is_abad;
 
+  if (result != IDENT_RESULT_COUNT)
+    ident_cache_add(auth, result);
+
   fd_close(&auth->fd);
 
   ClearAuth(auth);
@@ -221,6 +350,14 @@ start_auth_query(struct AuthRequest *auth)
   struct irc_ssaddr localaddr;
   socklen_t locallen = sizeof(struct irc_ssaddr);
   struct sockaddr_in6 *v6;
+  const unsigned int timeout = ident_timeout();
+
+  if (ident_cache_skip(&auth->client->connection->ip))
+  {
+    ++ident_stats.skipped;
+    sendheader(auth->client, REPORT_SKIP_ID);
+    return;
+  }
 
   /* open a socket of the same type as the client socket */
   if (comm_open(&auth->fd, auth->client->connection->ip.ss.ss_family,
@@ -248,10 +385,12 @@ start_auth_query(struct AuthRequest *auth)
   v6->sin6_port = htons(0);
   localaddr.ss_port = htons(0);
 
+  auth->ident_start = auth_time_ms();
+  auth->ident_timeout = CurrentTime + timeout;
+
   comm_connect_tcp(&auth->fd, auth->client->sockhost, RFC1413_PORT,
       (struct sockaddr *)&localaddr, localaddr.ss_len, auth_connect_callback,
-      auth, auth->client->connection->ip.ss.ss_family,
-      GlobalSetOptions.ident_timeout);
+      auth, auth->client->connection->ip.ss.ss_family, timeout);
 }
 
 /*
@@ -298,6 +437,7 @@ timeout_auth_queries_event(void *notused)
     if (IsDoingAuth(auth))
     {
       ++ServerStats.is_abad;
+      ident_cache_add(auth, IDENT_TIMEDOUT);
       fd_close(&auth->fd);
       ClearAuth(auth);
       sendheader(auth->client, REPORT_FAIL_ID);
@@ -340,7 +480,12 @@ auth_connect_callback(fde_t *fd, int error, void *data)
 
   if (error != COMM_OK)
   {
-    auth_error(auth);
+    if (error == COMM_ERR_TIMEOUT)
+      auth_error(auth, IDENT_TIMEDOUT);
+    else if (error == COMM_ERR_CONNECT)
+      auth_error(auth, IDENT_REFUSED);
+    else
+      auth_error(auth, IDENT_RESULT_COUNT);
     return;
   }
 
@@ -349,7 +494,7 @@ auth_connect_callback(fde_t *fd, int error, void *data)
   {
     report_error(L_ALL, "auth get{sock,peer}name error %s:%s",
                  get_client_name(auth->client, SHOW_IP), errno);
-    auth_error(auth);
+    auth_error(auth, IDENT_RESULT_COUNT);
     return;
   }
 
@@ -362,13 +507,26 @@ auth_connect_callback(fde_t *fd, int error, void *data)
 
   if (send(fd->fd, authbuf, len, 0) != len)
   {
-    auth_error(auth);
+    auth_error(auth, IDENT_REFUSED);
     return;
   }
 
+  /* Whatever is left of the ident timeout applies to the reply as well */
+  comm_settimeout(fd, (IRCD_MAX(auth->ident_timeout, CurrentTime + 1) - CurrentTime) * 1000,
+                  auth_read_timeout, auth);
   comm_setselect(fd, COMM_SELECT_READ, read_auth_reply, auth, 0);
 }
 
+/*
+ * auth_read_timeout - the ident server accepted the connection but
+ * didn't reply in time
+ */
+static void
+auth_read_timeout(fde_t *fd, void *data)
+{
+  auth_error(data, IDENT_TIMEDOUT);
+}
+
 /** Enum used to index ident reply fields in a human-readable way. */
 enum IdentReplyFields
 {
@@ -477,7 +635,10 @@ read_auth_reply(fde_t *fd, void *data)
   {
     buf[len] = '\0';
     username = check_ident_reply(buf);
+    ident_cache_add(auth, IDENT_ANSWERED);
   }
+  else
+    ident_cache_add(auth, IDENT_REFUSED);
 
   fd_close(fd);
 
@@ -500,7 +661,8 @@ read_auth_reply(fde_t *fd, void *data)
 }
 
 /*
- * delete_auth()
+ * delete_auth() - cancel whatever lookups are still in progress and
+ * free the auth request
  */
 void
 delete_auth(struct AuthRequest *auth)
@@ -516,6 +678,9 @@ delete_auth(struct AuthRequest *auth)
     dlinkDelete(&auth->node, &auth_list);
     ClearInAuth(auth);
   }
+
+  auth->client->connection->auth = NULL;
+  mp_pool_release(auth);
 }
 
 /* auth_init
@@ -532,5 +697,6 @@ auth_init(void)
     .when = 1
   };
 
+  auth_pool = mp_pool_new("auth", sizeof(struct AuthRequest), MP_CHUNK_SIZE_AUTH);
   event_add(&timeout_auth_queries, NULL);
 }
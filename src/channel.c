@@ -41,14 +41,21 @@
 #include "event.h"
 #include "memory.h"
 #include "mempool.h"
+#include "intern.h"
 #include "misc.h"
+#include "cursor.h"
 
 
 dlink_list channel_list;
-mp_pool_t *ban_pool;    /*! \todo ban_pool shouldn't be a global var */
-
+dlink_list channel_size_list[CHANNEL_SIZE_BUCKETS];
+static dlink_list channel_size_pending;  /* Channels waiting to change buckets */
+static unsigned int channel_size_holds;
 static mp_pool_t *member_pool, *channel_pool, *invite_pool;
 
+/* Topics come in these sizes; the largest must hold a full one */
+static const size_t topic_size[] = { 64, 128, 256, 512 };
+static mp_pool_t *topic_pool[sizeof(topic_size) / sizeof(topic_size[0])];
+
 
 /*! \brief Initializes the channel blockheap, adds known channel CAPAB
  */
@@ -58,10 +65,112 @@ channel_init(void)
   add_capability("EX", CAPAB_EX);
   add_capability("IE", CAPAB_IE);
 
-  invite_pool = mp_pool_new(sizeof(struct Invite), MP_CHUNK_SIZE_INVITE);
-  channel_pool = mp_pool_new(sizeof(struct Channel), MP_CHUNK_SIZE_CHANNEL);
-  ban_pool = mp_pool_new(sizeof(struct Ban), MP_CHUNK_SIZE_BAN);
-  member_pool = mp_pool_new(sizeof(struct Membership), MP_CHUNK_SIZE_MEMBER);
+  invite_pool = mp_pool_new("invite", sizeof(struct Invite), MP_CHUNK_SIZE_INVITE);
+  channel_pool = mp_pool_new("channel", sizeof(struct Channel), MP_CHUNK_SIZE_CHANNEL);
+  member_pool = mp_pool_new("member", sizeof(struct Membership), MP_CHUNK_SIZE_MEMBER);
+
+  for (unsigned int i = 0; i < sizeof(topic_size) / sizeof(topic_size[0]); ++i)
+    topic_pool[i] = mp_pool_new("topic", topic_size[i], MP_CHUNK_SIZE_TOPIC);
+}
+
+/*! \brief Allocates memory for channels about to be created in one go
+ * \param channels Number of channels
+ * \param members  Number of channel members
+ */
+void
+channel_reserve(unsigned int channels, unsigned int members)
+{
+  mp_pool_reserve(channel_pool, channels);
+  mp_pool_reserve(member_pool, members);
+}
+
+/*! \brief Index into channel_size_list for a member count
+ * \param members Number of channel members
+ * \return Number of significant bits of \a members
+ */
+unsigned int
+channel_size_bucket(unsigned int members)
+{
+  unsigned int bucket = 0;
+
+  for (; members; members >>= 1)
+    ++bucket;
+
+  return bucket;
+}
+
+/*! \brief Moves a channel to the channel_size_list bucket of its
+ *         member count, if it isn't in it already
+ * \param chptr Pointer to channel
+ * \note While a LIST walks channel_size_list, a channel moving to a
+ *       bucket that LIST has passed, or hasn't reached yet, would be
+ *       skipped or listed twice. The move is therefore put off until
+ *       channel_size_release() while any holds are in effect.
+ */
+static void
+channel_size_update(struct Channel *chptr)
+{
+  const unsigned int bucket = channel_size_bucket(dlink_list_length(&chptr->members));
+
+  if (bucket == chptr->size_bucket)
+    return;
+
+  if (channel_size_holds)
+  {
+    if (!IsSizeMovePending(chptr))
+    {
+      SetSizeMovePending(chptr);
+      dlinkAdd(chptr, &chptr->size_pending_node, &channel_size_pending);
+    }
+
+    return;
+  }
+
+  dlinkDelete(&chptr->size_node, &channel_size_list[chptr->size_bucket]);
+  dlinkAdd(chptr, &chptr->size_node, &channel_size_list[bucket]);
+  chptr->size_bucket = bucket;
+}
+
+/*! \brief Keeps channels in their channel_size_list buckets until
+ *         the matching channel_size_release()
+ */
+void
+channel_size_hold(void)
+{
+  ++channel_size_holds;
+}
+
+/*! \brief Ends a channel_size_hold(); after the last one, the channels
+ *         that were put off are moved to their buckets
+ */
+void
+channel_size_release(void)
+{
+  dlink_node *node, *node_next;
+
+  assert(channel_size_holds);
+
+  if (--channel_size_holds)
+    return;
+
+  DLINK_FOREACH_SAFE(node, node_next, channel_size_pending.head)
+  {
+    struct Channel *chptr = node->data;
+
+    dlinkDelete(node, &channel_size_pending);
+    ClearSizeMovePending(chptr);
+    channel_size_update(chptr);
+  }
+}
+
+/*! \brief Tells whether channels are waiting to change buckets
+ * \return 1 if some channels may be in the wrong channel_size_list
+ *         bucket, 0 otherwise
+ */
+int
+channel_size_stale(void)
+{
+  return dlink_list_length(&channel_size_pending) != 0;
 }
 
 /*! \brief Adds a user to a channel by adding another link to the
@@ -119,6 +228,8 @@ add_user_to_channel(struct Channel *chptr, struct Client *client_p,
     dlinkAdd(member, &member->locchannode, &chptr->locmembers);
 
   dlinkAdd(member, &member->usernode, &client_p->channel);
+
+  channel_size_update(chptr);
 }
 
 /*! \brief Deletes an user from a channel by removing a link in the
@@ -131,6 +242,7 @@ remove_user_from_channel(struct Membership *member)
   struct Client *const client_p = member->client_p;
   struct Channel *const chptr = member->chptr;
 
+  cursor_unlink(&member->channode);
   dlinkDelete(&member->channode, &chptr->members);
 
   if (MyConnect(client_p))
@@ -142,6 +254,8 @@ remove_user_from_channel(struct Membership *member)
 
   if (chptr->members.head == NULL)
     channel_free(chptr);
+  else
+    channel_size_update(chptr);
 }
 
 /* channel_send_members()
@@ -183,7 +297,7 @@ channel_send_members(struct Client *client_p, const struct Channel *chptr,
     if (t + tlen - buf > IRCD_BUFSIZE - 1)
     {
       *(t - 1) = '\0';  /* Kill the space and terminate the string */
-      sendto_one(client_p, "%s", buf);
+      sendto_burst(client_p, "%s", buf);
       t = start;
     }
 
@@ -204,7 +318,7 @@ channel_send_members(struct Client *client_p, const struct Channel *chptr,
   if (chptr->members.head)
     t--;  /* Take the space out */
   *t = '\0';
-  sendto_one(client_p, "%s", buf);
+  sendto_burst(client_p, "%s", buf);
 }
 
 /*! \brief Sends +b/+e/+I
@@ -242,21 +356,22 @@ channel_send_mask_list(struct Client *client_p, const struct Channel *chptr,
     if (cur_len + (tlen - 1) > IRCD_BUFSIZE - 2)
     {
       *(pp - 1) = '\0';  /* Get rid of trailing space on buffer */
-      sendto_one(client_p, "%s%s", mbuf, pbuf);
+      sendto_burst(client_p, "%s%s", mbuf, pbuf);
 
       cur_len = mlen;
       pp = pbuf;
     }
 
-    pp += sprintf(pp, "%s!%s@%s ", ban->name, ban->user, ban->host);
+    pp += sprintf(pp, "%s!%s@%s ", BanName(ban), BanUser(ban), BanHost(ban));
     cur_len += tlen;
   }
 
   *(pp - 1) = '\0';  /* Get rid of trailing space on buffer */
-  sendto_one(client_p, "%s%s", mbuf, pbuf);
+  sendto_burst(client_p, "%s%s", mbuf, pbuf);
 }
 
 /*! \brief Send "client_p" a full list of the modes for channel chptr
+ *        as part of a burst
  * \param client_p Pointer to client client_p
  * \param chptr    Pointer to channel pointer
  */
@@ -309,7 +424,8 @@ void
 remove_ban(struct Ban *ban, dlink_list *list)
 {
   dlinkDelete(&ban->node, list);
-  mp_pool_release(ban);
+  intern_release(ban->who);
+  xfree(ban);
 }
 
 /* channel_free_mask_list()
@@ -348,6 +464,7 @@ channel_make(const char *name)
     chptr->name_len = sizeof(chptr->name) - 1;
 
   dlinkAdd(chptr, &chptr->node, &channel_list);
+  dlinkAdd(chptr, &chptr->size_node, &channel_size_list[0]);
   hash_add_channel(chptr);
 
   return chptr;
@@ -366,7 +483,18 @@ channel_free(struct Channel *chptr)
   channel_free_mask_list(&chptr->exceptlist);
   channel_free_mask_list(&chptr->invexlist);
 
+  if (chptr->topic)
+  {
+    intern_release(chptr->topic->info);
+    mp_pool_release(chptr->topic);
+  }
+
+  server_burst_unlink(&chptr->node);
   dlinkDelete(&chptr->node, &channel_list);
+  cursor_unlink(&chptr->size_node);
+  dlinkDelete(&chptr->size_node, &channel_size_list[chptr->size_bucket]);
+  if (IsSizeMovePending(chptr))
+    dlinkDelete(&chptr->size_pending_node, &channel_size_pending);
   hash_del_channel(chptr);
 
   mp_pool_release(chptr);
@@ -386,86 +514,135 @@ channel_pub_or_secret(const struct Channel *chptr)
   return "=";
 }
 
-/*! \brief lists all names on given channel
+/*! \brief State of a NAMES reply that is being sent */
+struct NamesTask
+{
+  const char *type;           /**< See channel_pub_or_secret() */
+  unsigned int is_member;
+  unsigned int multi_prefix;
+  unsigned int uhnames;
+  unsigned int show_eon;
+  char name[CHANNELLEN + 1];
+};
+
+/*! \brief Sends the next RPL_NAMREPLY line of a NAMES reply
  * \param client_p Pointer to client struct requesting names
- * \param chptr    Pointer to channel block
- * \param show_eon Show RPL_ENDOFNAMES numeric or not
- *                 (don't want it with /names with no params)
+ * \param cursor   Pointer to its cursor, walking the channel's members
+ * \return 0 once the reply is complete, 1 otherwise
  */
-void
-channel_member_names(struct Client *client_p, struct Channel *chptr,
-                     int show_eon)
+static int
+channel_names_step(struct Client *client_p, struct Cursor *cursor)
 {
-  dlink_node *node;
+  const struct NamesTask *const nt = cursor->data;
   char buf[IRCD_BUFSIZE + 1] = "";
   char *t = NULL, *start = NULL;
   int tlen = 0;
-  const int is_member = IsMember(client_p, chptr);
-  const int multi_prefix = HasCap(client_p, CAP_MULTI_PREFIX) != 0;
-  const int uhnames = HasCap(client_p, CAP_UHNAMES) != 0;
 
-  assert(IsClient(client_p));
+  t = buf + snprintf(buf, sizeof(buf), numeric_form(RPL_NAMREPLY),
+                     me.name, client_p->name, nt->type, nt->name);
+  start = t;
 
-  if (PubChannel(chptr) || is_member)
+  for (; cursor->pos; cursor->pos = cursor->pos->next)
   {
-    t = buf + snprintf(buf, sizeof(buf), numeric_form(RPL_NAMREPLY),
-                       me.name, client_p->name,
-                       channel_pub_or_secret(chptr), chptr->name);
-    start = t;
+    const struct Membership *member = cursor->pos->data;
 
-    DLINK_FOREACH(node, chptr->members.head)
+    if (HasUMode(member->client_p, UMODE_INVISIBLE) && !nt->is_member)
+      continue;
+
+    if (!nt->uhnames)
+      tlen = strlen(member->client_p->name) + 1;  /* +1 for space */
+    else
+      tlen = strlen(member->client_p->name) + strlen(member->client_p->username) +
+             strlen(member->client_p->host) + 3;  /* +3 for ! + @ + space */
+
+    if (!nt->multi_prefix)
     {
-      const struct Membership *member = node->data;
+      if (member->flags & (CHFL_CHANOP | CHFL_HALFOP | CHFL_VOICE))
+        ++tlen;
+    }
+    else
+    {
+      if (member->flags & CHFL_CHANOP)
+        ++tlen;
+      if (member->flags & CHFL_HALFOP)
+        ++tlen;
+      if (member->flags & CHFL_VOICE)
+        ++tlen;
+    }
 
-      if (HasUMode(member->client_p, UMODE_INVISIBLE) && !is_member)
-        continue;
+    if (t + tlen - buf > IRCD_BUFSIZE - 2)
+      break;
 
-      if (!uhnames)
-        tlen = strlen(member->client_p->name) + 1;  /* +1 for space */
-      else
-        tlen = strlen(member->client_p->name) + strlen(member->client_p->username) +
-               strlen(member->client_p->host) + 3;  /* +3 for ! + @ + space */
+    if (!nt->uhnames)
+      t += sprintf(t, "%s%s ", get_member_status(member, nt->multi_prefix),
+                   member->client_p->name);
+    else
+      t += sprintf(t, "%s%s!%s@%s ", get_member_status(member, nt->multi_prefix),
+                   member->client_p->name, member->client_p->username,
+                   member->client_p->host);
+  }
 
-      if (!multi_prefix)
-      {
-        if (member->flags & (CHFL_CHANOP | CHFL_HALFOP | CHFL_VOICE))
-          ++tlen;
-      }
-      else
-      {
-        if (member->flags & CHFL_CHANOP)
-          ++tlen;
-        if (member->flags & CHFL_HALFOP)
-          ++tlen;
-        if (member->flags & CHFL_VOICE)
-          ++tlen;
-      }
+  if (t != start)
+  {
+    *(t - 1) = '\0';
+    sendto_one(client_p, "%s", buf);
+    return 1;
+  }
 
-      if (t + tlen - buf > IRCD_BUFSIZE - 2)
-      {
-        *(t - 1) = '\0';
-        sendto_one(client_p, "%s", buf);
-        t = start;
-      }
+  if (nt->show_eon)
+    sendto_one_numeric(client_p, &me, RPL_ENDOFNAMES, nt->name);
+  return 0;
+}
 
-      if (!uhnames)
-        t += sprintf(t, "%s%s ", get_member_status(member, multi_prefix),
-                     member->client_p->name);
-      else
-        t += sprintf(t, "%s%s!%s@%s ", get_member_status(member, multi_prefix),
-                     member->client_p->name, member->client_p->username,
-                     member->client_p->host);
-    }
+static void
+channel_names_free(struct Cursor *cursor)
+{
+  xfree(cursor->data);
+}
 
-    if (tlen)
-    {
-      *(t - 1) = '\0';
-      sendto_one(client_p, "%s", buf);
-    }
-  }
+static size_t
+channel_names_memory(const struct Cursor *cursor)
+{
+  return sizeof(struct NamesTask);
+}
 
-  if (show_eon)
-    sendto_one_numeric(client_p, &me, RPL_ENDOFNAMES, chptr->name);
+static const struct CursorType names_cursor_type =
+{
+  .step = channel_names_step,
+  .free = channel_names_free,
+  .memory = channel_names_memory
+};
+
+/*! \brief lists all names on given channel
+ * \param client_p Pointer to client struct requesting names
+ * \param chptr    Pointer to channel block
+ * \param show_eon Show RPL_ENDOFNAMES numeric or not
+ *                 (don't want it with /names with no params)
+ *
+ * The reply goes out through a cursor, so the names of a big channel
+ * follow as the client reads them. Members who leave in the meantime
+ * are skipped; those who join later were announced by their JOIN.
+ */
+void
+channel_member_names(struct Client *client_p, struct Channel *chptr,
+                     int show_eon)
+{
+  struct NamesTask *const nt = xcalloc(sizeof(*nt));
+  dlink_node *first = NULL;
+
+  assert(IsClient(client_p));
+
+  nt->type = channel_pub_or_secret(chptr);
+  nt->is_member = IsMember(client_p, chptr);
+  nt->multi_prefix = HasCap(client_p, CAP_MULTI_PREFIX) != 0;
+  nt->uhnames = HasCap(client_p, CAP_UHNAMES) != 0;
+  nt->show_eon = show_eon;
+  strlcpy(nt->name, chptr->name, sizeof(nt->name));
+
+  if (PubChannel(chptr) || nt->is_member)
+    first = chptr->members.head;
+
+  cursor_start(client_p, &names_cursor_type, first, nt);
 }
 
 static struct Invite *
@@ -599,22 +776,22 @@ find_bmask(const struct Client *client_p, const dlink_list *list)
   {
     const struct Ban *ban = node->data;
 
-    if (!match(ban->name, client_p->name) && !match(ban->user, client_p->username))
+    if (!match(BanName(ban), client_p->name) && !match(BanUser(ban), client_p->username))
     {
       switch (ban->type)
       {
         case HM_HOST:
-          if (!match(ban->host, client_p->host) || !match(ban->host, client_p->sockhost))
+          if (!match(BanHost(ban), client_p->host) || !match(BanHost(ban), client_p->sockhost))
             return 1;
           break;
         case HM_IPV4:
           if (client_p->connection->aftype == AF_INET)
-            if (match_ipv4(&client_p->connection->ip, &ban->addr, ban->bits))
+            if (match_ipv4(&client_p->connection->ip, BanAddr(ban), ban->bits))
               return 1;
           break;
         case HM_IPV6:
           if (client_p->connection->aftype == AF_INET6)
-            if (match_ipv6(&client_p->connection->ip, &ban->addr, ban->bits))
+            if (match_ipv6(&client_p->connection->ip, BanAddr(ban), ban->bits))
               return 1;
           break;
         default:
@@ -885,13 +1062,38 @@ void
 channel_set_topic(struct Channel *chptr, const char *topic,
                   const char *topic_info, uintmax_t topicts, int local)
 {
+  char info[NICKLEN + USERLEN + HOSTLEN + 3];
+  size_t topic_max = TOPICLEN, size;
+  unsigned int size_class = 0;
+
   if (local)
-    strlcpy(chptr->topic, topic, IRCD_MIN(sizeof(chptr->topic), ConfigServerInfo.max_topic_length + 1));
-  else
-    strlcpy(chptr->topic, topic, sizeof(chptr->topic));
+    topic_max = IRCD_MIN(topic_max, ConfigServerInfo.max_topic_length);
+
+  const size_t topic_len = IRCD_MIN(strlen(topic), topic_max);
+  strlcpy(info, topic_info, sizeof(info));
+
+  if (chptr->topic)
+  {
+    intern_release(chptr->topic->info);
+    mp_pool_release(chptr->topic);
+    chptr->topic = NULL;
+  }
 
-  strlcpy(chptr->topic_info, topic_info, sizeof(chptr->topic_info));
   chptr->topic_time = topicts;
+
+  if (topic_len == 0 && info[0] == '\0')
+    return;
+
+  size = sizeof(struct Topic) + topic_len + 1;
+  while (topic_size[size_class] < size)
+    ++size_class;
+
+  struct Topic *const tp = mp_pool_get(topic_pool[size_class]);
+  tp->info = intern_get(info);
+  memcpy(tp->text, topic, topic_len);
+  tp->text[topic_len] = '\0';
+
+  chptr->topic = tp;
 }
 
 /* do_join_0()
@@ -1094,11 +1296,11 @@ channel_do_join(struct Client *client_p, char *channel, char *key_list)
     if (invite)
       del_invite(invite);
 
-    if (chptr->topic[0])
+    if (ChannelTopic(chptr)[0])
     {
-      sendto_one_numeric(client_p, &me, RPL_TOPIC, chptr->name, chptr->topic);
+      sendto_one_numeric(client_p, &me, RPL_TOPIC, chptr->name, ChannelTopic(chptr));
       sendto_one_numeric(client_p, &me, RPL_TOPICWHOTIME, chptr->name,
-                         chptr->topic_info, chptr->topic_time);
+                         ChannelTopicInfo(chptr), chptr->topic_time);
     }
 
     channel_member_names(client_p, chptr, 1);
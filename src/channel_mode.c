@@ -38,6 +38,7 @@
 #include "send.h"
 #include "memory.h"
 #include "mempool.h"
+#include "intern.h"
 #include "parse.h"
 
 /* 10 is a magic number in hybrid 6 NFI where it comes from -db */
@@ -51,7 +52,6 @@ static struct ChModeChange mode_changes[IRCD_BUFSIZE];
 static unsigned int mode_count;
 static unsigned int mode_limit;  /* number of modes set other than simple */
 static unsigned int simple_modes_mask;  /* bit mask of simple modes already set */
-extern mp_pool_t *ban_pool;
 
 const struct mode_letter chan_modes[] =
 {
@@ -174,27 +174,52 @@ add_id(struct Client *client_p, struct Channel *chptr, char *banid, unsigned int
   {
     const struct Ban *ban = node->data;
 
-    if (!irccmp(ban->name, name) &&
-        !irccmp(ban->user, user) &&
-        !irccmp(ban->host, host))
+    if (!irccmp(BanName(ban), name) &&
+        !irccmp(BanUser(ban), user) &&
+        !irccmp(BanHost(ban), host))
       return 0;
   }
 
-  struct Ban *ban = mp_pool_get(ban_pool);
+  /*
+   * A ban is a single allocation holding the address for CIDR bans and
+   * the name, user and host parts; see struct Ban.
+   */
+  struct irc_ssaddr addr;
+  int bits = 0;
+  const int masktype = parse_netmask(host, &addr, &bits);
+  const size_t addr_size = masktype == HM_IPV4 ? sizeof(struct sockaddr_in) :
+                           masktype == HM_IPV6 ? sizeof(struct sockaddr_in6) : 0;
+  const size_t name_len = strlen(name), user_len = strlen(user);
+
+  /* -2 for ! + @, +3 for the terminators */
+  struct Ban *ban = xcalloc(sizeof(*ban) + addr_size + len - 2 + 3);
   ban->when = CurrentTime;
-  ban->len = len - 2;  /* -2 for ! + @ */
-  ban->type = parse_netmask(host, &ban->addr, &ban->bits);
-  strlcpy(ban->name, name, sizeof(ban->name));
-  strlcpy(ban->user, user, sizeof(ban->user));
-  strlcpy(ban->host, host, sizeof(ban->host));
+  ban->len = len - 2;
+  ban->type = masktype;
+  ban->bits = bits;
+  memcpy(ban->data, &addr, addr_size);
+
+  char *p = BanName(ban);
+  memcpy(p, name, name_len + 1);
+  p += name_len + 1;
+  ban->user = p - ban->data;
+  memcpy(p, user, user_len + 1);
+  p += user_len + 1;
+  ban->host = p - ban->data;
+  strcpy(p, host);
 
   if (IsClient(client_p))
-    snprintf(ban->who, sizeof(ban->who), "%s!%s@%s", client_p->name,
+  {
+    char who[NICKLEN + USERLEN + HOSTLEN + 3];
+
+    snprintf(who, sizeof(who), "%s!%s@%s", client_p->name,
              client_p->username, client_p->host);
+    ban->who = intern_get(who);
+  }
   else if (IsHidden(client_p) || ConfigServerHide.hide_servers)
-    strlcpy(ban->who, me.name, sizeof(ban->who));
+    ban->who = intern_get(me.name);
   else
-    strlcpy(ban->who, client_p->name, sizeof(ban->who));
+    ban->who = intern_get(client_p->name);
 
   dlinkAdd(ban, &ban->node, list);
 
@@ -258,9 +283,9 @@ del_id(struct Channel *chptr, char *banid, unsigned int type)
   {
     struct Ban *ban = node->data;
 
-    if (!irccmp(name, ban->name) &&
-        !irccmp(user, ban->user) &&
-        !irccmp(host, ban->host))
+    if (!irccmp(name, BanName(ban)) &&
+        !irccmp(user, BanUser(ban)) &&
+        !irccmp(host, BanHost(ban)))
     {
       remove_ban(ban, list);
       return 1;
@@ -550,7 +575,7 @@ chm_ban(struct Client *source_p, struct Channel *chptr, int parc, int *parn,
     {
       const struct Ban *ban = node->data;
       sendto_one_numeric(source_p, &me, RPL_BANLIST, chptr->name,
-                         ban->name, ban->user, ban->host,
+                         BanName(ban), BanUser(ban), BanHost(ban),
                          ban->who, ban->when);
     }
 
@@ -616,7 +641,7 @@ chm_except(struct Client *source_p, struct Channel *chptr, int parc, int *parn,
     {
       const struct Ban *ban = node->data;
       sendto_one_numeric(source_p, &me, RPL_EXCEPTLIST, chptr->name,
-                         ban->name, ban->user, ban->host,
+                         BanName(ban), BanUser(ban), BanHost(ban),
                          ban->who, ban->when);
     }
 
@@ -682,7 +707,7 @@ chm_invex(struct Client *source_p, struct Channel *chptr, int parc, int *parn,
     {
       const struct Ban *ban = node->data;
       sendto_one_numeric(source_p, &me, RPL_INVEXLIST, chptr->name,
-                         ban->name, ban->user, ban->host,
+                         BanName(ban), BanUser(ban), BanHost(ban),
                          ban->who, ban->when);
     }
 
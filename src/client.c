@@ -44,6 +44,7 @@
 #include "user.h"
 #include "memory.h"
 #include "mempool.h"
+#include "intern.h"
 #include "hostmask.h"
 #include "listener.h"
 #include "userhost.h"
@@ -51,9 +52,11 @@
 #include "rng_mt.h"
 #include "parse.h"
 #include "ipcache.h"
+#include "password.h"
+#include "cursor.h"
 
 
-dlink_list listing_client_list;
+dlink_list bursting_server_list;
 dlink_list unknown_list;
 dlink_list local_client_list;
 dlink_list local_server_list;
@@ -61,10 +64,15 @@ dlink_list global_client_list;
 dlink_list global_server_list;
 dlink_list oper_list;
 
-static mp_pool_t *client_pool, *connection_pool;
+static mp_pool_t *client_pool;
 static dlink_list dead_list, abort_list;
+static dlink_list split_list;  /* clients and servers gone in a netsplit, see free_split_clients() */
 static dlink_node *eac_next;  /* next aborted client to exit */
 
+/* buf_recvq is the first field past the hot part of a Connection */
+_Static_assert(offsetof(struct Connection, buf_recvq) <= CONNECTION_HOT_SIZE,
+               "hot part of struct Connection exceeds CONNECTION_HOT_SIZE");
+
 
 /*
  * make_client - create a new Client struct and set it to initial state.
@@ -91,7 +99,7 @@ make_client(struct Client *from)
   else
   {
     client_p->from = client_p;  /* 'from' of local client is self! */
-    client_p->connection = mp_pool_get(connection_pool);
+    client_p->connection = xcalloc_aligned(CONNECTION_ALIGN, sizeof(struct Connection));
     client_p->connection->since = CurrentTime;
     client_p->connection->lasttime = CurrentTime;
     client_p->connection->firsttime = CurrentTime;
@@ -106,6 +114,10 @@ make_client(struct Client *from)
   SetUnknown(client_p);
   strcpy(client_p->username, "unknown");
   strcpy(client_p->account, "*");
+  client_p->host = intern_get("");
+  client_p->info = intern_get("");
+  client_p->away = intern_get("");
+  client_p->sockhost = intern_get("");
 
   return client_p;
 }
@@ -148,14 +160,63 @@ free_client(struct Client *client_p)
     }
 
     dbuf_clear(&client_p->connection->buf_recvq);
-    dbuf_clear(&client_p->connection->buf_sendq);
+    sendq_clear(client_p->connection);
 
-    mp_pool_release(client_p->connection);
+    xfree(client_p->connection);
   }
 
+  intern_release(client_p->host);
+  intern_release(client_p->info);
+  intern_release(client_p->away);
+  intern_release(client_p->sockhost);
+
   mp_pool_release(client_p);
 }
 
+/* client_set_string()
+ *
+ * inputs       - pointer to the shared string field of a client
+ *              - new value
+ *              - size of the longest value, including the terminator
+ * output       - NONE
+ * side effects - the field is set to a shared copy of the value,
+ *                truncated as needed
+ */
+static void
+client_set_string(const char **field, const char *value, size_t size)
+{
+  char buf[IRCD_BUFSIZE];
+  const char *const old = *field;
+
+  strlcpy(buf, value, size);
+  *field = intern_get(buf);
+  intern_release(old);
+}
+
+void
+client_set_host(struct Client *client_p, const char *host)
+{
+  client_set_string(&client_p->host, host, HOSTLEN + 1);
+}
+
+void
+client_set_info(struct Client *client_p, const char *info)
+{
+  client_set_string(&client_p->info, info, REALLEN + 1);
+}
+
+void
+client_set_away(struct Client *client_p, const char *away)
+{
+  client_set_string(&client_p->away, away, AWAYLEN + 1);
+}
+
+void
+client_set_sockhost(struct Client *client_p, const char *sockhost)
+{
+  client_set_string(&client_p->sockhost, sockhost, HOSTIPLEN + 1);
+}
+
 void
 client_attach_svstag(struct Client *client_p, unsigned int numeric,
                      const char *umodes, const char *tag)
@@ -228,7 +289,7 @@ check_pings_list(dlink_list *list)
          */
         AddFlag(client_p, FLAGS_PINGSENT);
         client_p->connection->lasttime = CurrentTime - ping;
-        sendto_one(client_p, "PING :%s", ID_or_name(&me, client_p));
+        sendto_one_control(client_p, "PING :%s", ID_or_name(&me, client_p));
       }
       else
       {
@@ -576,14 +637,45 @@ free_exited_clients(void)
   }
 }
 
+/* free_split_clients()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - records up to SPLIT_HISTORY_CHUNK users gone in a
+ *                netsplit in the WHOWAS history and frees them. Servers
+ *                are queued behind their users.
+ */
+void
+free_split_clients(void)
+{
+  dlink_node *node = NULL, *node_next = NULL;
+  unsigned int count = 0;
+
+  DLINK_FOREACH_SAFE(node, node_next, split_list.head)
+  {
+    struct Client *client_p = node->data;
+
+    if (++count > SPLIT_HISTORY_CHUNK)
+      break;
+
+    if (IsClient(client_p))
+      whowas_add_history(client_p, 0);
+
+    free_client(client_p);
+    dlinkDelete(node, &split_list);
+    free_dlink_node(node);
+  }
+}
+
 /*
  * Exit one client, local or remote. Assuming all dependents have
  * been already removed, and socket closed for local client.
  *
- * The only messages generated are QUITs on channels.
+ * The only messages generated are QUITs on channels. Clients that
+ * are part of a netsplit are kept around for free_split_clients().
  */
 static void
-exit_one_client(struct Client *source_p, const char *comment)
+exit_one_client(struct Client *source_p, const char *comment, int split)
 {
   dlink_node *node = NULL, *node_next = NULL;
 
@@ -593,6 +685,7 @@ exit_one_client(struct Client *source_p, const char *comment)
   if (IsClient(source_p))
   {
     dlinkDelete(&source_p->lnode, &source_p->servptr->serv->client_list);
+    server_burst_unlink(&source_p->node);
     dlinkDelete(&source_p->node, &global_client_list);
 
     /*
@@ -610,11 +703,13 @@ exit_one_client(struct Client *source_p, const char *comment)
 
     client_clear_svstags(source_p);
 
-    whowas_add_history(source_p, 0);
-    whowas_off_history(source_p);
-
+    /* Netsplit quits go to the WHOWAS history later, in free_split_clients() */
+    if (!split)
+      whowas_add_history(source_p, 0);
     watch_check_hash(source_p, RPL_LOGOFF);
 
+    whowas_off_history(source_p);
+
     if (MyConnect(source_p))
     {
       clear_invite_list(&source_p->connection->invited);
@@ -624,6 +719,7 @@ exit_one_client(struct Client *source_p, const char *comment)
   else if (IsServer(source_p))
   {
     dlinkDelete(&source_p->lnode, &source_p->servptr->serv->server_list);
+    server_burst_unlink(&source_p->node);
     dlinkDelete(&source_p->node, &global_client_list);
 
     if ((node = dlinkFindDelete(&global_server_list, source_p)))
@@ -647,7 +743,11 @@ exit_one_client(struct Client *source_p, const char *comment)
 
   /* add to dead client dlist */
   SetDead(source_p);
-  dlinkAdd(source_p, make_dlink_node(), &dead_list);
+
+  if (split)
+    dlinkAddTail(source_p, make_dlink_node(), &split_list);
+  else
+    dlinkAdd(source_p, make_dlink_node(), &dead_list);
 }
 
 /*
@@ -662,12 +762,12 @@ recurse_remove_clients(struct Client *source_p, const char *comment)
   dlink_node *node = NULL, *node_next = NULL;
 
   DLINK_FOREACH_SAFE(node, node_next, source_p->serv->client_list.head)
-    exit_one_client(node->data, comment);
+    exit_one_client(node->data, comment, 1);
 
   DLINK_FOREACH_SAFE(node, node_next, source_p->serv->server_list.head)
   {
     recurse_remove_clients(node->data, comment);
-    exit_one_client(node->data, comment);
+    exit_one_client(node->data, comment, 1);
   }
 }
 
@@ -712,7 +812,9 @@ exit_client(struct Client *source_p, const char *comment)
       ipcache_remove_address(&source_p->connection->ip);
     }
 
-    delete_auth(&source_p->connection->auth);
+    if (source_p->connection->auth)
+      delete_auth(source_p->connection->auth);
+    password_free(source_p);
 
     if (IsClient(source_p))
     {
@@ -727,8 +829,8 @@ exit_client(struct Client *source_p, const char *comment)
       assert(dlinkFind(&local_client_list, source_p));
       dlinkDelete(&source_p->connection->lclient_node, &local_client_list);
 
-      if (source_p->connection->list_task)
-        free_list_task(source_p);
+      if (source_p->connection->cursors.head)
+        cursor_free_all(source_p);
 
       watch_del_watch_list(source_p);
 
@@ -753,6 +855,9 @@ exit_client(struct Client *source_p, const char *comment)
 
       assert(dlinkFind(&local_server_list, source_p));
       dlinkDelete(&source_p->connection->lclient_node, &local_server_list);
+
+      if (source_p->connection->burst_task)
+        free_burst_task(source_p);
     }
     else
     {
@@ -805,8 +910,13 @@ exit_client(struct Client *source_p, const char *comment)
     if (!HasFlag(source_p, FLAGS_SQUIT))
       sendto_server(NULL, 0, 0, "SQUIT %s :%s", source_p->id, comment);
 
-    /* Now exit the clients internally */
+    /*
+     * Now exit the clients internally. Local clients get their QUITs
+     * in one go once all of them have been queued.
+     */
+    sendto_batch_begin("netsplit", splitstr);
     recurse_remove_clients(source_p, splitstr);
+    sendto_batch_end();
 
     if (MyConnect(source_p))
     {
@@ -830,7 +940,7 @@ exit_client(struct Client *source_p, const char *comment)
   assert(dlinkFind(&local_server_list, source_p) == NULL);
   assert(dlinkFind(&oper_list, source_p) == NULL);
 
-  exit_one_client(source_p, comment);
+  exit_one_client(source_p, comment, IsServer(source_p));
 }
 
 /*
@@ -846,7 +956,7 @@ dead_link_on_write(struct Client *client_p, int ierrno)
     return;
 
   dbuf_clear(&client_p->connection->buf_recvq);
-  dbuf_clear(&client_p->connection->buf_sendq);
+  sendq_clear(client_p->connection);
 
   assert(dlinkFind(&abort_list, client_p) == NULL);
   node = make_dlink_node();
@@ -873,7 +983,7 @@ dead_link_on_read(struct Client *client_p, int error)
     return;
 
   dbuf_clear(&client_p->connection->buf_recvq);
-  dbuf_clear(&client_p->connection->buf_sendq);
+  sendq_clear(client_p->connection);
 
   current_error = get_sockerr(client_p->connection->fd.fd);
 
@@ -1073,6 +1183,18 @@ client_get_idle_time(const struct Client *source_p,
   return idle;
 }
 
+/* client_reserve()
+ *
+ * inputs       - number of clients about to be introduced
+ * output       - NONE
+ * side effects - memory for that many clients is allocated up front
+ */
+void
+client_reserve(unsigned int count)
+{
+  mp_pool_reserve(client_pool, count);
+}
+
 /* client_init()
  *
  * inputs       - NONE
@@ -1089,7 +1211,6 @@ client_init(void)
     .when = 5
   };
 
-  client_pool = mp_pool_new(sizeof(struct Client), MP_CHUNK_SIZE_CLIENT);
-  connection_pool = mp_pool_new(sizeof(struct Connection), MP_CHUNK_SIZE_CONNECTION);
+  client_pool = mp_pool_new("client", sizeof(struct Client), MP_CHUNK_SIZE_CLIENT);
   event_add(&event_ping, NULL);
 }
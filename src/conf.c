@@ -61,6 +61,7 @@
 #include "ipcache.h"
 #include "isupport.h"
 #include "whowas.h"
+#include "password.h"
 
 
 struct config_channel_entry ConfigChannel;
@@ -253,17 +254,21 @@ attach_iline(struct Client *client_p, struct MaskItem *conf)
   return attach_conf(client_p, conf);
 }
 
-/* verify_access()
+/* find_client_conf()
  *
- * inputs       - pointer to client to verify
- * output       - 0 if success -'ve if not
- * side effect  - find the first (best) I line to attach.
+ * inputs       - pointer to client
+ *              - if set, encrypted passwords not checked yet are queued
+ *                for the password workers instead
+ * output       - pointer to best matching auth {} block or kline, or NULL
+ * side effects - none
  */
-static int
-verify_access(struct Client *client_p)
+static struct MaskItem *
+find_client_conf(struct Client *client_p, int collect)
 {
   struct MaskItem *conf = NULL;
 
+  password_set_context(client_p, collect);
+
   if (HasFlag(client_p, FLAGS_GOTID))
   {
     conf = find_address_conf(client_p->host, client_p->username,
@@ -282,6 +287,51 @@ verify_access(struct Client *client_p)
                              client_p->connection->password);
   }
 
+  password_set_context(NULL, 0);
+  return conf;
+}
+
+/* conf_password_pending()
+ *
+ * inputs       - pointer to unregistered client
+ * output       - 1 if the client has to wait for the password workers
+ * side effects - the next encrypted password check register_local_user()
+ *                would do for this client is queued, unless cached. The
+ *                client is resumed once it is done, which queues the
+ *                next one, if any.
+ */
+int
+conf_password_pending(struct Client *client_p)
+{
+  const struct MaskItem *conf = NULL;
+
+  if (EmptyString(client_p->connection->password))
+    return 0;
+
+  conf = find_client_conf(client_p, 1);
+
+  if (conf && IsConfClient(conf) && !EmptyString(conf->passwd) &&
+      (conf->flags & CONF_FLAGS_ENCRYPTED))
+  {
+    password_set_context(client_p, 1);
+    password_check(client_p->connection->password, conf->passwd);
+    password_set_context(NULL, 0);
+  }
+
+  return client_p->connection->password_job != NULL;
+}
+
+/* verify_access()
+ *
+ * inputs       - pointer to client to verify
+ * output       - 0 if success -'ve if not
+ * side effect  - find the first (best) I line to attach.
+ */
+static int
+verify_access(struct Client *client_p)
+{
+  struct MaskItem *conf = find_client_conf(client_p, 0);
+
   if (!conf)
     return NOT_AUTHORIZED;
 
@@ -303,7 +353,7 @@ verify_access(struct Client *client_p)
         sendto_realops_flags(UMODE_SERVNOTICE, L_ADMIN, SEND_NOTICE, "%s spoofing: %s as %s",
                              client_p->name, client_p->host, conf->name);
 
-      strlcpy(client_p->host, conf->name, sizeof(client_p->host));
+      client_set_host(client_p, conf->name);
     }
 
     return attach_iline(client_p, conf);
@@ -661,6 +711,7 @@ set_default_conf(void)
   ConfigGeneral.away_count = 2;
   ConfigGeneral.away_time = 10;
   ConfigGeneral.max_watch = 50;
+  ConfigGeneral.memory_budget = 0;
   ConfigGeneral.whowas_history_length = 15000;
   ConfigGeneral.cycle_on_host_change = 1;
   ConfigGeneral.dline_min_cidr = 16;
@@ -817,7 +868,6 @@ lookup_confhost(struct MaskItem *conf)
 int
 conf_connect_allowed(struct irc_ssaddr *addr, int aftype)
 {
-  struct ip_entry *ip_found = NULL;
   const struct MaskItem *conf = find_dline_conf(addr, aftype);
 
   if (conf)
@@ -828,19 +878,9 @@ conf_connect_allowed(struct irc_ssaddr *addr, int aftype)
     return BANNED_CLIENT;
   }
 
-  ip_found = ipcache_find_or_add_address(addr);
-
-  if ((CurrentTime - ip_found->last_attempt) < ConfigGeneral.throttle_time)
-  {
-    if (ip_found->connection_count >= ConfigGeneral.throttle_count)
-      return TOO_FAST;
-
-    ++ip_found->connection_count;
-  }
-  else
-    ip_found->connection_count = 1;
+  if (ipcache_throttle_check(addr))
+    return TOO_FAST;
 
-  ip_found->last_attempt = CurrentTime;
   return 0;
 }
 
@@ -1557,17 +1597,13 @@ parse_aline(const char *cmd, struct Client *source_p,
 int
 match_conf_password(const char *password, const struct MaskItem *conf)
 {
-  const char *encr = NULL;
-
   if (EmptyString(password) || EmptyString(conf->passwd))
     return 0;
 
   if (conf->flags & CONF_FLAGS_ENCRYPTED)
-    encr = crypt(password, conf->passwd);
-  else
-    encr = password;
+    return password_check(password, conf->passwd);
 
-  return encr && !strcmp(encr, conf->passwd);
+  return !strcmp(password, conf->passwd);
 }
 
 /*
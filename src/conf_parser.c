@@ -229,221 +229,224 @@ extern int yydebug;
     CIDR_BITLEN_IPV6 = 274,
     CLASS = 275,
     CLOSE = 276,
-    CONNECT = 277,
-    CONNECTFREQ = 278,
-    CYCLE_ON_HOST_CHANGE = 279,
-    DEFAULT_FLOODCOUNT = 280,
-    DEFAULT_FLOODTIME = 281,
-    DEFAULT_JOIN_FLOOD_COUNT = 282,
-    DEFAULT_JOIN_FLOOD_TIME = 283,
-    DEFAULT_MAX_CLIENTS = 284,
-    DENY = 285,
-    DESCRIPTION = 286,
-    DIE = 287,
-    DISABLE_AUTH = 288,
-    DISABLE_FAKE_CHANNELS = 289,
-    DISABLE_REMOTE_COMMANDS = 290,
-    DLINE_MIN_CIDR = 291,
-    DLINE_MIN_CIDR6 = 292,
-    DOTS_IN_IDENT = 293,
-    EMAIL = 294,
-    ENCRYPTED = 295,
-    EXCEED_LIMIT = 296,
-    EXEMPT = 297,
-    FAILED_OPER_NOTICE = 298,
-    FLATTEN_LINKS = 299,
-    FLATTEN_LINKS_DELAY = 300,
-    FLATTEN_LINKS_FILE = 301,
-    GECOS = 302,
-    GENERAL = 303,
-    HIDDEN = 304,
-    HIDDEN_NAME = 305,
-    HIDE_CHANS = 306,
-    HIDE_IDLE = 307,
-    HIDE_IDLE_FROM_OPERS = 308,
-    HIDE_SERVER_IPS = 309,
-    HIDE_SERVERS = 310,
-    HIDE_SERVICES = 311,
-    HOST = 312,
-    HUB = 313,
-    HUB_MASK = 314,
-    IGNORE_BOGUS_TS = 315,
-    INVISIBLE_ON_CONNECT = 316,
-    INVITE_CLIENT_COUNT = 317,
-    INVITE_CLIENT_TIME = 318,
-    INVITE_DELAY_CHANNEL = 319,
-    INVITE_EXPIRE_TIME = 320,
-    IP = 321,
-    IRCD_AUTH = 322,
-    IRCD_FLAGS = 323,
-    IRCD_SID = 324,
-    JOIN = 325,
-    KILL = 326,
-    KILL_CHASE_TIME_LIMIT = 327,
-    KLINE = 328,
-    KLINE_EXEMPT = 329,
-    KLINE_MIN_CIDR = 330,
-    KLINE_MIN_CIDR6 = 331,
-    KNOCK_CLIENT_COUNT = 332,
-    KNOCK_CLIENT_TIME = 333,
-    KNOCK_DELAY_CHANNEL = 334,
-    LEAF_MASK = 335,
-    LIBGEOIP_DATABASE_OPTIONS = 336,
-    LIBGEOIP_IPV4_DATABASE_FILE = 337,
-    LIBGEOIP_IPV6_DATABASE_FILE = 338,
-    LISTEN = 339,
-    MASK = 340,
-    MAX_ACCEPT = 341,
-    MAX_BANS = 342,
-    MAX_CHANNELS = 343,
-    MAX_GLOBAL = 344,
-    MAX_IDLE = 345,
-    MAX_INVITES = 346,
-    MAX_LOCAL = 347,
-    MAX_NICK_CHANGES = 348,
-    MAX_NICK_LENGTH = 349,
-    MAX_NICK_TIME = 350,
-    MAX_NUMBER = 351,
-    MAX_TARGETS = 352,
-    MAX_TOPIC_LENGTH = 353,
-    MAX_WATCH = 354,
-    MEMORY_CACHE = 355,
-    MIN_IDLE = 356,
-    MIN_NONWILDCARD = 357,
-    MIN_NONWILDCARD_SIMPLE = 358,
-    MMAP_CACHE = 359,
-    MODULE = 360,
-    MODULES = 361,
-    MOTD = 362,
-    NAME = 363,
-    NEED_IDENT = 364,
-    NEED_PASSWORD = 365,
-    NETWORK_DESC = 366,
-    NETWORK_NAME = 367,
-    NICK = 368,
-    NO_OPER_FLOOD = 369,
-    NO_TILDE = 370,
-    NUMBER = 371,
-    NUMBER_PER_CIDR = 372,
-    NUMBER_PER_IP = 373,
-    OPER_ONLY_UMODES = 374,
-    OPER_UMODES = 375,
-    OPERATOR = 376,
-    OPERS_BYPASS_CALLERID = 377,
-    PACE_WAIT = 378,
-    PACE_WAIT_SIMPLE = 379,
-    PASSWORD = 380,
-    PATH = 381,
-    PING_COOKIE = 382,
-    PING_TIME = 383,
-    PORT = 384,
-    QSTRING = 385,
-    RANDOM_IDLE = 386,
-    REASON = 387,
-    REDIRPORT = 388,
-    REDIRSERV = 389,
-    REHASH = 390,
-    REMOTE = 391,
-    REMOTEBAN = 392,
-    RESV = 393,
-    RESV_EXEMPT = 394,
-    RSA_PRIVATE_KEY_FILE = 395,
-    SECONDS = 396,
-    MINUTES = 397,
-    HOURS = 398,
-    DAYS = 399,
-    WEEKS = 400,
-    MONTHS = 401,
-    YEARS = 402,
-    SEND_PASSWORD = 403,
-    SENDQ = 404,
-    SERVERHIDE = 405,
-    SERVERINFO = 406,
-    SHORT_MOTD = 407,
-    SPOOF = 408,
-    SPOOF_NOTICE = 409,
-    SQUIT = 410,
-    SSL_CERTIFICATE_FILE = 411,
-    SSL_CERTIFICATE_FINGERPRINT = 412,
-    SSL_CONNECTION_REQUIRED = 413,
-    SSL_DH_ELLIPTIC_CURVE = 414,
-    SSL_DH_PARAM_FILE = 415,
-    SSL_MESSAGE_DIGEST_ALGORITHM = 416,
-    STANDARD = 417,
-    STATS_E_DISABLED = 418,
-    STATS_I_OPER_ONLY = 419,
-    STATS_K_OPER_ONLY = 420,
-    STATS_M_OPER_ONLY = 421,
-    STATS_O_OPER_ONLY = 422,
-    STATS_P_OPER_ONLY = 423,
-    STATS_U_OPER_ONLY = 424,
-    T_ALL = 425,
-    T_BOTS = 426,
-    T_CALLERID = 427,
-    T_CCONN = 428,
-    T_COMMAND = 429,
-    T_CLUSTER = 430,
-    T_DEAF = 431,
-    T_DEBUG = 432,
-    T_DLINE = 433,
-    T_EXTERNAL = 434,
-    T_FARCONNECT = 435,
-    T_FILE = 436,
-    T_FULL = 437,
-    T_GLOBOPS = 438,
-    T_INVISIBLE = 439,
-    T_IPV4 = 440,
-    T_IPV6 = 441,
-    T_LOCOPS = 442,
-    T_LOG = 443,
-    T_NCHANGE = 444,
-    T_NONONREG = 445,
-    T_OPME = 446,
-    T_PREPEND = 447,
-    T_PSEUDO = 448,
-    T_RECVQ = 449,
-    T_REJ = 450,
-    T_RESTART = 451,
-    T_SERVER = 452,
-    T_SERVICE = 453,
-    T_SERVNOTICE = 454,
-    T_SET = 455,
-    T_SHARED = 456,
-    T_SIZE = 457,
-    T_SKILL = 458,
-    T_SOFTCALLERID = 459,
-    T_SPY = 460,
-    T_SSL = 461,
-    T_SSL_CIPHER_LIST = 462,
-    T_TARGET = 463,
-    T_UMODES = 464,
-    T_UNAUTH = 465,
-    T_UNDLINE = 466,
-    T_UNLIMITED = 467,
-    T_UNRESV = 468,
-    T_UNXLINE = 469,
-    T_WALLOP = 470,
-    T_WALLOPS = 471,
-    T_WEBIRC = 472,
-    TBOOL = 473,
-    THROTTLE_COUNT = 474,
-    THROTTLE_TIME = 475,
-    TKLINE_EXPIRE_NOTICES = 476,
-    TMASKED = 477,
-    TS_MAX_DELTA = 478,
-    TS_WARN_DELTA = 479,
-    TWODOTS = 480,
-    TYPE = 481,
-    UNKLINE = 482,
-    USE_LOGGING = 483,
-    USER = 484,
-    VHOST = 485,
-    VHOST6 = 486,
-    WARN_NO_CONNECT_BLOCK = 487,
-    WHOIS = 488,
-    WHOWAS_HISTORY_LENGTH = 489,
-    XLINE = 490,
-    XLINE_EXEMPT = 491
+    COMPRESSED = 277,
+    CONNECT = 278,
+    CONNECTFREQ = 279,
+    CYCLE_ON_HOST_CHANGE = 280,
+    DEFAULT_FLOODCOUNT = 281,
+    DEFAULT_FLOODTIME = 282,
+    DEFAULT_JOIN_FLOOD_COUNT = 283,
+    DEFAULT_JOIN_FLOOD_TIME = 284,
+    DEFAULT_MAX_CLIENTS = 285,
+    DENY = 286,
+    DESCRIPTION = 287,
+    DIE = 288,
+    DISABLE_AUTH = 289,
+    DISABLE_FAKE_CHANNELS = 290,
+    DISABLE_REMOTE_COMMANDS = 291,
+    DLINE_MIN_CIDR = 292,
+    DLINE_MIN_CIDR6 = 293,
+    DOTS_IN_IDENT = 294,
+    EMAIL = 295,
+    ENCRYPTED = 296,
+    EXCEED_LIMIT = 297,
+    EXEMPT = 298,
+    FAILED_OPER_NOTICE = 299,
+    FLATTEN_LINKS = 300,
+    FLATTEN_LINKS_DELAY = 301,
+    FLATTEN_LINKS_FILE = 302,
+    GECOS = 303,
+    GENERAL = 304,
+    HIDDEN = 305,
+    HIDDEN_NAME = 306,
+    HIDE_CHANS = 307,
+    HIDE_IDLE = 308,
+    HIDE_IDLE_FROM_OPERS = 309,
+    HIDE_SERVER_IPS = 310,
+    HIDE_SERVERS = 311,
+    HIDE_SERVICES = 312,
+    HOST = 313,
+    HUB = 314,
+    HUB_MASK = 315,
+    IGNORE_BOGUS_TS = 316,
+    INVISIBLE_ON_CONNECT = 317,
+    INVITE_CLIENT_COUNT = 318,
+    INVITE_CLIENT_TIME = 319,
+    INVITE_DELAY_CHANNEL = 320,
+    INVITE_EXPIRE_TIME = 321,
+    IP = 322,
+    IRCD_AUTH = 323,
+    IRCD_FLAGS = 324,
+    IRCD_SID = 325,
+    JOIN = 326,
+    KILL = 327,
+    KILL_CHASE_TIME_LIMIT = 328,
+    KLINE = 329,
+    KLINE_EXEMPT = 330,
+    KLINE_MIN_CIDR = 331,
+    KLINE_MIN_CIDR6 = 332,
+    KNOCK_CLIENT_COUNT = 333,
+    KNOCK_CLIENT_TIME = 334,
+    KNOCK_DELAY_CHANNEL = 335,
+    LEAF_MASK = 336,
+    LIBGEOIP_DATABASE_OPTIONS = 337,
+    LIBGEOIP_IPV4_DATABASE_FILE = 338,
+    LIBGEOIP_IPV6_DATABASE_FILE = 339,
+    LISTEN = 340,
+    MASK = 341,
+    MAX_ACCEPT = 342,
+    MAX_BANS = 343,
+    MAX_CHANNELS = 344,
+    MAX_GLOBAL = 345,
+    MAX_IDLE = 346,
+    MAX_INVITES = 347,
+    MAX_LOCAL = 348,
+    MAX_NICK_CHANGES = 349,
+    MAX_NICK_LENGTH = 350,
+    MAX_NICK_TIME = 351,
+    MAX_NUMBER = 352,
+    MAX_TARGETS = 353,
+    MAX_TOPIC_LENGTH = 354,
+    MAX_WATCH = 355,
+    MEMORY_BUDGET = 356,
+    MEMORY_CACHE = 357,
+    MIN_IDLE = 358,
+    MIN_NONWILDCARD = 359,
+    MIN_NONWILDCARD_SIMPLE = 360,
+    MMAP_CACHE = 361,
+    MODULE = 362,
+    MODULES = 363,
+    MOTD = 364,
+    NAME = 365,
+    NEED_IDENT = 366,
+    NEED_PASSWORD = 367,
+    NETWORK_DESC = 368,
+    NETWORK_NAME = 369,
+    NICK = 370,
+    NO_OPER_FLOOD = 371,
+    NO_TILDE = 372,
+    NUMBER = 373,
+    NUMBER_PER_CIDR = 374,
+    NUMBER_PER_IP = 375,
+    OPER_ONLY_UMODES = 376,
+    OPER_UMODES = 377,
+    OPERATOR = 378,
+    OPERS_BYPASS_CALLERID = 379,
+    PACE_WAIT = 380,
+    PACE_WAIT_SIMPLE = 381,
+    PASSWORD = 382,
+    PATH = 383,
+    PING_COOKIE = 384,
+    PING_TIME = 385,
+    PORT = 386,
+    QSTRING = 387,
+    RANDOM_IDLE = 388,
+    REASON = 389,
+    REDIRPORT = 390,
+    REDIRSERV = 391,
+    REHASH = 392,
+    REMOTE = 393,
+    REMOTEBAN = 394,
+    RESV = 395,
+    RESV_EXEMPT = 396,
+    RSA_PRIVATE_KEY_FILE = 397,
+    SECONDS = 398,
+    MINUTES = 399,
+    HOURS = 400,
+    DAYS = 401,
+    WEEKS = 402,
+    MONTHS = 403,
+    YEARS = 404,
+    SEND_PASSWORD = 405,
+    SENDQ = 406,
+    SERVERHIDE = 407,
+    SERVERINFO = 408,
+    SHORT_MOTD = 409,
+    SPOOF = 410,
+    SPOOF_NOTICE = 411,
+    SQUIT = 412,
+    SSL_CERTIFICATE_FILE = 413,
+    SSL_CERTIFICATE_FINGERPRINT = 414,
+    SSL_CONNECTION_REQUIRED = 415,
+    SSL_DH_ELLIPTIC_CURVE = 416,
+    SSL_DH_PARAM_FILE = 417,
+    SSL_MESSAGE_DIGEST_ALGORITHM = 418,
+    STANDARD = 419,
+    STATS_E_DISABLED = 420,
+    STATS_I_OPER_ONLY = 421,
+    STATS_K_OPER_ONLY = 422,
+    STATS_M_OPER_ONLY = 423,
+    STATS_O_OPER_ONLY = 424,
+    STATS_P_OPER_ONLY = 425,
+    STATS_U_OPER_ONLY = 426,
+    T_ALL = 427,
+    T_BOTS = 428,
+    T_BSIZE = 429,
+    T_CALLERID = 430,
+    T_CCONN = 431,
+    T_COMMAND = 432,
+    T_CLUSTER = 433,
+    T_DEAF = 434,
+    T_DEBUG = 435,
+    T_DLINE = 436,
+    T_EXTERNAL = 437,
+    T_FARCONNECT = 438,
+    T_FILE = 439,
+    T_FULL = 440,
+    T_GLOBOPS = 441,
+    T_INVISIBLE = 442,
+    T_IPV4 = 443,
+    T_IPV6 = 444,
+    T_LOCOPS = 445,
+    T_LOG = 446,
+    T_NCHANGE = 447,
+    T_NONONREG = 448,
+    T_OPME = 449,
+    T_PREPEND = 450,
+    T_PSEUDO = 451,
+    T_RECVQ = 452,
+    T_REJ = 453,
+    T_RESTART = 454,
+    T_SERVER = 455,
+    T_SERVICE = 456,
+    T_SERVNOTICE = 457,
+    T_SET = 458,
+    T_SHARED = 459,
+    T_SIZE = 460,
+    T_SKILL = 461,
+    T_SOFTCALLERID = 462,
+    T_SPY = 463,
+    T_SSL = 464,
+    T_SSL_CIPHER_LIST = 465,
+    T_TARGET = 466,
+    T_UMODES = 467,
+    T_UNAUTH = 468,
+    T_UNDLINE = 469,
+    T_UNLIMITED = 470,
+    T_UNRESV = 471,
+    T_UNXLINE = 472,
+    T_WALLOP = 473,
+    T_WALLOPS = 474,
+    T_WEBIRC = 475,
+    TBOOL = 476,
+    THROTTLE_COUNT = 477,
+    THROTTLE_TIME = 478,
+    TKLINE_EXPIRE_NOTICES = 479,
+    TMASKED = 480,
+    TS_MAX_DELTA = 481,
+    TS_WARN_DELTA = 482,
+    TWODOTS = 483,
+    TYPE = 484,
+    UNKLINE = 485,
+    USE_LOGGING = 486,
+    USER = 487,
+    VHOST = 488,
+    VHOST6 = 489,
+    WARN_NO_CONNECT_BLOCK = 490,
+    WHOIS = 491,
+    WHOWAS_HISTORY_LENGTH = 492,
+    XLINE = 493,
+    XLINE_EXEMPT = 494
   };
 #endif
 /* Tokens.  */
@@ -466,221 +469,224 @@ extern int yydebug;
 #define CIDR_BITLEN_IPV6 274
 #define CLASS 275
 #define CLOSE 276
-#define CONNECT 277
-#define CONNECTFREQ 278
-#define CYCLE_ON_HOST_CHANGE 279
-#define DEFAULT_FLOODCOUNT 280
-#define DEFAULT_FLOODTIME 281
-#define DEFAULT_JOIN_FLOOD_COUNT 282
-#define DEFAULT_JOIN_FLOOD_TIME 283
-#define DEFAULT_MAX_CLIENTS 284
-#define DENY 285
-#define DESCRIPTION 286
-#define DIE 287
-#define DISABLE_AUTH 288
-#define DISABLE_FAKE_CHANNELS 289
-#define DISABLE_REMOTE_COMMANDS 290
-#define DLINE_MIN_CIDR 291
-#define DLINE_MIN_CIDR6 292
-#define DOTS_IN_IDENT 293
-#define EMAIL 294
-#define ENCRYPTED 295
-#define EXCEED_LIMIT 296
-#define EXEMPT 297
-#define FAILED_OPER_NOTICE 298
-#define FLATTEN_LINKS 299
-#define FLATTEN_LINKS_DELAY 300
-#define FLATTEN_LINKS_FILE 301
-#define GECOS 302
-#define GENERAL 303
-#define HIDDEN 304
-#define HIDDEN_NAME 305
-#define HIDE_CHANS 306
-#define HIDE_IDLE 307
-#define HIDE_IDLE_FROM_OPERS 308
-#define HIDE_SERVER_IPS 309
-#define HIDE_SERVERS 310
-#define HIDE_SERVICES 311
-#define HOST 312
-#define HUB 313
-#define HUB_MASK 314
-#define IGNORE_BOGUS_TS 315
-#define INVISIBLE_ON_CONNECT 316
-#define INVITE_CLIENT_COUNT 317
-#define INVITE_CLIENT_TIME 318
-#define INVITE_DELAY_CHANNEL 319
-#define INVITE_EXPIRE_TIME 320
-#define IP 321
-#define IRCD_AUTH 322
-#define IRCD_FLAGS 323
-#define IRCD_SID 324
-#define JOIN 325
-#define KILL 326
-#define KILL_CHASE_TIME_LIMIT 327
-#define KLINE 328
-#define KLINE_EXEMPT 329
-#define KLINE_MIN_CIDR 330
-#define KLINE_MIN_CIDR6 331
-#define KNOCK_CLIENT_COUNT 332
-#define KNOCK_CLIENT_TIME 333
-#define KNOCK_DELAY_CHANNEL 334
-#define LEAF_MASK 335
-#define LIBGEOIP_DATABASE_OPTIONS 336
-#define LIBGEOIP_IPV4_DATABASE_FILE 337
-#define LIBGEOIP_IPV6_DATABASE_FILE 338
-#define LISTEN 339
-#define MASK 340
-#define MAX_ACCEPT 341
-#define MAX_BANS 342
-#define MAX_CHANNELS 343
-#define MAX_GLOBAL 344
-#define MAX_IDLE 345
-#define MAX_INVITES 346
-#define MAX_LOCAL 347
-#define MAX_NICK_CHANGES 348
-#define MAX_NICK_LENGTH 349
-#define MAX_NICK_TIME 350
-#define MAX_NUMBER 351
-#define MAX_TARGETS 352
-#define MAX_TOPIC_LENGTH 353
-#define MAX_WATCH 354
-#define MEMORY_CACHE 355
-#define MIN_IDLE 356
-#define MIN_NONWILDCARD 357
-#define MIN_NONWILDCARD_SIMPLE 358
-#define MMAP_CACHE 359
-#define MODULE 360
-#define MODULES 361
-#define MOTD 362
-#define NAME 363
-#define NEED_IDENT 364
-#define NEED_PASSWORD 365
-#define NETWORK_DESC 366
-#define NETWORK_NAME 367
-#define NICK 368
-#define NO_OPER_FLOOD 369
-#define NO_TILDE 370
-#define NUMBER 371
-#define NUMBER_PER_CIDR 372
-#define NUMBER_PER_IP 373
-#define OPER_ONLY_UMODES 374
-#define OPER_UMODES 375
-#define OPERATOR 376
-#define OPERS_BYPASS_CALLERID 377
-#define PACE_WAIT 378
-#define PACE_WAIT_SIMPLE 379
-#define PASSWORD 380
-#define PATH 381
-#define PING_COOKIE 382
-#define PING_TIME 383
-#define PORT 384
-#define QSTRING 385
-#define RANDOM_IDLE 386
-#define REASON 387
-#define REDIRPORT 388
-#define REDIRSERV 389
-#define REHASH 390
-#define REMOTE 391
-#define REMOTEBAN 392
-#define RESV 393
-#define RESV_EXEMPT 394
-#define RSA_PRIVATE_KEY_FILE 395
-#define SECONDS 396
-#define MINUTES 397
-#define HOURS 398
-#define DAYS 399
-#define WEEKS 400
-#define MONTHS 401
-#define YEARS 402
-#define SEND_PASSWORD 403
-#define SENDQ 404
-#define SERVERHIDE 405
-#define SERVERINFO 406
-#define SHORT_MOTD 407
-#define SPOOF 408
-#define SPOOF_NOTICE 409
-#define SQUIT 410
-#define SSL_CERTIFICATE_FILE 411
-#define SSL_CERTIFICATE_FINGERPRINT 412
-#define SSL_CONNECTION_REQUIRED 413
-#define SSL_DH_ELLIPTIC_CURVE 414
-#define SSL_DH_PARAM_FILE 415
-#define SSL_MESSAGE_DIGEST_ALGORITHM 416
-#define STANDARD 417
-#define STATS_E_DISABLED 418
-#define STATS_I_OPER_ONLY 419
-#define STATS_K_OPER_ONLY 420
-#define STATS_M_OPER_ONLY 421
-#define STATS_O_OPER_ONLY 422
-#define STATS_P_OPER_ONLY 423
-#define STATS_U_OPER_ONLY 424
-#define T_ALL 425
-#define T_BOTS 426
-#define T_CALLERID 427
-#define T_CCONN 428
-#define T_COMMAND 429
-#define T_CLUSTER 430
-#define T_DEAF 431
-#define T_DEBUG 432
-#define T_DLINE 433
-#define T_EXTERNAL 434
-#define T_FARCONNECT 435
-#define T_FILE 436
-#define T_FULL 437
-#define T_GLOBOPS 438
-#define T_INVISIBLE 439
-#define T_IPV4 440
-#define T_IPV6 441
-#define T_LOCOPS 442
-#define T_LOG 443
-#define T_NCHANGE 444
-#define T_NONONREG 445
-#define T_OPME 446
-#define T_PREPEND 447
-#define T_PSEUDO 448
-#define T_RECVQ 449
-#define T_REJ 450
-#define T_RESTART 451
-#define T_SERVER 452
-#define T_SERVICE 453
-#define T_SERVNOTICE 454
-#define T_SET 455
-#define T_SHARED 456
-#define T_SIZE 457
-#define T_SKILL 458
-#define T_SOFTCALLERID 459
-#define T_SPY 460
-#define T_SSL 461
-#define T_SSL_CIPHER_LIST 462
-#define T_TARGET 463
-#define T_UMODES 464
-#define T_UNAUTH 465
-#define T_UNDLINE 466
-#define T_UNLIMITED 467
-#define T_UNRESV 468
-#define T_UNXLINE 469
-#define T_WALLOP 470
-#define T_WALLOPS 471
-#define T_WEBIRC 472
-#define TBOOL 473
-#define THROTTLE_COUNT 474
-#define THROTTLE_TIME 475
-#define TKLINE_EXPIRE_NOTICES 476
-#define TMASKED 477
-#define TS_MAX_DELTA 478
-#define TS_WARN_DELTA 479
-#define TWODOTS 480
-#define TYPE 481
-#define UNKLINE 482
-#define USE_LOGGING 483
-#define USER 484
-#define VHOST 485
-#define VHOST6 486
-#define WARN_NO_CONNECT_BLOCK 487
-#define WHOIS 488
-#define WHOWAS_HISTORY_LENGTH 489
-#define XLINE 490
-#define XLINE_EXEMPT 491
+#define COMPRESSED 277
+#define CONNECT 278
+#define CONNECTFREQ 279
+#define CYCLE_ON_HOST_CHANGE 280
+#define DEFAULT_FLOODCOUNT 281
+#define DEFAULT_FLOODTIME 282
+#define DEFAULT_JOIN_FLOOD_COUNT 283
+#define DEFAULT_JOIN_FLOOD_TIME 284
+#define DEFAULT_MAX_CLIENTS 285
+#define DENY 286
+#define DESCRIPTION 287
+#define DIE 288
+#define DISABLE_AUTH 289
+#define DISABLE_FAKE_CHANNELS 290
+#define DISABLE_REMOTE_COMMANDS 291
+#define DLINE_MIN_CIDR 292
+#define DLINE_MIN_CIDR6 293
+#define DOTS_IN_IDENT 294
+#define EMAIL 295
+#define ENCRYPTED 296
+#define EXCEED_LIMIT 297
+#define EXEMPT 298
+#define FAILED_OPER_NOTICE 299
+#define FLATTEN_LINKS 300
+#define FLATTEN_LINKS_DELAY 301
+#define FLATTEN_LINKS_FILE 302
+#define GECOS 303
+#define GENERAL 304
+#define HIDDEN 305
+#define HIDDEN_NAME 306
+#define HIDE_CHANS 307
+#define HIDE_IDLE 308
+#define HIDE_IDLE_FROM_OPERS 309
+#define HIDE_SERVER_IPS 310
+#define HIDE_SERVERS 311
+#define HIDE_SERVICES 312
+#define HOST 313
+#define HUB 314
+#define HUB_MASK 315
+#define IGNORE_BOGUS_TS 316
+#define INVISIBLE_ON_CONNECT 317
+#define INVITE_CLIENT_COUNT 318
+#define INVITE_CLIENT_TIME 319
+#define INVITE_DELAY_CHANNEL 320
+#define INVITE_EXPIRE_TIME 321
+#define IP 322
+#define IRCD_AUTH 323
+#define IRCD_FLAGS 324
+#define IRCD_SID 325
+#define JOIN 326
+#define KILL 327
+#define KILL_CHASE_TIME_LIMIT 328
+#define KLINE 329
+#define KLINE_EXEMPT 330
+#define KLINE_MIN_CIDR 331
+#define KLINE_MIN_CIDR6 332
+#define KNOCK_CLIENT_COUNT 333
+#define KNOCK_CLIENT_TIME 334
+#define KNOCK_DELAY_CHANNEL 335
+#define LEAF_MASK 336
+#define LIBGEOIP_DATABASE_OPTIONS 337
+#define LIBGEOIP_IPV4_DATABASE_FILE 338
+#define LIBGEOIP_IPV6_DATABASE_FILE 339
+#define LISTEN 340
+#define MASK 341
+#define MAX_ACCEPT 342
+#define MAX_BANS 343
+#define MAX_CHANNELS 344
+#define MAX_GLOBAL 345
+#define MAX_IDLE 346
+#define MAX_INVITES 347
+#define MAX_LOCAL 348
+#define MAX_NICK_CHANGES 349
+#define MAX_NICK_LENGTH 350
+#define MAX_NICK_TIME 351
+#define MAX_NUMBER 352
+#define MAX_TARGETS 353
+#define MAX_TOPIC_LENGTH 354
+#define MAX_WATCH 355
+#define MEMORY_BUDGET 356
+#define MEMORY_CACHE 357
+#define MIN_IDLE 358
+#define MIN_NONWILDCARD 359
+#define MIN_NONWILDCARD_SIMPLE 360
+#define MMAP_CACHE 361
+#define MODULE 362
+#define MODULES 363
+#define MOTD 364
+#define NAME 365
+#define NEED_IDENT 366
+#define NEED_PASSWORD 367
+#define NETWORK_DESC 368
+#define NETWORK_NAME 369
+#define NICK 370
+#define NO_OPER_FLOOD 371
+#define NO_TILDE 372
+#define NUMBER 373
+#define NUMBER_PER_CIDR 374
+#define NUMBER_PER_IP 375
+#define OPER_ONLY_UMODES 376
+#define OPER_UMODES 377
+#define OPERATOR 378
+#define OPERS_BYPASS_CALLERID 379
+#define PACE_WAIT 380
+#define PACE_WAIT_SIMPLE 381
+#define PASSWORD 382
+#define PATH 383
+#define PING_COOKIE 384
+#define PING_TIME 385
+#define PORT 386
+#define QSTRING 387
+#define RANDOM_IDLE 388
+#define REASON 389
+#define REDIRPORT 390
+#define REDIRSERV 391
+#define REHASH 392
+#define REMOTE 393
+#define REMOTEBAN 394
+#define RESV 395
+#define RESV_EXEMPT 396
+#define RSA_PRIVATE_KEY_FILE 397
+#define SECONDS 398
+#define MINUTES 399
+#define HOURS 400
+#define DAYS 401
+#define WEEKS 402
+#define MONTHS 403
+#define YEARS 404
+#define SEND_PASSWORD 405
+#define SENDQ 406
+#define SERVERHIDE 407
+#define SERVERINFO 408
+#define SHORT_MOTD 409
+#define SPOOF 410
+#define SPOOF_NOTICE 411
+#define SQUIT 412
+#define SSL_CERTIFICATE_FILE 413
+#define SSL_CERTIFICATE_FINGERPRINT 414
+#define SSL_CONNECTION_REQUIRED 415
+#define SSL_DH_ELLIPTIC_CURVE 416
+#define SSL_DH_PARAM_FILE 417
+#define SSL_MESSAGE_DIGEST_ALGORITHM 418
+#define STANDARD 419
+#define STATS_E_DISABLED 420
+#define STATS_I_OPER_ONLY 421
+#define STATS_K_OPER_ONLY 422
+#define STATS_M_OPER_ONLY 423
+#define STATS_O_OPER_ONLY 424
+#define STATS_P_OPER_ONLY 425
+#define STATS_U_OPER_ONLY 426
+#define T_ALL 427
+#define T_BOTS 428
+#define T_BSIZE 429
+#define T_CALLERID 430
+#define T_CCONN 431
+#define T_COMMAND 432
+#define T_CLUSTER 433
+#define T_DEAF 434
+#define T_DEBUG 435
+#define T_DLINE 436
+#define T_EXTERNAL 437
+#define T_FARCONNECT 438
+#define T_FILE 439
+#define T_FULL 440
+#define T_GLOBOPS 441
+#define T_INVISIBLE 442
+#define T_IPV4 443
+#define T_IPV6 444
+#define T_LOCOPS 445
+#define T_LOG 446
+#define T_NCHANGE 447
+#define T_NONONREG 448
+#define T_OPME 449
+#define T_PREPEND 450
+#define T_PSEUDO 451
+#define T_RECVQ 452
+#define T_REJ 453
+#define T_RESTART 454
+#define T_SERVER 455
+#define T_SERVICE 456
+#define T_SERVNOTICE 457
+#define T_SET 458
+#define T_SHARED 459
+#define T_SIZE 460
+#define T_SKILL 461
+#define T_SOFTCALLERID 462
+#define T_SPY 463
+#define T_SSL 464
+#define T_SSL_CIPHER_LIST 465
+#define T_TARGET 466
+#define T_UMODES 467
+#define T_UNAUTH 468
+#define T_UNDLINE 469
+#define T_UNLIMITED 470
+#define T_UNRESV 471
+#define T_UNXLINE 472
+#define T_WALLOP 473
+#define T_WALLOPS 474
+#define T_WEBIRC 475
+#define TBOOL 476
+#define THROTTLE_COUNT 477
+#define THROTTLE_TIME 478
+#define TKLINE_EXPIRE_NOTICES 479
+#define TMASKED 480
+#define TS_MAX_DELTA 481
+#define TS_WARN_DELTA 482
+#define TWODOTS 483
+#define TYPE 484
+#define UNKLINE 485
+#define USE_LOGGING 486
+#define USER 487
+#define VHOST 488
+#define VHOST6 489
+#define WARN_NO_CONNECT_BLOCK 490
+#define WHOIS 491
+#define WHOWAS_HISTORY_LENGTH 492
+#define XLINE 493
+#define XLINE_EXEMPT 494
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -690,9 +696,10 @@ union YYSTYPE
 #line 141 "conf_parser.y" /* yacc.c:355  */
 
   int number;
+  uintmax_t size;
   char *string;
 
-#line 696 "conf_parser.c" /* yacc.c:355  */
+#line 703 "conf_parser.c" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -709,7 +716,7 @@ int yyparse (void);
 
 /* Copy the second part of user declarations.  */
 
-#line 713 "conf_parser.c" /* yacc.c:358  */
+#line 720 "conf_parser.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -951,21 +958,21 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1397
+#define YYLAST   1418
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  243
+#define YYNTOKENS  246
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  301
+#define YYNNTS  304
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  681
+#define YYNRULES  691
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1342
+#define YYNSTATES  1358
 
 /* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
    by yylex, with out-of-bounds checking.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   491
+#define YYMAXUTOK   494
 
 #define YYTRANSLATE(YYX)                                                \
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -978,15 +985,15 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   241,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   242,   237,
-       2,   240,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   244,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   245,   240,
+       2,   243,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   239,     2,   238,     2,     2,     2,     2,
+       2,     2,     2,   242,     2,   241,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1023,82 +1030,83 @@ static const yytype_uint8 yytranslate[] =
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
      225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236
+     235,   236,   237,   238,   239
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   381,   381,   382,   385,   386,   387,   388,   389,   390,
-     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
-     401,   402,   403,   404,   405,   406,   407,   408,   412,   412,
-     413,   414,   415,   416,   417,   418,   419,   420,   423,   423,
-     424,   425,   426,   427,   434,   436,   436,   437,   437,   437,
-     439,   445,   455,   457,   457,   458,   459,   460,   461,   462,
-     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
-     473,   474,   475,   476,   477,   478,   481,   490,   499,   508,
-     517,   526,   536,   535,   541,   541,   542,   548,   554,   560,
-     568,   583,   598,   613,   628,   638,   652,   661,   689,   717,
-     742,   764,   786,   796,   798,   798,   799,   800,   801,   802,
-     804,   813,   822,   836,   835,   853,   853,   854,   854,   854,
-     856,   862,   873,   872,   891,   891,   892,   892,   892,   892,
-     892,   894,   900,   906,   912,   934,   935,   935,   937,   937,
-     938,   940,   947,   947,   960,   961,   963,   963,   964,   964,
-     966,   974,   977,   983,   982,   988,   988,   989,   993,   997,
-    1001,  1005,  1009,  1013,  1017,  1028,  1027,  1088,  1088,  1089,
-    1090,  1091,  1092,  1093,  1094,  1095,  1096,  1097,  1098,  1099,
-    1101,  1107,  1113,  1119,  1125,  1136,  1142,  1153,  1160,  1159,
-    1165,  1165,  1166,  1170,  1174,  1178,  1182,  1186,  1190,  1194,
-    1198,  1202,  1206,  1210,  1214,  1218,  1222,  1226,  1230,  1234,
-    1238,  1242,  1246,  1250,  1257,  1256,  1262,  1262,  1263,  1267,
-    1271,  1275,  1279,  1283,  1287,  1291,  1295,  1299,  1303,  1307,
-    1311,  1315,  1319,  1323,  1327,  1331,  1335,  1339,  1343,  1347,
-    1351,  1355,  1359,  1363,  1367,  1371,  1375,  1386,  1385,  1441,
-    1441,  1442,  1443,  1444,  1445,  1446,  1447,  1448,  1449,  1450,
-    1451,  1452,  1453,  1454,  1455,  1456,  1457,  1458,  1460,  1466,
-    1472,  1478,  1484,  1490,  1496,  1502,  1508,  1514,  1521,  1527,
-    1533,  1539,  1548,  1558,  1557,  1563,  1563,  1564,  1568,  1579,
-    1578,  1585,  1584,  1589,  1589,  1590,  1594,  1598,  1604,  1604,
-    1605,  1605,  1605,  1605,  1605,  1607,  1607,  1609,  1609,  1611,
-    1624,  1641,  1647,  1658,  1657,  1703,  1703,  1704,  1705,  1706,
-    1707,  1708,  1709,  1710,  1711,  1712,  1714,  1720,  1726,  1732,
-    1744,  1743,  1749,  1749,  1750,  1754,  1758,  1762,  1766,  1770,
-    1774,  1778,  1782,  1786,  1792,  1806,  1815,  1829,  1828,  1843,
-    1843,  1844,  1844,  1844,  1844,  1846,  1852,  1858,  1868,  1870,
-    1870,  1871,  1871,  1873,  1890,  1889,  1912,  1912,  1913,  1913,
-    1913,  1913,  1915,  1921,  1941,  1940,  1946,  1946,  1947,  1951,
-    1955,  1959,  1963,  1967,  1971,  1975,  1979,  1983,  1994,  1993,
-    2012,  2012,  2013,  2013,  2013,  2015,  2022,  2021,  2027,  2027,
-    2028,  2032,  2036,  2040,  2044,  2048,  2052,  2056,  2060,  2064,
-    2075,  2074,  2146,  2146,  2147,  2148,  2149,  2150,  2151,  2152,
-    2153,  2154,  2155,  2156,  2157,  2158,  2159,  2160,  2161,  2163,
-    2169,  2175,  2181,  2194,  2207,  2213,  2219,  2223,  2230,  2229,
-    2234,  2234,  2235,  2239,  2245,  2256,  2262,  2268,  2274,  2290,
-    2289,  2315,  2315,  2316,  2316,  2316,  2318,  2338,  2349,  2348,
-    2375,  2375,  2376,  2376,  2376,  2378,  2384,  2394,  2396,  2396,
-    2397,  2397,  2399,  2417,  2416,  2437,  2437,  2438,  2438,  2438,
-    2440,  2446,  2456,  2458,  2458,  2459,  2460,  2461,  2462,  2463,
-    2464,  2465,  2466,  2467,  2468,  2469,  2470,  2471,  2472,  2473,
-    2474,  2475,  2476,  2477,  2478,  2479,  2480,  2481,  2482,  2483,
-    2484,  2485,  2486,  2487,  2488,  2489,  2490,  2491,  2492,  2493,
-    2494,  2495,  2496,  2497,  2498,  2499,  2500,  2501,  2502,  2503,
-    2504,  2505,  2506,  2509,  2514,  2519,  2524,  2529,  2535,  2540,
-    2545,  2550,  2555,  2560,  2565,  2570,  2575,  2580,  2585,  2590,
-    2595,  2600,  2605,  2611,  2616,  2621,  2626,  2631,  2636,  2641,
-    2646,  2649,  2654,  2657,  2662,  2667,  2672,  2677,  2682,  2687,
-    2692,  2697,  2702,  2707,  2712,  2717,  2723,  2722,  2727,  2727,
-    2728,  2731,  2734,  2737,  2740,  2743,  2746,  2749,  2752,  2755,
-    2758,  2761,  2764,  2767,  2770,  2773,  2776,  2779,  2782,  2785,
-    2788,  2791,  2797,  2796,  2801,  2801,  2802,  2805,  2808,  2811,
-    2814,  2817,  2820,  2823,  2826,  2829,  2832,  2835,  2838,  2841,
-    2844,  2847,  2850,  2853,  2856,  2859,  2864,  2869,  2874,  2879,
-    2888,  2890,  2890,  2891,  2892,  2893,  2894,  2895,  2896,  2897,
-    2898,  2899,  2900,  2901,  2902,  2903,  2904,  2906,  2911,  2916,
-    2921,  2926,  2931,  2936,  2941,  2946,  2951,  2956,  2961,  2966,
-    2975,  2977,  2977,  2978,  2979,  2980,  2981,  2982,  2983,  2984,
-    2985,  2986,  2987,  2989,  2995,  3011,  3020,  3026,  3032,  3038,
-    3047,  3053
+       0,   387,   387,   388,   391,   392,   393,   394,   395,   396,
+     397,   398,   399,   400,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   418,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   429,   429,
+     430,   431,   432,   433,   436,   436,   437,   438,   439,   440,
+     447,   449,   449,   450,   450,   450,   452,   458,   468,   470,
+     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
+     480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
+     490,   491,   494,   503,   512,   521,   530,   539,   549,   548,
+     554,   554,   555,   561,   567,   573,   581,   596,   611,   626,
+     641,   651,   665,   674,   702,   730,   755,   777,   799,   809,
+     811,   811,   812,   813,   814,   815,   817,   826,   835,   849,
+     848,   866,   866,   867,   867,   867,   869,   875,   886,   885,
+     904,   904,   905,   905,   905,   905,   905,   907,   913,   919,
+     925,   947,   948,   948,   950,   950,   951,   953,   960,   960,
+     973,   974,   976,   976,   977,   977,   979,   987,   990,   996,
+     995,  1001,  1001,  1002,  1006,  1010,  1014,  1018,  1022,  1026,
+    1030,  1041,  1040,  1101,  1101,  1102,  1103,  1104,  1105,  1106,
+    1107,  1108,  1109,  1110,  1111,  1112,  1114,  1120,  1126,  1132,
+    1138,  1149,  1155,  1166,  1173,  1172,  1178,  1178,  1179,  1183,
+    1187,  1191,  1195,  1199,  1203,  1207,  1211,  1215,  1219,  1223,
+    1227,  1231,  1235,  1239,  1243,  1247,  1251,  1255,  1259,  1263,
+    1270,  1269,  1275,  1275,  1276,  1280,  1284,  1288,  1292,  1296,
+    1300,  1304,  1308,  1312,  1316,  1320,  1324,  1328,  1332,  1336,
+    1340,  1344,  1348,  1352,  1356,  1360,  1364,  1368,  1372,  1376,
+    1380,  1384,  1388,  1399,  1398,  1454,  1454,  1455,  1456,  1457,
+    1458,  1459,  1460,  1461,  1462,  1463,  1464,  1465,  1466,  1467,
+    1468,  1469,  1470,  1471,  1473,  1479,  1485,  1491,  1497,  1503,
+    1509,  1515,  1521,  1527,  1534,  1540,  1546,  1552,  1561,  1571,
+    1570,  1576,  1576,  1577,  1581,  1592,  1591,  1598,  1597,  1602,
+    1602,  1603,  1607,  1611,  1617,  1617,  1618,  1618,  1618,  1618,
+    1618,  1620,  1620,  1622,  1622,  1624,  1637,  1654,  1660,  1671,
+    1670,  1716,  1716,  1717,  1718,  1719,  1720,  1721,  1722,  1723,
+    1724,  1725,  1727,  1733,  1739,  1745,  1757,  1756,  1762,  1762,
+    1763,  1767,  1771,  1775,  1779,  1783,  1787,  1791,  1795,  1799,
+    1805,  1819,  1828,  1842,  1841,  1856,  1856,  1857,  1857,  1857,
+    1857,  1859,  1865,  1871,  1881,  1883,  1883,  1884,  1884,  1886,
+    1903,  1902,  1925,  1925,  1926,  1926,  1926,  1926,  1928,  1934,
+    1954,  1953,  1959,  1959,  1960,  1964,  1968,  1972,  1976,  1980,
+    1984,  1988,  1992,  1996,  2007,  2006,  2025,  2025,  2026,  2026,
+    2026,  2028,  2035,  2034,  2040,  2040,  2041,  2045,  2049,  2053,
+    2057,  2061,  2065,  2069,  2073,  2077,  2088,  2087,  2159,  2159,
+    2160,  2161,  2162,  2163,  2164,  2165,  2166,  2167,  2168,  2169,
+    2170,  2171,  2172,  2173,  2174,  2176,  2182,  2188,  2194,  2207,
+    2220,  2226,  2232,  2236,  2243,  2242,  2247,  2247,  2248,  2252,
+    2256,  2260,  2266,  2277,  2283,  2289,  2295,  2311,  2310,  2336,
+    2336,  2337,  2337,  2337,  2339,  2359,  2370,  2369,  2396,  2396,
+    2397,  2397,  2397,  2399,  2405,  2415,  2417,  2417,  2418,  2418,
+    2420,  2438,  2437,  2458,  2458,  2459,  2459,  2459,  2461,  2467,
+    2477,  2479,  2479,  2480,  2481,  2482,  2483,  2484,  2485,  2486,
+    2487,  2488,  2489,  2490,  2491,  2492,  2493,  2494,  2495,  2496,
+    2497,  2498,  2499,  2500,  2501,  2502,  2503,  2504,  2505,  2506,
+    2507,  2508,  2509,  2510,  2511,  2512,  2513,  2514,  2515,  2516,
+    2517,  2518,  2519,  2520,  2521,  2522,  2523,  2524,  2525,  2526,
+    2527,  2528,  2531,  2536,  2541,  2546,  2560,  2565,  2571,  2576,
+    2581,  2586,  2591,  2596,  2601,  2606,  2611,  2616,  2621,  2626,
+    2631,  2636,  2641,  2647,  2652,  2657,  2662,  2667,  2672,  2677,
+    2682,  2685,  2690,  2693,  2698,  2703,  2708,  2713,  2718,  2723,
+    2728,  2733,  2738,  2743,  2748,  2753,  2759,  2758,  2763,  2763,
+    2764,  2767,  2770,  2773,  2776,  2779,  2782,  2785,  2788,  2791,
+    2794,  2797,  2800,  2803,  2806,  2809,  2812,  2815,  2818,  2821,
+    2824,  2827,  2833,  2832,  2837,  2837,  2838,  2841,  2844,  2847,
+    2850,  2853,  2856,  2859,  2862,  2865,  2868,  2871,  2874,  2877,
+    2880,  2883,  2886,  2889,  2892,  2895,  2900,  2905,  2910,  2915,
+    2924,  2926,  2926,  2927,  2928,  2929,  2930,  2931,  2932,  2933,
+    2934,  2935,  2936,  2937,  2938,  2939,  2940,  2942,  2947,  2952,
+    2957,  2962,  2967,  2972,  2977,  2982,  2987,  2992,  2997,  3002,
+    3011,  3013,  3013,  3014,  3015,  3016,  3017,  3018,  3019,  3020,
+    3021,  3022,  3023,  3025,  3031,  3047,  3056,  3062,  3068,  3074,
+    3083,  3089
 };
 #endif
 
@@ -1111,13 +1119,14 @@ static const char *const yytname[] =
   "ANTI_NICK_FLOOD", "ANTI_SPAM_EXIT_MESSAGE_TIME", "AUTOCONN",
   "AWAY_COUNT", "AWAY_TIME", "BYTES", "KBYTES", "MBYTES", "CALLER_ID_WAIT",
   "CAN_FLOOD", "CHANNEL", "CHECK_CACHE", "CIDR_BITLEN_IPV4",
-  "CIDR_BITLEN_IPV6", "CLASS", "CLOSE", "CONNECT", "CONNECTFREQ",
-  "CYCLE_ON_HOST_CHANGE", "DEFAULT_FLOODCOUNT", "DEFAULT_FLOODTIME",
-  "DEFAULT_JOIN_FLOOD_COUNT", "DEFAULT_JOIN_FLOOD_TIME",
-  "DEFAULT_MAX_CLIENTS", "DENY", "DESCRIPTION", "DIE", "DISABLE_AUTH",
-  "DISABLE_FAKE_CHANNELS", "DISABLE_REMOTE_COMMANDS", "DLINE_MIN_CIDR",
-  "DLINE_MIN_CIDR6", "DOTS_IN_IDENT", "EMAIL", "ENCRYPTED", "EXCEED_LIMIT",
-  "EXEMPT", "FAILED_OPER_NOTICE", "FLATTEN_LINKS", "FLATTEN_LINKS_DELAY",
+  "CIDR_BITLEN_IPV6", "CLASS", "CLOSE", "COMPRESSED", "CONNECT",
+  "CONNECTFREQ", "CYCLE_ON_HOST_CHANGE", "DEFAULT_FLOODCOUNT",
+  "DEFAULT_FLOODTIME", "DEFAULT_JOIN_FLOOD_COUNT",
+  "DEFAULT_JOIN_FLOOD_TIME", "DEFAULT_MAX_CLIENTS", "DENY", "DESCRIPTION",
+  "DIE", "DISABLE_AUTH", "DISABLE_FAKE_CHANNELS",
+  "DISABLE_REMOTE_COMMANDS", "DLINE_MIN_CIDR", "DLINE_MIN_CIDR6",
+  "DOTS_IN_IDENT", "EMAIL", "ENCRYPTED", "EXCEED_LIMIT", "EXEMPT",
+  "FAILED_OPER_NOTICE", "FLATTEN_LINKS", "FLATTEN_LINKS_DELAY",
   "FLATTEN_LINKS_FILE", "GECOS", "GENERAL", "HIDDEN", "HIDDEN_NAME",
   "HIDE_CHANS", "HIDE_IDLE", "HIDE_IDLE_FROM_OPERS", "HIDE_SERVER_IPS",
   "HIDE_SERVERS", "HIDE_SERVICES", "HOST", "HUB", "HUB_MASK",
@@ -1131,40 +1140,40 @@ static const char *const yytname[] =
   "MASK", "MAX_ACCEPT", "MAX_BANS", "MAX_CHANNELS", "MAX_GLOBAL",
   "MAX_IDLE", "MAX_INVITES", "MAX_LOCAL", "MAX_NICK_CHANGES",
   "MAX_NICK_LENGTH", "MAX_NICK_TIME", "MAX_NUMBER", "MAX_TARGETS",
-  "MAX_TOPIC_LENGTH", "MAX_WATCH", "MEMORY_CACHE", "MIN_IDLE",
-  "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MMAP_CACHE", "MODULE",
-  "MODULES", "MOTD", "NAME", "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESC",
-  "NETWORK_NAME", "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER",
-  "NUMBER_PER_CIDR", "NUMBER_PER_IP", "OPER_ONLY_UMODES", "OPER_UMODES",
-  "OPERATOR", "OPERS_BYPASS_CALLERID", "PACE_WAIT", "PACE_WAIT_SIMPLE",
-  "PASSWORD", "PATH", "PING_COOKIE", "PING_TIME", "PORT", "QSTRING",
-  "RANDOM_IDLE", "REASON", "REDIRPORT", "REDIRSERV", "REHASH", "REMOTE",
-  "REMOTEBAN", "RESV", "RESV_EXEMPT", "RSA_PRIVATE_KEY_FILE", "SECONDS",
-  "MINUTES", "HOURS", "DAYS", "WEEKS", "MONTHS", "YEARS", "SEND_PASSWORD",
-  "SENDQ", "SERVERHIDE", "SERVERINFO", "SHORT_MOTD", "SPOOF",
-  "SPOOF_NOTICE", "SQUIT", "SSL_CERTIFICATE_FILE",
+  "MAX_TOPIC_LENGTH", "MAX_WATCH", "MEMORY_BUDGET", "MEMORY_CACHE",
+  "MIN_IDLE", "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MMAP_CACHE",
+  "MODULE", "MODULES", "MOTD", "NAME", "NEED_IDENT", "NEED_PASSWORD",
+  "NETWORK_DESC", "NETWORK_NAME", "NICK", "NO_OPER_FLOOD", "NO_TILDE",
+  "NUMBER", "NUMBER_PER_CIDR", "NUMBER_PER_IP", "OPER_ONLY_UMODES",
+  "OPER_UMODES", "OPERATOR", "OPERS_BYPASS_CALLERID", "PACE_WAIT",
+  "PACE_WAIT_SIMPLE", "PASSWORD", "PATH", "PING_COOKIE", "PING_TIME",
+  "PORT", "QSTRING", "RANDOM_IDLE", "REASON", "REDIRPORT", "REDIRSERV",
+  "REHASH", "REMOTE", "REMOTEBAN", "RESV", "RESV_EXEMPT",
+  "RSA_PRIVATE_KEY_FILE", "SECONDS", "MINUTES", "HOURS", "DAYS", "WEEKS",
+  "MONTHS", "YEARS", "SEND_PASSWORD", "SENDQ", "SERVERHIDE", "SERVERINFO",
+  "SHORT_MOTD", "SPOOF", "SPOOF_NOTICE", "SQUIT", "SSL_CERTIFICATE_FILE",
   "SSL_CERTIFICATE_FINGERPRINT", "SSL_CONNECTION_REQUIRED",
   "SSL_DH_ELLIPTIC_CURVE", "SSL_DH_PARAM_FILE",
   "SSL_MESSAGE_DIGEST_ALGORITHM", "STANDARD", "STATS_E_DISABLED",
   "STATS_I_OPER_ONLY", "STATS_K_OPER_ONLY", "STATS_M_OPER_ONLY",
   "STATS_O_OPER_ONLY", "STATS_P_OPER_ONLY", "STATS_U_OPER_ONLY", "T_ALL",
-  "T_BOTS", "T_CALLERID", "T_CCONN", "T_COMMAND", "T_CLUSTER", "T_DEAF",
-  "T_DEBUG", "T_DLINE", "T_EXTERNAL", "T_FARCONNECT", "T_FILE", "T_FULL",
-  "T_GLOBOPS", "T_INVISIBLE", "T_IPV4", "T_IPV6", "T_LOCOPS", "T_LOG",
-  "T_NCHANGE", "T_NONONREG", "T_OPME", "T_PREPEND", "T_PSEUDO", "T_RECVQ",
-  "T_REJ", "T_RESTART", "T_SERVER", "T_SERVICE", "T_SERVNOTICE", "T_SET",
-  "T_SHARED", "T_SIZE", "T_SKILL", "T_SOFTCALLERID", "T_SPY", "T_SSL",
-  "T_SSL_CIPHER_LIST", "T_TARGET", "T_UMODES", "T_UNAUTH", "T_UNDLINE",
-  "T_UNLIMITED", "T_UNRESV", "T_UNXLINE", "T_WALLOP", "T_WALLOPS",
-  "T_WEBIRC", "TBOOL", "THROTTLE_COUNT", "THROTTLE_TIME",
+  "T_BOTS", "T_BSIZE", "T_CALLERID", "T_CCONN", "T_COMMAND", "T_CLUSTER",
+  "T_DEAF", "T_DEBUG", "T_DLINE", "T_EXTERNAL", "T_FARCONNECT", "T_FILE",
+  "T_FULL", "T_GLOBOPS", "T_INVISIBLE", "T_IPV4", "T_IPV6", "T_LOCOPS",
+  "T_LOG", "T_NCHANGE", "T_NONONREG", "T_OPME", "T_PREPEND", "T_PSEUDO",
+  "T_RECVQ", "T_REJ", "T_RESTART", "T_SERVER", "T_SERVICE", "T_SERVNOTICE",
+  "T_SET", "T_SHARED", "T_SIZE", "T_SKILL", "T_SOFTCALLERID", "T_SPY",
+  "T_SSL", "T_SSL_CIPHER_LIST", "T_TARGET", "T_UMODES", "T_UNAUTH",
+  "T_UNDLINE", "T_UNLIMITED", "T_UNRESV", "T_UNXLINE", "T_WALLOP",
+  "T_WALLOPS", "T_WEBIRC", "TBOOL", "THROTTLE_COUNT", "THROTTLE_TIME",
   "TKLINE_EXPIRE_NOTICES", "TMASKED", "TS_MAX_DELTA", "TS_WARN_DELTA",
   "TWODOTS", "TYPE", "UNKLINE", "USE_LOGGING", "USER", "VHOST", "VHOST6",
   "WARN_NO_CONNECT_BLOCK", "WHOIS", "WHOWAS_HISTORY_LENGTH", "XLINE",
   "XLINE_EXEMPT", "';'", "'}'", "'{'", "'='", "','", "':'", "$accept",
   "conf", "conf_item", "timespec_", "timespec", "sizespec_", "sizespec",
-  "modules_entry", "modules_items", "modules_item", "modules_module",
-  "modules_path", "serverinfo_entry", "serverinfo_items",
-  "serverinfo_item", "serverinfo_ssl_certificate_file",
+  "sizespec_large_", "sizespec_large", "modules_entry", "modules_items",
+  "modules_item", "modules_module", "modules_path", "serverinfo_entry",
+  "serverinfo_items", "serverinfo_item", "serverinfo_ssl_certificate_file",
   "serverinfo_rsa_private_key_file", "serverinfo_ssl_dh_param_file",
   "serverinfo_ssl_cipher_list", "serverinfo_ssl_message_digest_algorithm",
   "serverinfo_ssl_dh_elliptic_curve",
@@ -1220,7 +1229,7 @@ static const char *const yytname[] =
   "exempt_items", "exempt_item", "exempt_ip", "gecos_entry", "$@25",
   "gecos_items", "gecos_item", "gecos_name", "gecos_reason",
   "general_entry", "general_items", "general_item", "general_away_count",
-  "general_away_time", "general_max_watch",
+  "general_away_time", "general_max_watch", "general_memory_budget",
   "general_whowas_history_length", "general_cycle_on_host_change",
   "general_dline_min_cidr", "general_dline_min_cidr6",
   "general_kline_min_cidr", "general_kline_min_cidr6",
@@ -1287,17 +1296,17 @@ static const yytype_uint16 yytoknum[] =
      455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
      465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
      475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,    59,   125,   123,
-      61,    44,    58
+     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
+      59,   125,   123,    61,    44,    58
 };
 # endif
 
-#define YYPACT_NINF -978
+#define YYPACT_NINF -1045
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-978)))
+  (!!((Yystate) == (-1045)))
 
-#define YYTABLE_NINF -143
+#define YYTABLE_NINF -149
 
 #define yytable_value_is_error(Yytable_value) \
   0
@@ -1306,141 +1315,142 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -978,   680,  -978,  -215,  -207,  -205,  -978,  -978,  -978,  -199,
-    -978,  -196,  -978,  -978,  -978,  -194,  -978,  -978,  -978,  -189,
-    -160,  -978,  -154,  -978,  -146,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,   303,   757,  -141,  -140,  -134,    26,  -126,   413,  -123,
-    -100,   -94,    85,   -92,   -70,   -55,   686,   559,   -53,    10,
-     -26,    14,   -18,   -31,    -8,     4,     6,     7,  -978,  -978,
-    -978,  -978,  -978,    52,    60,    71,    77,    81,    82,    83,
-      86,    95,   103,   105,   106,   109,   275,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,   715,   649,    25,  -978,   110,    29,  -978,  -978,    28,
-    -978,   111,   115,   116,   119,   120,   125,   129,   131,   134,
-     135,   139,   140,   143,   155,   160,   162,   165,   166,   168,
-     173,   176,   177,   178,   181,   184,   185,  -978,  -978,   186,
-     188,   190,   193,   196,   200,   201,   202,   203,   204,   205,
-     207,   208,   214,   218,   219,   225,   228,   231,    51,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,   395,    27,   396,
-     -10,   235,   236,    30,  -978,  -978,  -978,    11,   392,    32,
-    -978,   237,   239,   241,   242,   243,   244,   246,   247,   250,
-     332,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,    75,   251,   252,   253,   254,  -978,   255,   257,   258,
-     261,   262,   263,   264,   267,   269,   283,   284,   286,   290,
-     291,   294,   154,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,    72,    88,   298,    15,  -978,  -978,
-    -978,    66,   199,  -978,   299,    43,  -978,  -978,    58,  -978,
-     130,   421,   422,   318,  -978,   117,   174,   338,   179,   174,
-     174,   174,   441,   174,   174,   442,   443,   447,   327,  -978,
-     329,   328,   333,   335,  -978,   344,   347,   349,   351,   352,
-     354,   356,   359,   360,   362,   364,   365,   240,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,   330,   366,   367,   369,   370,
-     372,   373,  -978,   374,   375,   376,   378,   380,   382,   383,
-      50,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,   387,   389,    17,
-    -978,  -978,  -978,   439,   393,  -978,  -978,   398,   403,    55,
-    -978,  -978,  -978,   428,   174,   456,   174,   174,   431,   535,
-     174,   437,   540,   542,   544,   445,   450,   454,   174,   549,
-     550,   557,   558,   174,   560,   561,   562,   563,   464,   446,
-     451,   467,   174,   174,   470,   472,   474,  -197,  -183,   475,
-     476,   477,   479,   582,   174,   483,   174,   174,   485,   588,
-     468,  -978,   486,   469,   471,  -978,   473,   484,   497,   499,
-     504,   276,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,   505,   506,    35,  -978,  -978,  -978,   488,   508,
-     509,  -978,   510,  -978,    12,  -978,  -978,  -978,  -978,  -978,
-     577,   584,   489,  -978,   515,   513,   514,    16,  -978,  -978,
-    -978,   518,   516,   519,  -978,   521,   525,   527,   536,  -978,
-     537,   539,   161,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,   538,   541,   548,   552,    40,  -978,
-    -978,  -978,  -978,   494,   564,   174,   650,   575,   664,   578,
-     580,   581,   565,  -978,  -978,   679,   670,   590,   684,   569,
-     685,   687,   708,   709,   696,   697,   698,   699,   707,   710,
-     712,   716,   717,   719,   721,   601,  -978,   602,   612,  -978,
-      53,  -978,  -978,  -978,  -978,   623,   616,  -978,   615,   620,
-     618,   619,   621,   622,     2,  -978,  -978,  -978,  -978,  -978,
-     730,   626,  -978,   628,   629,  -978,   630,    13,  -978,  -978,
-    -978,  -978,   634,   635,   637,  -978,   638,   627,   639,   640,
-     643,   648,   655,   657,   659,   660,   662,   665,   666,   667,
-    -978,  -978,   750,   751,   174,   646,   789,   791,   174,   792,
-     795,   174,   782,   797,   802,   174,   803,   803,   683,  -978,
-    -978,   787,  -114,   793,   704,   794,   798,   689,   800,   805,
-     809,   806,   812,   814,   817,   690,  -978,   819,   822,   694,
-    -978,   702,  -978,   823,   825,   720,  -978,   722,   724,   725,
-     726,   731,   732,   733,   738,   742,   745,   747,   752,   755,
-     756,   758,   760,   762,   764,   765,   770,   771,   772,   773,
-     775,   776,   777,   801,   711,   778,   780,   781,   783,   784,
-     785,   786,   788,   796,   799,   804,   807,   808,   810,   811,
-     813,   815,   818,   820,   821,   824,  -978,  -978,   828,   728,
-     727,   857,   882,   889,   894,   896,   826,  -978,   898,   901,
-     827,  -978,  -978,   902,   904,   829,   919,   830,  -978,   831,
-     833,  -978,  -978,   907,   908,   834,  -978,  -978,   909,   835,
-     832,   910,   912,   916,   836,   837,   926,   929,   838,  -978,
-    -978,   930,   932,   935,   839,  -978,   841,   842,   843,   844,
-     845,   846,   847,   848,   849,  -978,   850,   851,   852,   853,
-      20,   854,   855,   856,   858,   859,   860,   861,   862,   863,
-     864,   865,   866,   867,   868,   869,  -978,  -978,   936,   870,
-     871,  -978,   872,  -978,    80,  -978,   943,   944,   964,   977,
-     874,  -978,   875,  -978,  -978,   983,   876,   984,   878,  -978,
-    -978,  -978,  -978,  -978,   174,   174,   174,   174,   174,   174,
-     174,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,   880,   881,   883,   -34,   884,
-     885,   886,   887,   888,   890,   891,   892,   893,   895,    36,
-     897,   899,  -978,   900,   903,   905,   906,   911,   913,   914,
-      -4,   915,   917,   918,   920,   921,   922,   923,  -978,   924,
-     925,  -978,  -978,   927,   928,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -175,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -174,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   931,
-     933,   357,   934,   937,   938,   939,   940,  -978,   941,   942,
-    -978,   945,   946,   -29,   947,   948,  -978,  -978,  -978,  -978,
-     949,   950,  -978,   951,   953,   448,   954,   955,   956,   957,
-     761,   958,   959,  -978,   960,   961,   962,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -173,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,   963,   384,  -978,  -978,   965,   879,   966,  -978,
-      23,  -978,  -978,  -978,  -978,   967,   968,   970,   971,  -978,
-    -978,   972,   816,   973,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -133,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   803,
-     803,   803,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,   -48,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   801,
-    -978,   711,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,   -42,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   -33,  -978,
-    1010,   919,   974,  -978,  -978,  -978,  -978,  -978,  -978,   975,
-    -978,   976,   978,  -978,  -978,   979,   980,  -978,  -978,   981,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,   -32,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-     -15,  -978,  -978,  -978,  -978,  -978,  -978,  -978,    20,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-     -13,  -978,  -978,  1001,   -74,   985,   982,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,    -7,  -978,  -978,  -978,   -34,  -978,  -978,
-    -978,  -978,    -4,  -978,  -978,  -978,   357,  -978,   -29,  -978,
-    -978,  -978,   997,  1000,   999,  1003,  1008,  1009,  -978,   448,
-    -978,   761,  -978,  -978,   384,   987,   989,   990,   226,  -978,
-    -978,   816,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,    64,  -978,  -978,  -978,
-     226,  -978
+   -1045,   634, -1045,  -209,  -234,  -201, -1045, -1045, -1045,  -174,
+   -1045,  -172, -1045, -1045, -1045,  -163, -1045, -1045, -1045,  -157,
+    -149, -1045,  -143, -1045,  -134, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045,   319,   951,  -122,  -121,  -116,     2,  -114,   380,  -104,
+     -81,   -72,    32,   -69,   -54,   -53,   690,   498,   -47,    65,
+     -46,    15,   -41,  -186,  -178,   -87,   -40,     3, -1045, -1045,
+   -1045, -1045, -1045,   -37,   -31,   -29,   -12,    40,    66,    74,
+      87,    99,   113,   119,   125,   135,   227, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045,   670,   517,   309, -1045,   137,    25, -1045, -1045,    73,
+   -1045,   140,   168,   172,   177,   179,   182,   183,   185,   187,
+     188,   190,   191,   192,   194,   196,   205,   207,   208,   211,
+     215,   216,   217,   220,   221,   222,   223,   226, -1045, -1045,
+     228,   229,   230,   232,   234,   240,   243,   246,   248,   249,
+     250,   251,   252,   254,   257,   260,   264,   265,   267,    11,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,   497,
+      29,    28,    31,   268,   273,    27, -1045, -1045, -1045,    10,
+     328,    38, -1045,   278,   280,   282,   283,   284,   290,   292,
+     293,   296,   288, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045,    60,   298,   299,   300,   301, -1045,   310,
+     311,   312,   316,   320,   324,   327,   329,   330,   333,   336,
+     341,   342,   344,   345,   116, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,    21,   100,   347,    26,
+   -1045, -1045, -1045,   176,   189, -1045,   352,    61, -1045, -1045,
+      52, -1045,   133,   261,   338,   212, -1045,   294,   314,   303,
+     326,   314,   314,   314,   413,   314,   314,   434,   444,   453,
+     356, -1045,   359,   357,   358,   366, -1045,   371,   373,   376,
+     377,   379,   382,   383,   385,   386,   387,   388,   393,   150,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045,   378,   394,   396,
+     398,   399,   401,   402, -1045,   403,   404,   406,   408,   410,
+     412,   415,   144, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,   419,
+     420,    23, -1045, -1045, -1045,   491,   424, -1045, -1045,   423,
+     426,    57, -1045, -1045, -1045,   451,   314,   555,   314,   314,
+     454,   556,   314,   457,   563,   566,   569,   465,   469,   471,
+     314,   575,   585,   586,   587,   314,   589,   592,   593,   595,
+     597,   499,   475,   478,   501,   314,   314,   502,   504,   507,
+    -181,  -179,   509,   512,   523,   527,   620,   314,   528,   314,
+     314,   530,   635,   472, -1045,   514,   513,   515, -1045,   525,
+     526,   529,   533,   534,    81, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045,   535,   536,    63, -1045, -1045,
+   -1045,   531,   538,   539, -1045,   540, -1045,    22, -1045, -1045,
+   -1045, -1045, -1045,   623,   638,   545, -1045,   558,   559,   561,
+     186, -1045, -1045, -1045,   565,   570,   571, -1045,   572,   573,
+     574,   576, -1045,   577,   579,   204, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045,   578,   580,   583,
+     584,    18, -1045, -1045, -1045, -1045,   588,   607,   314,   667,
+     608,   669,   610,   612,   613,   596, -1045, -1045,   688,   710,
+     624,   716,   609,   718,   721,   737,   740,   727,   728,   729,
+     731,   732,   733,   736,   741,   742,   743,   744,   629, -1045,
+     639,   637, -1045,   117, -1045, -1045, -1045, -1045,   657,   641,
+   -1045,   510,   643,   646,   647,   650,   653,   141, -1045, -1045,
+   -1045, -1045, -1045,   752,   658, -1045,   660,   663, -1045,   665,
+      56, -1045, -1045, -1045, -1045,   661,   671,   672, -1045,   673,
+     552,   675,   676,   677,   681,   682,   683,   684,   687,   691,
+     694,   697,   701, -1045, -1045,   768,   785,   314,   666,   824,
+     826,   314,   829,   831,   314,   818,   835,   836,   314,   838,
+     838,   722, -1045, -1045,   832,  -129,   833,   746,   837,   840,
+     715,   841,   842,   845,   843,   844,   846,   850,   730, -1045,
+     853,   855,   748, -1045,   749, -1045,   858,   859,   754, -1045,
+     755,   756,   758,   759,   760,   761,   762,   763,   764,   766,
+     769,   770,   771,   772,   773,   778,   779,   780,   781,   782,
+     783,   784,   786,   209,   787,   788,   792,   793,   753,   664,
+     794,   795,   796,   797,   798,   801,   802,   804,   805,   806,
+     807,   808,   809,   810,   811,   812,   813,   814,   815,   816,
+     817, -1045, -1045,   860,   747,   734,   861,   889,   876,   893,
+     926,   819, -1045,   928,   929,   822, -1045, -1045,   931,   932,
+     823,   947,   827, -1045,   828,   830, -1045, -1045,   937,   939,
+     834, -1045, -1045,   940,   852,   839,   943,   944,   945,   857,
+     847,   948,   949,   848, -1045, -1045,   952,   953,   954,   849,
+   -1045,   851,   854,   856,   862,   863,   864,   865,   866,   867,
+   -1045,   868,   869,   870,   871,   259,   872,   873,   874,   875,
+     877,   878,   879,   880,   881,   882,   883,   884,   885,   886,
+     887, -1045, -1045,   955,   888,   890, -1045,   892, -1045,    13,
+   -1045,   960,   961,   963,   965,   894, -1045,   895, -1045, -1045,
+     966,   896,   967,   897, -1045, -1045, -1045, -1045, -1045,   314,
+     314,   314,   314,   314,   314,   314, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     898,   900,   901,   -39,   902,   903,   904,   905,   906,   907,
+     908,   909,   910,   911,   361,   912,   913, -1045,   914,   915,
+     916,   917,   918,   919,   920,   201,   921,   922,   923,   924,
+     925,   927,   930, -1045,   933,   934, -1045, -1045,   935,   936,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045,   593,   593,   593, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045,  -193, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045,  -188, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     938,   941,   568,   942,   946,   950,   956,   957, -1045,   958,
+     959, -1045,   962,   964,   -16,   972,   968, -1045, -1045, -1045,
+   -1045,   969,   970, -1045,   971,   973,   375,   974,   975,   976,
+     977,   712,   978,   979, -1045,   980,   981,   982, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,  -177, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045,   983,   594, -1045, -1045,   984,   985,   986,
+   -1045,    82, -1045, -1045, -1045, -1045,   987,   990,   991,   992,
+   -1045, -1045,   993,   767,   994, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,  -169, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     838,   838,   838, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,   -86, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045,   753, -1045,   664, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+      42, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045,    68, -1045,   998,   947,   995, -1045,
+   -1045, -1045, -1045, -1045, -1045,   891, -1045,   996,   997, -1045,
+   -1045,   999,  1000, -1045, -1045,  1001, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,    97, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,   127, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045,   259, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,   148, -1045, -1045,  1034,
+    -105,  1004,  1003, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,   155,
+   -1045, -1045, -1045,   -39, -1045, -1045, -1045, -1045,   201, -1045,
+   -1045, -1045,   568, -1045,   -16, -1045, -1045, -1045,  1030,   988,
+    1031,   989,  1033,  1039, -1045,   375, -1045,   712, -1045, -1045,
+     594,  1008,  1009,  1010,   281, -1045, -1045,   767, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045,   169, -1045, -1045, -1045,   281, -1045
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1448,213 +1458,214 @@ static const yytype_int16 yypact[] =
      means the default is an error.  */
 static const yytype_uint16 yydefact[] =
 {
-       2,     0,     1,     0,     0,     0,   247,   410,   458,     0,
-     473,     0,   313,   449,   289,     0,   113,   165,   347,     0,
-       0,   388,     0,   122,     0,   364,     3,    23,    11,     4,
+       2,     0,     1,     0,     0,     0,   253,   416,   466,     0,
+     481,     0,   319,   457,   295,     0,   119,   171,   353,     0,
+       0,   394,     0,   128,     0,   370,     3,    23,    11,     4,
       24,    25,     5,     6,     8,     9,    10,    13,    14,    15,
       16,    17,    18,    19,    20,    22,    21,     7,    12,    26,
       27,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   105,   106,
-     108,   107,   646,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   632,   645,   634,
-     635,   636,   637,   638,   639,   640,   641,   642,   633,   643,
-     644,     0,     0,     0,   471,     0,     0,   469,   470,     0,
-     532,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   111,   112,
+     114,   113,   656,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   642,   655,   644,
+     645,   646,   647,   648,   649,   650,   651,   652,   643,   653,
+     654,     0,     0,     0,   479,     0,     0,   477,   478,     0,
+     541,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   612,   586,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   602,   576,     0,
+     492,   493,   494,   538,   539,   501,   540,   533,   534,   535,
+     536,   532,   505,   495,   496,   497,   498,   499,   500,   502,
+     503,   504,   506,   507,   537,   511,   512,   513,   514,   510,
+     509,   515,   522,   523,   516,   517,   518,   508,   520,   530,
+     531,   528,   529,   521,   519,   526,   527,   524,   525,     0,
+       0,     0,     0,     0,     0,     0,    52,    53,    54,     0,
+       0,     0,   682,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   672,   673,   674,   675,   676,   677,   678,
+     680,   679,   681,     0,     0,     0,     0,     0,    88,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   484,
-     485,   486,   530,   493,   531,   525,   526,   527,   528,   524,
-     497,   487,   488,   489,   490,   491,   492,   494,   495,   496,
-     498,   499,   529,   503,   504,   505,   506,   502,   501,   507,
-     514,   515,   508,   509,   510,   500,   512,   522,   523,   520,
-     521,   513,   511,   518,   519,   516,   517,     0,     0,     0,
-       0,     0,     0,     0,    46,    47,    48,     0,     0,     0,
-     672,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   662,   663,   664,   665,   666,   667,   668,   670,   669,
-     671,     0,     0,     0,     0,     0,    82,     0,     0,     0,
+       0,     0,     0,     0,     0,    60,    75,    72,    70,    76,
+      77,    71,    78,    79,    80,    61,    74,    64,    65,    66,
+      62,    73,    67,    68,    69,    63,     0,     0,     0,     0,
+     143,   144,   145,     0,     0,   368,     0,     0,   366,   367,
+       0,   115,     0,     0,     0,     0,   110,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    54,    69,    66,    64,    70,    71,    65,
-      72,    73,    74,    55,    68,    58,    59,    60,    56,    67,
-      61,    62,    63,    57,     0,     0,     0,     0,   137,   138,
-     139,     0,     0,   362,     0,     0,   360,   361,     0,   109,
-       0,     0,     0,     0,   104,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   631,
-       0,     0,     0,     0,   283,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   250,   251,
-     254,   256,   257,   258,   259,   260,   261,   262,   263,   252,
-     253,   255,   264,   265,   266,     0,     0,     0,     0,     0,
-       0,     0,   438,     0,     0,     0,     0,     0,     0,     0,
-       0,   413,   414,   415,   416,   417,   418,   419,   421,   420,
-     423,   427,   424,   425,   426,   422,   464,     0,     0,     0,
-     461,   462,   463,     0,     0,   468,   479,     0,     0,     0,
-     476,   477,   478,     0,     0,     0,     0,     0,     0,     0,
+       0,   641,     0,     0,     0,     0,   289,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     256,   257,   260,   262,   263,   264,   265,   266,   267,   268,
+     269,   258,   259,   261,   270,   271,   272,     0,     0,     0,
+       0,     0,     0,     0,   444,     0,     0,     0,     0,     0,
+       0,     0,     0,   419,   420,   421,   422,   423,   424,   425,
+     427,   426,   429,   433,   430,   431,   432,   428,   472,     0,
+       0,     0,   469,   470,   471,     0,     0,   476,   487,     0,
+       0,     0,   484,   485,   486,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   483,     0,     0,     0,   330,     0,     0,     0,     0,
-       0,     0,   316,   317,   318,   319,   324,   320,   321,   322,
-     323,   455,     0,     0,     0,   452,   453,   454,     0,     0,
-       0,   291,     0,   301,     0,   299,   300,   302,   303,    49,
-       0,     0,     0,    45,     0,     0,     0,     0,   116,   117,
-     118,     0,     0,     0,   214,     0,     0,     0,     0,   188,
-       0,     0,     0,   168,   169,   170,   171,   172,   175,   176,
-     177,   174,   173,   178,     0,     0,     0,     0,     0,   350,
-     351,   352,   353,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   661,    75,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    53,     0,     0,   396,
-       0,   391,   392,   393,   140,     0,     0,   136,     0,     0,
-       0,     0,     0,     0,     0,   125,   126,   128,   127,   129,
-       0,     0,   359,     0,     0,   374,     0,     0,   367,   368,
-     369,   370,     0,     0,     0,   103,     0,    28,     0,     0,
+       0,     0,     0,     0,   491,     0,     0,     0,   336,     0,
+       0,     0,     0,     0,     0,   322,   323,   324,   325,   330,
+     326,   327,   328,   329,   463,     0,     0,     0,   460,   461,
+     462,     0,     0,     0,   297,     0,   307,     0,   305,   306,
+     308,   309,    55,     0,     0,     0,    51,     0,     0,     0,
+       0,   122,   123,   124,     0,     0,     0,   220,     0,     0,
+       0,     0,   194,     0,     0,     0,   174,   175,   176,   177,
+     178,   181,   182,   183,   180,   179,   184,     0,     0,     0,
+       0,     0,   356,   357,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   671,    81,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     630,   267,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   249,
-     428,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   412,     0,     0,     0,
-     460,     0,   467,     0,     0,     0,   475,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    59,
+       0,     0,   402,     0,   397,   398,   399,   146,     0,     0,
+     142,     0,     0,     0,     0,     0,     0,     0,   131,   132,
+     134,   133,   135,     0,     0,   365,     0,     0,   380,     0,
+       0,   373,   374,   375,   376,     0,     0,     0,   109,     0,
+      28,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   640,   273,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   255,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   418,
+       0,     0,     0,   468,     0,   475,     0,     0,     0,   483,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    44,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   482,   325,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   315,     0,     0,
-       0,   451,   304,     0,     0,     0,     0,     0,   298,     0,
-       0,    44,   119,     0,     0,     0,   115,   179,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   167,
-     354,     0,     0,     0,     0,   349,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   660,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    52,   394,     0,     0,
-       0,   390,     0,   135,     0,   130,     0,     0,     0,     0,
-       0,   124,     0,   358,   371,     0,     0,     0,     0,   366,
-     112,   111,   110,   658,    28,    28,    28,    28,    28,    28,
-      28,    30,    29,   659,   647,   648,   649,   650,   651,   652,
-     653,   654,   657,   655,   656,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    38,
-       0,     0,   248,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   411,     0,
-       0,   459,   472,     0,     0,   474,   546,   550,   533,   534,
-     565,   537,   628,   629,   573,   538,   539,   570,   545,   544,
-     553,   543,   540,   541,   549,   548,   547,   571,   535,   626,
-     627,   569,   612,   606,   622,   607,   608,   609,   617,   625,
-     610,   619,   623,   613,   624,   614,   618,   611,   621,   616,
-     615,   620,     0,   605,   585,   586,   587,   580,   598,   581,
-     582,   583,   593,   601,   584,   595,   599,   589,   600,   590,
-     594,   588,   597,   592,   591,   596,     0,   579,   566,   564,
-     567,   572,   568,   555,   562,   563,   560,   561,   556,   557,
-     558,   559,   574,   575,   542,   552,   551,   554,   536,     0,
-       0,     0,     0,     0,     0,     0,     0,   314,     0,     0,
-     450,     0,     0,     0,   309,   305,   308,   290,    50,    51,
-       0,     0,   114,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   166,     0,     0,     0,   348,   676,   673,
-     674,   675,   680,   679,   681,   677,   678,    99,    94,   102,
-      93,    89,    87,    88,    86,     0,    85,    90,    91,   100,
-     101,    92,    96,    95,    77,    76,    81,    78,    80,    79,
-      97,    98,     0,     0,   389,   141,     0,     0,     0,   153,
-       0,   145,   146,   148,   147,     0,     0,     0,     0,   123,
-     363,     0,     0,     0,   365,    31,    32,    33,    34,    35,
-      36,    37,   278,   279,   271,   288,   287,     0,   286,   272,
-     274,   282,   275,   273,   281,   268,   280,   270,   269,    38,
-      38,    38,    40,    39,   276,   277,   433,   436,   437,   447,
-     444,   430,   445,   442,   443,     0,   441,   446,   429,   435,
-     432,   434,   448,   431,   465,   466,   480,   481,   603,     0,
-     577,     0,   328,   329,   339,   335,   336,   338,   343,   340,
-     341,   334,   342,   337,     0,   333,   327,   346,   345,   344,
-     326,   457,   456,   312,   311,   296,   297,   295,     0,   294,
-       0,     0,     0,   120,   121,   187,   184,   234,   246,   221,
-     230,     0,   219,   224,   240,     0,   233,   238,   244,   223,
-     226,   235,   237,   241,   231,   239,   227,   245,   229,   236,
-     225,   228,     0,   217,   180,   182,   185,   186,   197,   198,
-     199,   192,   210,   193,   194,   195,   205,   213,   196,   207,
-     211,   201,   212,   202,   206,   200,   209,   204,   203,   208,
-       0,   191,   181,   183,   357,   355,   356,    83,     0,   395,
-     400,   406,   409,   402,   408,   403,   407,   405,   401,   404,
-       0,   399,   149,     0,     0,     0,     0,   144,   132,   131,
-     133,   134,   372,   378,   384,   387,   380,   386,   381,   385,
-     383,   379,   382,     0,   377,   373,   284,     0,    41,    42,
-      43,   439,     0,   604,   578,   331,     0,   292,     0,   310,
-     307,   306,     0,     0,     0,     0,     0,     0,   215,     0,
-     189,     0,    84,   397,     0,     0,     0,     0,     0,   143,
-     375,     0,   285,   440,   332,   293,   220,   243,   218,   242,
-     232,   222,   216,   190,   398,   150,   152,   151,   163,   162,
-     158,   160,   164,   161,   157,   159,     0,   156,   376,   154,
-       0,   155
+       0,   490,   331,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   321,     0,     0,     0,   459,   310,     0,     0,
+       0,     0,     0,   304,     0,     0,    50,   125,     0,     0,
+       0,   121,   185,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   173,   360,     0,     0,     0,     0,
+     355,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     670,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    58,   400,     0,     0,     0,   396,     0,   141,     0,
+     136,     0,     0,     0,     0,     0,   130,     0,   364,   377,
+       0,     0,     0,     0,   372,   118,   117,   116,   668,    28,
+      28,    28,    28,    28,    28,    28,    30,    29,   669,   657,
+     658,   659,   660,   661,   662,   663,   664,   667,   665,   666,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    38,     0,     0,   254,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   417,     0,     0,   467,   480,     0,     0,
+     482,   556,   560,   542,   543,   575,   547,   638,   639,   583,
+     548,   549,   580,   555,   554,   563,   553,   550,   551,   559,
+     558,   557,   581,   544,    44,    44,    44,    46,    45,   545,
+     636,   637,   579,   622,   616,   632,   617,   618,   619,   627,
+     635,   620,   629,   633,   623,   634,   624,   628,   621,   631,
+     626,   625,   630,     0,   615,   595,   596,   597,   590,   608,
+     591,   592,   593,   603,   611,   594,   605,   609,   599,   610,
+     600,   604,   598,   607,   602,   601,   606,     0,   589,   576,
+     574,   577,   582,   578,   565,   572,   573,   570,   571,   566,
+     567,   568,   569,   584,   585,   552,   562,   561,   564,   546,
+       0,     0,     0,     0,     0,     0,     0,     0,   320,     0,
+       0,   458,     0,     0,     0,   315,   311,   314,   296,    56,
+      57,     0,     0,   120,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   172,     0,     0,     0,   354,   686,
+     683,   684,   685,   690,   689,   691,   687,   688,   105,   100,
+     108,    99,    95,    93,    94,    92,     0,    91,    96,    97,
+     106,   107,    98,   102,   101,    83,    82,    87,    84,    86,
+      85,   103,   104,     0,     0,   395,   147,     0,     0,     0,
+     159,     0,   151,   152,   154,   153,     0,     0,     0,     0,
+     129,   369,     0,     0,     0,   371,    31,    32,    33,    34,
+      35,    36,    37,   284,   285,   277,   294,   293,     0,   292,
+     278,   280,   288,   281,   279,   287,   274,   286,   276,   275,
+      38,    38,    38,    40,    39,   282,   283,   439,   442,   443,
+     455,   452,   436,   453,   448,   449,   450,   451,     0,   447,
+     454,   435,   441,   438,   440,   456,   437,   473,   474,   488,
+     489,    47,    48,    49,   613,     0,   587,     0,   334,   335,
+     345,   341,   342,   344,   349,   346,   347,   340,   348,   343,
+       0,   339,   333,   352,   351,   350,   332,   465,   464,   318,
+     317,   302,   303,   301,     0,   300,     0,     0,     0,   126,
+     127,   193,   190,   240,   252,   227,   236,     0,   225,   230,
+     246,     0,   239,   244,   250,   229,   232,   241,   243,   247,
+     237,   245,   233,   251,   235,   242,   231,   234,     0,   223,
+     186,   188,   191,   192,   203,   204,   205,   198,   216,   199,
+     200,   201,   211,   219,   202,   213,   217,   207,   218,   208,
+     212,   206,   215,   210,   209,   214,     0,   197,   187,   189,
+     363,   361,   362,    89,     0,   401,   406,   412,   415,   408,
+     414,   409,   413,   411,   407,   410,     0,   405,   155,     0,
+       0,     0,     0,   150,   138,   137,   139,   140,   378,   384,
+     390,   393,   386,   392,   387,   391,   389,   385,   388,     0,
+     383,   379,   290,     0,    41,    42,    43,   445,     0,   614,
+     588,   337,     0,   298,     0,   316,   313,   312,     0,     0,
+       0,     0,     0,     0,   221,     0,   195,     0,    90,   403,
+       0,     0,     0,     0,     0,   149,   381,     0,   291,   446,
+     338,   299,   226,   249,   224,   248,   238,   228,   222,   196,
+     404,   156,   158,   157,   169,   168,   164,   166,   170,   167,
+     163,   165,     0,   162,   382,   160,     0,   161
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -978,  -978,  -978,  -293,  -314,  -977,  -646,  -978,  -978,   991,
-    -978,  -978,  -978,  -978,   877,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,   -99,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    1069,  -978,  -978,  -978,  -978,  -978,  -978,   656,  -978,  -978,
-    -978,  -978,  -978,   455,  -978,  -978,  -978,  -978,  -978,  -978,
-     952,  -978,  -978,  -978,  -978,    96,  -978,  -978,  -978,  -978,
-    -978,  -193,  -978,  -978,  -978,   631,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -145,  -978,  -978,
-    -978,  -132,  -978,  -978,  -978,   969,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -108,  -978,  -978,  -978,  -978,  -978,
-    -115,  -978,   691,  -978,  -978,  -978,     9,  -978,  -978,  -978,
-    -978,  -978,   713,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -105,  -978,  -978,  -978,  -978,  -978,  -978,   663,  -978,  -978,
-    -978,  -978,  -978,   986,  -978,  -978,  -978,  -978,   596,  -978,
-    -978,  -978,  -978,  -978,   -98,  -978,  -978,  -978,   632,  -978,
-    -978,  -978,  -978,   -89,  -978,  -978,  -978,   873,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   -66,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,   744,  -978,
-    -978,  -978,  -978,  -978,   840,  -978,  -978,  -978,  -978,  1113,
-    -978,  -978,  -978,  -978,   988,  -978,  -978,  -978,  -978,  1062,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,    90,  -978,  -978,  -978,    93,  -978,
-    -978,  -978,  -978,  -978,  -978,  1137,  -978,  -978,  -978,  -978,
-    -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978,   994,  -978,  -978,  -978,  -978,  -978,  -978,  -978,  -978,
-    -978
+   -1045, -1045, -1045,   -48,  -316, -1044,  -649,  -523,   645, -1045,
+   -1045,  1011, -1045, -1045, -1045, -1045,  1002, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,  -175, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045,  1023, -1045, -1045, -1045, -1045, -1045, -1045,   591,
+   -1045, -1045, -1045, -1045, -1045,   582, -1045, -1045, -1045, -1045,
+   -1045, -1045,  1005, -1045, -1045, -1045, -1045,    91, -1045, -1045,
+   -1045, -1045, -1045,  -223, -1045, -1045, -1045,   655, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,  -133,
+   -1045, -1045, -1045,  -132, -1045, -1045, -1045,  1006, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045,  -108, -1045, -1045, -1045,
+   -1045, -1045,  -117, -1045,   692, -1045, -1045, -1045,     1, -1045,
+   -1045, -1045, -1045, -1045,   717, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045,  -110, -1045, -1045, -1045, -1045, -1045, -1045,   652,
+   -1045, -1045, -1045, -1045, -1045,   899, -1045, -1045, -1045, -1045,
+     598, -1045, -1045, -1045, -1045, -1045,  -126, -1045, -1045, -1045,
+     611, -1045, -1045, -1045, -1045,  -125, -1045, -1045, -1045,   821,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045,   -93, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+     720, -1045, -1045, -1045, -1045, -1045,   825, -1045, -1045, -1045,
+   -1045,  1109, -1045, -1045, -1045, -1045,  1007, -1045, -1045, -1045,
+   -1045,  1068, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045,    83, -1045, -1045,
+   -1045,    84, -1045, -1045, -1045, -1045, -1045, -1045,  1142, -1045,
+   -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045,  1012, -1045, -1045, -1045, -1045, -1045,
+   -1045, -1045, -1045, -1045
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    26,   841,   842,  1112,  1113,    27,   223,   224,
-     225,   226,    28,   272,   273,   274,   275,   276,   277,   278,
-     279,   280,   559,  1045,  1046,   281,   282,   283,   284,   285,
-     286,   287,   288,   289,   290,   291,   292,   293,    29,    77,
-      78,    79,    80,    81,    30,    63,   507,   508,   509,   510,
-      31,    70,   594,   595,   596,   597,   598,   599,    32,   297,
-     298,   299,   300,   301,  1070,  1071,  1072,  1073,  1074,  1255,
-    1336,  1337,    33,    64,   522,   523,   524,   525,   526,   527,
-     528,   529,   530,   531,   532,   765,  1230,  1231,   533,   760,
-    1202,  1203,    34,    53,   347,   348,   349,   350,   351,   352,
+      -1,     1,    26,   846,   847,  1123,  1124,   927,   928,    27,
+     225,   226,   227,   228,    28,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   562,  1056,  1057,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+      29,    77,    78,    79,    80,    81,    30,    63,   510,   511,
+     512,   513,    31,    70,   597,   598,   599,   600,   601,   602,
+      32,   299,   300,   301,   302,   303,  1081,  1082,  1083,  1084,
+    1085,  1271,  1352,  1353,    33,    64,   525,   526,   527,   528,
+     529,   530,   531,   532,   533,   534,   535,   770,  1246,  1247,
+     536,   765,  1218,  1219,    34,    53,   349,   350,   351,   352,
      353,   354,   355,   356,   357,   358,   359,   360,   361,   362,
-     363,   364,   635,  1097,  1098,    35,    61,   493,   745,  1168,
-    1169,   494,   495,   496,  1172,  1005,  1006,   497,   498,    36,
-      59,   471,   472,   473,   474,   475,   476,   477,   730,  1154,
-    1155,   478,   479,   480,    37,    65,   538,   539,   540,   541,
-     542,    38,   305,   306,   307,    39,    72,   607,   608,   609,
-     610,   611,   826,  1273,  1274,    40,    68,   580,   581,   582,
-     583,   809,  1250,  1251,    41,    54,   380,   381,   382,   383,
-     384,   385,   386,   387,   388,   389,   390,   657,  1125,  1126,
-     391,   392,   393,   394,   395,    42,    60,   484,   485,   486,
-     487,    43,    55,   399,   400,   401,   402,    44,   116,   117,
-     118,    45,    57,   409,   410,   411,   412,    46,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   440,   966,   967,   212,   439,   942,   943,   213,
-     214,   215,   216,    47,    96,    97,    98,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,    48,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250
+     363,   364,   365,   366,   638,  1108,  1109,    35,    61,   496,
+     750,  1184,  1185,   497,   498,   499,  1188,  1016,  1017,   500,
+     501,    36,    59,   474,   475,   476,   477,   478,   479,   480,
+     735,  1170,  1171,   481,   482,   483,    37,    65,   541,   542,
+     543,   544,   545,    38,   307,   308,   309,    39,    72,   610,
+     611,   612,   613,   614,   831,  1289,  1290,    40,    68,   583,
+     584,   585,   586,   814,  1266,  1267,    41,    54,   382,   383,
+     384,   385,   386,   387,   388,   389,   390,   391,   392,   660,
+    1138,  1139,   393,   394,   395,   396,   397,    42,    60,   487,
+     488,   489,   490,    43,    55,   401,   402,   403,   404,    44,
+     116,   117,   118,    45,    57,   411,   412,   413,   414,    46,
+     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   443,   977,   978,   214,   442,
+     953,   954,   215,   216,   217,   218,    47,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,    48,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1662,505 +1673,511 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     870,   871,   618,   589,  1123,   621,   622,   623,    73,   625,
-     626,   295,   504,   488,   603,   303,   295,   504,   396,  1095,
-    1165,   711,    49,    50,  1066,   712,   396,   114,   481,   406,
-     114,   220,    51,   534,    52,   713,   481,  1041,    74,   714,
-      56,   534,   869,    58,   303,    62,    75,  1109,  1110,  1111,
-      66,   365,   120,   366,   577,   367,   406,   121,   122,   603,
-     123,   124,  1138,  1140,  1237,   125,  1139,  1141,  1238,   489,
-     368,   874,   875,   577,   535,   126,   127,   128,   490,    67,
-     491,  1066,   535,   397,   129,    69,   220,   130,   131,   132,
-     369,   397,   115,    71,   133,   115,   505,  1096,   111,   112,
-     678,   505,   680,   681,  1276,   113,   684,   370,  1277,   371,
-     590,   134,   135,   119,   692,    76,   217,   536,   372,   697,
-    1042,   604,   304,   136,  1043,   536,   137,   138,   706,   707,
-     373,  1067,  1278,  1279,  1280,   221,   407,   139,  1306,   218,
-     720,   492,   722,   723,   140,   219,   141,   227,   142,   398,
-     143,   304,   869,   144,   145,   251,   222,   398,   374,   482,
-     408,   578,   511,   407,   537,   146,   604,   482,  1166,   228,
-     147,   148,   537,   149,   150,   151,   591,  1167,   152,   375,
-     578,   512,  1044,   252,   229,   253,   294,   408,  1067,  1281,
-     221,  -142,   506,  1282,   592,  1285,  -142,   506,   376,  1286,
-     589,   513,  1124,   153,  1287,  1298,   309,   377,  1288,  1299,
-     593,   222,   254,   302,   154,   155,   156,   157,   158,   159,
-     160,   308,  1300,   255,  1303,  1068,  1301,   499,  1304,   514,
-    1310,   778,   310,   616,  1311,   256,   257,   258,   296,   605,
-     820,   330,   606,   296,   311,   313,   312,   588,   259,  1069,
-     747,   828,   260,   586,   755,   669,   483,   378,   331,   332,
-     612,  1256,   261,   333,   483,   262,   263,   404,   502,   515,
-     161,   162,   163,   740,   164,   165,    82,   462,   774,   579,
-     379,   601,  1068,   166,   605,   167,   516,   606,   665,   460,
-     617,   810,   315,   675,   264,   620,   463,  1328,   579,  1329,
-     316,  1339,    83,    84,    73,  1340,  1069,   590,   334,    85,
-     265,   317,   554,   266,   267,   268,   464,   318,   517,   518,
-     857,   319,   320,   321,   861,   584,   322,   864,   335,   336,
-     337,   868,   338,   230,    74,   323,   339,    86,    87,    88,
-      89,   340,    75,   324,   465,   325,   326,  1330,   341,   327,
-     403,   413,    90,    91,    92,   414,   415,   342,   343,   416,
-     417,   269,    93,    94,  1331,   418,    95,   231,   344,   419,
-     519,   420,  1144,   591,   421,   422,   232,   233,   234,   423,
-     424,   235,   236,   425,   270,   271,   237,   238,   239,   345,
-     520,   592,   575,   511,   521,   426,   462,   488,  1145,   768,
-     427,   466,   428,  1332,  1333,   429,   430,   593,   431,   467,
-     468,    76,   512,   432,   120,   463,   433,   434,   435,   121,
-     122,   436,   123,   124,   437,   438,   441,   125,   442,   469,
-     443,  1146,   513,   444,   346,   464,   445,   126,   127,   128,
-     446,   447,   448,   449,   450,   451,   129,   452,   453,   130,
-     131,   132,  1177,   489,   454,  1334,   133,  1240,   455,   456,
-     514,  1335,   490,   465,   491,   457,  1147,  1148,   458,  1178,
-    1179,   459,  1149,   134,   135,   500,   501,   543,   648,   544,
-    1180,   545,   546,   547,   548,   136,   549,   550,   137,   138,
-     551,   555,   556,   557,   558,   560,  1150,   561,   562,   139,
-     515,   563,   564,   565,   566,   470,   140,   567,   141,   568,
-     142,  1151,   143,   328,   736,   144,   145,   516,  1181,  1182,
-     466,  1183,  1241,   569,   570,   492,   571,   146,   467,   468,
-     572,   573,   147,   148,   574,   149,   150,   151,   585,   600,
-     152,  1085,  1086,  1087,  1088,  1089,  1090,  1091,   469,   517,
-     518,   613,   614,  1184,  1242,   615,   619,   624,   627,   628,
-     251,  1185,  1243,   629,   630,   153,   631,   650,   632,   671,
-     552,  1244,   679,   633,  1152,   634,   154,   155,   156,   157,
-     158,   159,   160,  1186,   636,  1187,  1188,   637,   252,   638,
-     253,   639,   640,  1153,   641,  1245,   642,  1246,  1247,   643,
-     644,   519,   645,  1189,   646,   647,   651,   652,  1307,   653,
-     654,  1248,   655,   656,   658,   659,   660,   254,   661,  1249,
-     662,   520,   663,   664,   470,   521,  1190,   667,   255,   668,
-     672,  1191,   161,   162,   163,  1192,   164,   165,   673,  1193,
-     256,   257,   258,   674,  1194,   166,   677,   167,  1195,   682,
-     365,   683,   366,   259,   367,   685,   686,   260,   687,  1196,
-     688,  1197,  1198,   689,  1199,   693,   694,   261,   690,   368,
-     262,   263,   691,   695,   696,  1200,   698,   699,   700,   701,
-       2,     3,   702,  1201,     4,   705,   703,   230,   708,   369,
-     709,   704,   710,   715,   716,   717,     5,   718,   719,   264,
-       6,   721,     7,   724,   725,   726,   370,   749,   371,   728,
-       8,   729,   776,   731,   750,   265,   330,   372,   266,   267,
-     268,   231,     9,   727,   732,   742,   751,    10,    11,   373,
-     232,   233,   234,   331,   332,   235,   236,   733,   333,   734,
-     237,   238,   239,   617,   735,   738,   739,    12,   743,   744,
-     746,    13,   752,   753,   754,   757,   758,   374,    82,   759,
-     944,   761,   945,   946,    14,   762,   269,   763,   834,   835,
-     836,   837,   838,   839,   840,   770,   764,   766,   375,   767,
-     779,   771,   777,   334,    83,    84,    15,    16,   772,   270,
-     271,    85,   773,   780,   781,   786,   782,   376,   783,   784,
-     787,    17,   785,   335,   336,   337,   377,   338,   788,   790,
-    1208,   339,  1209,  1210,   789,   791,   340,   792,    18,    86,
-      87,    88,    89,   341,   793,   794,   795,   796,   797,   798,
-      19,    20,   342,   343,    90,    91,    92,   799,   806,   807,
-     800,   812,   801,   344,    93,    94,   802,   803,    95,   804,
-     922,   805,   808,   813,   814,    21,   378,   815,   816,   817,
-     822,   818,   819,   823,   345,   824,   855,   856,    22,   825,
-     827,   830,   831,    23,   832,   833,   843,   844,    24,   379,
-     845,    25,   947,   948,   949,   846,   858,   950,   951,  1263,
-     952,   953,   847,   954,   848,   955,   849,   850,   956,   851,
-     957,   958,   852,   853,   854,   859,   959,   860,   862,   346,
-     960,   863,   865,   866,   961,   962,   963,   873,   867,   869,
-     872,   964,   877,   876,   878,   883,   965,   888,   879,   880,
-     881,   891,  1211,  1212,  1213,   882,   884,  1214,  1215,   892,
-    1216,  1217,   885,  1218,   886,  1219,   990,   887,  1220,   889,
-    1221,  1222,   890,   893,  1264,   894,  1223,   895,   989,   896,
-    1224,   897,   898,   899,  1225,  1226,  1227,   991,   900,   901,
-     902,  1228,   923,   924,   925,   903,  1229,   926,   927,   904,
-     928,   929,   905,   930,   906,   931,  1265,   992,   932,   907,
-     933,   934,   908,   909,  1266,   910,   935,   911,   993,   912,
-     936,   913,   914,  1267,   937,   938,   939,   915,   916,   917,
-     918,   940,   919,   920,   921,   968,   941,   969,   970,   994,
-     971,   972,   973,   974,   995,   975,   996,  1268,   998,  1269,
-    1270,   999,  1001,   976,  1002,  1004,   977,  1010,  1011,  1013,
-    1016,   978,  1017,  1271,   979,   980,  1018,   981,   982,   821,
-     983,  1272,   984,  1014,  1019,   985,  1021,   986,   987,  1022,
-    1024,   988,  1025,   997,  1000,  1026,  1062,  1007,  1008,  1003,
-    1009,  1012,  1015,  1075,  1076,  1023,  1027,  1020,  1028,  1029,
-    1030,  1031,  1032,  1033,  1034,  1035,  1036,  1037,  1038,  1039,
-    1040,  1047,  1048,  1049,  1077,  1050,  1051,  1052,  1053,  1054,
-    1055,  1056,  1057,  1058,  1059,  1060,  1061,  1078,  1064,  1065,
-    1063,  1079,  1080,  1081,  1083,  1084,  1082,  1092,  1093,  1253,
-    1094,  1099,  1100,  1101,  1102,  1103,  1289,  1104,  1105,  1106,
-    1107,  1305,  1108,  1316,  1114,  1318,  1115,  1116,  1317,  1302,
-    1117,  1319,  1118,  1119,  1320,  1321,   314,  1341,  1120,   576,
-    1121,  1122,  1127,   769,  1128,  1129,  1323,  1130,  1131,  1132,
-    1133,  1134,  1135,   756,  1136,  1137,  1257,  1322,  1142,  1312,
-    1143,  1156,  1170,  1315,  1157,  1158,  1159,  1160,  1161,  1162,
-    1290,  1314,  1163,  1164,   737,   748,  1173,  1174,  1175,  1171,
-    1176,  1204,  1205,  1206,  1207,  1232,  1233,  1234,  1235,  1236,
-    1239,   775,  1252,   829,  1258,  1259,  1254,  1260,  1261,  1262,
-    1275,  1291,   811,  1338,   503,  1324,  1313,  1292,  1293,  1309,
-    1294,  1295,  1296,  1297,  1325,  1308,  1326,  1327,   741,   405,
-     461,  1284,  1283,   329,   553,     0,     0,     0,     0,   670,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   587,
-       0,     0,     0,   666,     0,     0,     0,     0,     0,     0,
+     875,   876,   621,   114,    73,   624,   625,   626,    51,   628,
+     629,   507,   120,   874,  1077,  1106,   305,   121,   122,   537,
+     123,   124,   580,   491,   398,   125,   114,   297,   222,   491,
+     484,    49,    50,   222,  1181,    74,   126,   127,   128,   537,
+     716,    52,   718,    75,   717,   129,   719,  1154,   130,   131,
+     132,  1155,  1156,   606,   311,   133,  1157,   606,   408,   879,
+     880,   538,   305,  1253,   484,   312,   297,  1254,    56,   115,
+      58,  1292,   134,   135,   408,  1293,  1294,  1295,  1296,    62,
+     492,   538,   465,  1077,   136,    66,   492,   137,   138,   493,
+     399,   494,   115,    67,  1107,   493,   508,   494,   139,    69,
+     681,   466,   683,   684,   539,   140,   687,   141,    71,   142,
+    1322,   143,   144,    76,   695,   145,   146,   253,   580,   700,
+     111,   112,   467,  1078,   539,   306,   113,   147,   119,   711,
+     712,   581,   148,   149,   223,   150,   151,   152,   219,   223,
+     153,   725,   592,   727,   728,   367,   254,   368,   255,   369,
+     468,   332,   540,   495,  1297,   224,   313,   400,  1298,   495,
+     224,   220,   607,   485,   370,   154,   607,   409,   333,   334,
+     221,   306,   540,   229,   335,   256,   155,   156,   157,   158,
+     159,   160,   161,   409,  1182,   371,   257,   507,   230,   231,
+     592,   410,  1078,  1183,   509,   296,   304,   485,   258,   259,
+     260,   310,   372,   314,   373,   514,   317,   410,   469,  1134,
+    -148,   261,   318,   374,   319,   262,   470,   471,  1079,   336,
+     924,   925,   926,  1135,   515,   375,   263,   581,    82,   264,
+     265,   320,   783,   162,   163,   164,   472,   165,   166,   337,
+     338,   339,  1080,   340,   315,   516,   167,   341,   168,  -148,
+     582,   593,   463,   342,   376,    83,    84,   298,   266,   779,
+     343,   486,    85,   752,   672,   615,   406,   589,   505,   344,
+     345,   502,   508,   517,   267,   377,  1052,   268,   269,   270,
+     346,   608,  1301,   321,   609,   608,  1302,  1079,   609,   232,
+      86,    87,    88,    89,   378,   486,   298,   833,   678,   593,
+     557,   347,   604,   379,   745,    90,    91,    92,  1303,   322,
+     398,  1080,  1304,   473,   518,    93,    94,   323,   594,    95,
+      73,   862,   741,  1272,   233,   866,   271,   703,   869,   514,
+     324,   519,   873,   234,   235,   236,   595,  1314,   237,   238,
+     587,  1315,   325,   239,   240,   241,   582,   348,   515,   272,
+     273,    74,   596,  1344,   380,  1345,   326,   578,   815,    75,
+     591,  1053,   327,   520,   521,  1054,   594,  1316,   328,   516,
+     509,  1317,  1120,  1121,  1122,  1136,   399,   381,   329,  1193,
+     405,   120,   825,   415,   595,   668,   121,   122,  1319,   123,
+     124,   651,  1320,   616,   125,  1326,  1194,   517,  1195,  1327,
+     596,  1151,  1152,  1153,  1346,   126,   127,   128,  1196,  1355,
+    1137,   416,   619,  1356,   129,   417,   522,   130,   131,   132,
+     418,  1347,   419,  1055,   133,   420,   421,   760,   422,    76,
+     423,   424,   620,   425,   426,   427,   523,   428,   518,   429,
+     524,   134,   135,   400,   623,   773,  1197,  1198,   430,  1199,
+     431,   432,   618,   136,   433,   519,   137,   138,   434,   435,
+     436,  1348,  1349,   437,   438,   439,   440,   139,   330,   441,
+     617,   444,   445,   446,   140,   447,   141,   448,   142,   874,
+     143,   144,  1200,   449,   145,   146,   450,   520,   521,   451,
+    1201,   452,   453,   454,   455,   456,   147,   457,   465,   253,
+     458,   148,   149,   459,   150,   151,   152,   460,   461,   153,
+     462,   503,  1202,  1350,  1203,  1204,   504,   466,   367,  1351,
+     368,   546,   369,   547,   622,   548,   549,   550,   254,   555,
+     255,   627,  1205,   551,   154,   552,   553,   370,   467,   554,
+     522,   558,   559,   560,   561,   155,   156,   157,   158,   159,
+     160,   161,   630,   563,   564,   565,  1206,   256,   371,   566,
+     523,  1207,   631,   567,   524,  1208,   468,   568,   257,  1209,
+     569,   632,   570,   571,  1210,   372,   572,   373,  1211,   573,
+     258,   259,   260,  1160,   574,   575,   374,   576,   577,  1212,
+     588,  1213,  1214,   261,  1215,   603,   633,   262,   375,   634,
+     635,   636,   162,   163,   164,  1216,   165,   166,   263,   637,
+    1161,   264,   265,  1217,   639,   167,   640,   168,   653,   641,
+     642,  1323,   643,   674,   469,   644,   645,   376,   646,   647,
+     648,   649,   470,   471,     2,     3,   650,   654,     4,   655,
+     266,   656,   657,  1162,   658,   659,   661,   662,   377,   663,
+       5,   664,   472,   665,     6,   666,   267,     7,   667,   268,
+     269,   270,   670,   671,   675,     8,   676,   378,  1256,   677,
+     620,   332,   680,   682,   686,   685,   379,     9,   688,  1163,
+    1164,   689,    10,    11,   690,  1165,   692,   691,   333,   334,
+     693,   232,   694,   696,   335,   839,   840,   841,   842,   843,
+     844,   845,    12,   697,   698,   699,    13,   701,   271,  1166,
+     702,   703,   731,   705,   955,   706,   956,   957,   708,    14,
+     707,   709,   710,   713,  1167,   714,   233,   380,   715,   473,
+     720,   272,   273,   721,  1257,   234,   235,   236,   724,   336,
+     237,   238,    15,    16,   722,   239,   240,   241,   723,   726,
+     381,   729,   819,   730,   732,   754,   733,    17,   734,   337,
+     338,   339,  1224,   340,  1225,  1226,  1258,   341,   736,   737,
+     755,   747,   738,   342,    18,  1259,   739,   740,   743,   744,
+     343,   748,   749,   751,  1260,   756,    19,    20,  1168,   344,
+     345,  1096,  1097,  1098,  1099,  1100,  1101,  1102,   757,   784,
+     346,   786,   758,   933,   759,   762,   791,  1169,  1261,   781,
+    1262,  1263,    21,   763,   764,   766,   767,   768,   775,   769,
+     771,   347,   772,   776,  1264,    22,   777,   778,   782,   785,
+      23,   787,  1265,   788,   789,    24,   790,   958,    25,   959,
+     960,  1279,   792,   961,   962,   793,   963,   964,   794,   965,
+     796,   966,   795,   797,   967,   798,   968,   969,   799,   800,
+     801,   802,   970,   803,   804,   805,   971,   348,   806,   811,
+     972,   973,   974,   807,   808,   809,   810,   975,   817,   812,
+     813,   818,   976,   820,   827,  1227,   860,  1228,  1229,   821,
+     822,  1230,  1231,   823,  1232,  1233,   824,  1234,   828,  1235,
+     829,   835,  1236,   861,  1237,  1238,   830,  1280,   832,   863,
+    1239,   836,   837,   838,  1240,   848,   849,   850,  1241,  1242,
+    1243,   851,   852,   853,   854,  1244,   934,   855,   935,   936,
+    1245,   856,   937,   938,   857,   939,   940,   858,   941,  1281,
+     942,   859,   864,   943,   865,   944,   945,   867,  1282,   868,
+     870,   946,    82,   871,   872,   947,   874,  1283,   885,   948,
+     949,   950,   877,   888,   878,   881,   951,   882,  1001,   883,
+     893,   952,   884,   886,   887,   889,   890,  1002,   891,    83,
+      84,  1284,   892,  1285,  1286,   894,    85,   895,   896,   897,
+     898,   899,  1000,  1003,   900,   901,   902,  1287,   903,   904,
+     905,   906,   907,   908,   909,  1288,   910,  1004,  1005,   911,
+     912,   913,   914,   915,    86,    87,    88,    89,   916,   917,
+     918,   919,   920,   921,   922,  1006,   923,   929,   930,    90,
+      91,    92,   931,   932,   979,   980,   981,   982,   983,    93,
+      94,   984,   985,    95,   986,   987,   988,   989,   990,   991,
+     992,   993,   994,   995,   996,   997,   998,   999,  1007,  1008,
+    1009,  1010,  1011,  1012,  1013,  1015,  1014,  1018,  1019,  1021,
+    1020,  1022,  1024,  1025,  1023,  1027,  1028,  1029,  1030,  1318,
+    1032,  1033,  1026,   704,  1035,  1036,  1037,  1073,  1034,  1038,
+    1031,  1039,  1086,  1087,  1040,  1088,  1041,  1089,  1092,  1094,
+     316,   761,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,
+    1050,  1051,  1058,  1059,  1060,  1061,  1305,  1062,  1063,  1064,
+    1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,  1333,  1335,
+    1075,  1074,  1076,  1357,  1090,  1091,  1308,  1095,  1103,  1093,
+    1104,  1105,  1110,  1111,  1112,  1113,  1114,  1115,  1116,  1117,
+    1118,  1119,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+    1133,  1140,  1141,  1142,  1143,  1144,  1321,  1145,  1332,  1334,
+    1146,  1336,  1273,  1147,  1148,  1149,  1150,  1337,  1158,   826,
+     774,  1159,  1172,  1338,  1339,  1328,  1173,  1331,  1306,   753,
+    1174,   742,  1330,   780,   816,  1340,  1175,  1176,  1177,  1178,
+    1186,  1354,  1179,   669,  1180,  1329,   605,   746,   834,  1189,
+    1190,  1191,  1187,  1192,  1220,  1221,  1222,  1223,  1248,  1249,
+    1250,  1251,  1252,  1255,  1268,   407,   673,  1274,  1269,  1270,
+    1275,  1276,  1277,  1278,  1291,  1307,   506,   464,   331,  1299,
+    1300,  1309,  1310,  1325,  1311,  1312,  1313,  1324,  1341,  1342,
+    1343,     0,     0,     0,   556,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   579,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   590,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   602,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   649,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   652,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   676
+       0,     0,     0,     0,     0,     0,     0,     0,   679
 };
 
 static const yytype_int16 yycheck[] =
 {
-     646,   647,   316,     1,     8,   319,   320,   321,     1,   323,
-     324,     1,     1,     1,     1,     1,     1,     1,     1,    53,
-      49,   218,   237,   238,     1,   222,     1,     1,     1,     1,
-       1,     1,   239,     1,   239,   218,     1,    17,    31,   222,
-     239,     1,   116,   239,     1,   239,    39,    11,    12,    13,
-     239,     1,     1,     3,     1,     5,     1,     6,     7,     1,
-       9,    10,   237,   237,   237,    14,   241,   241,   241,    57,
-      20,   185,   186,     1,    42,    24,    25,    26,    66,   239,
-      68,     1,    42,    66,    33,   239,     1,    36,    37,    38,
-      40,    66,    66,   239,    43,    66,    85,   131,   239,   239,
-     414,    85,   416,   417,   237,   239,   420,    57,   241,    59,
-     108,    60,    61,   239,   428,   108,   239,    85,    68,   433,
-     100,   108,   108,    72,   104,    85,    75,    76,   442,   443,
-      80,   108,  1109,  1110,  1111,   105,   108,    86,   212,   239,
-     454,   129,   456,   457,    93,   239,    95,   239,    97,   132,
-      99,   108,   116,   102,   103,     1,   126,   132,   108,   132,
-     132,   108,     1,   108,   132,   114,   108,   132,   197,   239,
-     119,   120,   132,   122,   123,   124,   174,   206,   127,   129,
-     108,    20,   162,    29,   239,    31,   239,   132,   108,   237,
-     105,   181,   181,   241,   192,   237,   181,   181,   148,   241,
-       1,    40,   206,   152,   237,   237,   237,   157,   241,   241,
-     208,   126,    58,   239,   163,   164,   165,   166,   167,   168,
-     169,   239,   237,    69,   237,   202,   241,   237,   241,    68,
-     237,   545,   240,   116,   241,    81,    82,    83,   228,   226,
-     238,     1,   229,   228,   240,   238,   240,   181,    94,   226,
-     238,   238,    98,   238,   238,   238,   229,   207,    18,    19,
-     130,   238,   108,    23,   229,   111,   112,   238,   238,   108,
-     219,   220,   221,   238,   223,   224,     1,     1,   238,   226,
-     230,   238,   202,   232,   226,   234,   125,   229,   238,   238,
-     116,   238,   240,   238,   140,   116,    20,    71,   226,    73,
-     240,   237,    27,    28,     1,   241,   226,   108,    68,    34,
-     156,   240,   237,   159,   160,   161,    40,   240,   157,   158,
-     634,   240,   240,   240,   638,   237,   240,   641,    88,    89,
-      90,   645,    92,     1,    31,   240,    96,    62,    63,    64,
-      65,   101,    39,   240,    68,   240,   240,   121,   108,   240,
-     240,   240,    77,    78,    79,   240,   240,   117,   118,   240,
-     240,   207,    87,    88,   138,   240,    91,    35,   128,   240,
-     209,   240,    15,   174,   240,   240,    44,    45,    46,   240,
-     240,    49,    50,   240,   230,   231,    54,    55,    56,   149,
-     229,   192,   238,     1,   233,   240,     1,     1,    41,   238,
-     240,   125,   240,   177,   178,   240,   240,   208,   240,   133,
-     134,   108,    20,   240,     1,    20,   240,   240,   240,     6,
-       7,   240,     9,    10,   240,   240,   240,    14,   240,   153,
-     240,    74,    40,   240,   194,    40,   240,    24,    25,    26,
-     240,   240,   240,   240,   240,   240,    33,   240,   240,    36,
-      37,    38,     4,    57,   240,   229,    43,    73,   240,   240,
-      68,   235,    66,    68,    68,   240,   109,   110,   240,    21,
-      22,   240,   115,    60,    61,   240,   240,   240,   238,   240,
-      32,   240,   240,   240,   240,    72,   240,   240,    75,    76,
-     240,   240,   240,   240,   240,   240,   139,   240,   240,    86,
-     108,   240,   240,   240,   240,   229,    93,   240,    95,   240,
-      97,   154,    99,   238,   238,   102,   103,   125,    70,    71,
-     125,    73,   138,   240,   240,   129,   240,   114,   133,   134,
-     240,   240,   119,   120,   240,   122,   123,   124,   240,   240,
-     127,   834,   835,   836,   837,   838,   839,   840,   153,   157,
-     158,   130,   130,   105,   170,   237,   218,   116,   116,   116,
-       1,   113,   178,   116,   237,   152,   237,   237,   240,   130,
-     238,   187,   116,   240,   217,   240,   163,   164,   165,   166,
-     167,   168,   169,   135,   240,   137,   138,   240,    29,   240,
-      31,   240,   240,   236,   240,   211,   240,   213,   214,   240,
-     240,   209,   240,   155,   240,   240,   240,   240,  1254,   240,
-     240,   227,   240,   240,   240,   240,   240,    58,   240,   235,
-     240,   229,   240,   240,   229,   233,   178,   240,    69,   240,
-     237,   183,   219,   220,   221,   187,   223,   224,   240,   191,
-      81,    82,    83,   240,   196,   232,   218,   234,   200,   218,
-       1,   116,     3,    94,     5,   218,   116,    98,   116,   211,
-     116,   213,   214,   218,   216,   116,   116,   108,   218,    20,
-     111,   112,   218,   116,   116,   227,   116,   116,   116,   116,
-       0,     1,   218,   235,     4,   218,   240,     1,   218,    40,
-     218,   240,   218,   218,   218,   218,    16,   218,   116,   140,
-      20,   218,    22,   218,   116,   237,    57,   130,    59,   240,
-      30,   240,   218,   240,   130,   156,     1,    68,   159,   160,
-     161,    35,    42,   237,   240,   237,   237,    47,    48,    80,
-      44,    45,    46,    18,    19,    49,    50,   240,    23,   240,
-      54,    55,    56,   116,   240,   240,   240,    67,   240,   240,
-     240,    71,   237,   240,   240,   237,   240,   108,     1,   240,
-      49,   240,    51,    52,    84,   240,   207,   240,   141,   142,
-     143,   144,   145,   146,   147,   237,   240,   240,   129,   240,
-     130,   240,   218,    68,    27,    28,   106,   107,   240,   230,
-     231,    34,   240,   218,   130,   116,   218,   148,   218,   218,
-     130,   121,   237,    88,    89,    90,   157,    92,   218,   240,
-      49,    96,    51,    52,   130,   130,   101,   130,   138,    62,
-      63,    64,    65,   108,   116,   116,   130,   130,   130,   130,
-     150,   151,   117,   118,    77,    78,    79,   130,   237,   237,
-     130,   218,   130,   128,    87,    88,   130,   130,    91,   130,
-      49,   130,   240,   237,   239,   175,   207,   237,   240,   240,
-     130,   240,   240,   237,   149,   237,   116,   116,   188,   240,
-     240,   237,   237,   193,   237,   237,   237,   237,   198,   230,
-     237,   201,   171,   172,   173,   237,   240,   176,   177,    73,
-     179,   180,   237,   182,   237,   184,   237,   237,   187,   237,
-     189,   190,   237,   237,   237,   116,   195,   116,   116,   194,
-     199,   116,   130,   116,   203,   204,   205,   130,   116,   116,
-     237,   210,   218,   130,   130,   116,   215,   237,   130,   240,
-     130,   237,   171,   172,   173,   130,   130,   176,   177,   237,
-     179,   180,   130,   182,   130,   184,   218,   130,   187,   130,
-     189,   190,   130,   130,   138,   130,   195,   237,   130,   237,
-     199,   237,   237,   237,   203,   204,   205,   240,   237,   237,
-     237,   210,   171,   172,   173,   237,   215,   176,   177,   237,
-     179,   180,   237,   182,   237,   184,   170,   130,   187,   237,
-     189,   190,   237,   237,   178,   237,   195,   237,   116,   237,
-     199,   237,   237,   187,   203,   204,   205,   237,   237,   237,
-     237,   210,   237,   237,   237,   237,   215,   237,   237,   130,
-     237,   237,   237,   237,   130,   237,   130,   211,   130,   213,
-     214,   130,   130,   237,   130,   116,   237,   130,   130,   130,
-     130,   237,   130,   227,   237,   237,   130,   237,   237,   594,
-     237,   235,   237,   218,   218,   237,   130,   237,   237,   130,
-     130,   237,   130,   237,   237,   130,   130,   237,   237,   240,
-     237,   237,   240,   130,   130,   237,   237,   240,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   130,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   130,   237,   237,
-     240,   237,   237,   130,   130,   237,   240,   237,   237,   240,
-     237,   237,   237,   237,   237,   237,   116,   237,   237,   237,
-     237,   130,   237,   136,   237,   136,   237,   237,   138,  1238,
-     237,   138,   237,   237,   136,   136,    77,  1340,   237,   272,
-     237,   237,   237,   522,   237,   237,  1301,   237,   237,   237,
-     237,   237,   237,   507,   237,   237,  1070,  1299,   237,  1277,
-     237,   237,   225,  1288,   237,   237,   237,   237,   237,   237,
-    1171,  1286,   237,   237,   471,   494,   237,   237,   237,   241,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   538,   237,   607,   237,   237,   240,   237,   237,   237,
-     237,   237,   580,  1311,   223,  1304,  1282,   242,   242,   237,
-     242,   242,   242,   242,   237,   240,   237,   237,   484,   116,
-     168,  1141,  1139,    96,   240,    -1,    -1,    -1,    -1,   399,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   297,
-      -1,    -1,    -1,   380,    -1,    -1,    -1,    -1,    -1,    -1,
+     649,   650,   318,     1,     1,   321,   322,   323,   242,   325,
+     326,     1,     1,   118,     1,    54,     1,     6,     7,     1,
+       9,    10,     1,     1,     1,    14,     1,     1,     1,     1,
+       1,   240,   241,     1,    50,    32,    25,    26,    27,     1,
+     221,   242,   221,    40,   225,    34,   225,   240,    37,    38,
+      39,   244,   240,     1,   240,    44,   244,     1,     1,   188,
+     189,    43,     1,   240,     1,   243,     1,   244,   242,    67,
+     242,   240,    61,    62,     1,   244,  1120,  1121,  1122,   242,
+      58,    43,     1,     1,    73,   242,    58,    76,    77,    67,
+      67,    69,    67,   242,   133,    67,    86,    69,    87,   242,
+     416,    20,   418,   419,    86,    94,   422,    96,   242,    98,
+     215,   100,   101,   110,   430,   104,   105,     1,     1,   435,
+     242,   242,    41,   110,    86,   110,   242,   116,   242,   445,
+     446,   110,   121,   122,   107,   124,   125,   126,   242,   107,
+     129,   457,     1,   459,   460,     1,    30,     3,    32,     5,
+      69,     1,   134,   131,   240,   128,   243,   134,   244,   131,
+     128,   242,   110,   134,    20,   154,   110,   110,    18,    19,
+     242,   110,   134,   242,    24,    59,   165,   166,   167,   168,
+     169,   170,   171,   110,   200,    41,    70,     1,   242,   242,
+       1,   134,   110,   209,   184,   242,   242,   134,    82,    83,
+      84,   242,    58,   243,    60,     1,   243,   134,   127,     8,
+     184,    95,   243,    69,   243,    99,   135,   136,   205,    69,
+      11,    12,    13,    22,    20,    81,   110,   110,     1,   113,
+     114,   243,   548,   222,   223,   224,   155,   226,   227,    89,
+      90,    91,   229,    93,   241,    41,   235,    97,   237,   184,
+     229,   110,   241,   103,   110,    28,    29,   231,   142,   241,
+     110,   232,    35,   241,   241,   132,   241,   241,   241,   119,
+     120,   240,    86,    69,   158,   131,    17,   161,   162,   163,
+     130,   229,   240,   243,   232,   229,   244,   205,   232,     1,
+      63,    64,    65,    66,   150,   232,   231,   241,   241,   110,
+     240,   151,   241,   159,   241,    78,    79,    80,   240,   243,
+       1,   229,   244,   232,   110,    88,    89,   243,   177,    92,
+       1,   637,   241,   241,    36,   641,   210,   118,   644,     1,
+     243,   127,   648,    45,    46,    47,   195,   240,    50,    51,
+     240,   244,   243,    55,    56,    57,   229,   197,    20,   233,
+     234,    32,   211,    72,   210,    74,   243,   241,   241,    40,
+     184,   102,   243,   159,   160,   106,   177,   240,   243,    41,
+     184,   244,    11,    12,    13,   174,    67,   233,   243,     4,
+     243,     1,   241,   243,   195,   241,     6,     7,   240,     9,
+      10,   241,   244,   132,    14,   240,    21,    69,    23,   244,
+     211,   924,   925,   926,   123,    25,    26,    27,    33,   240,
+     209,   243,   118,   244,    34,   243,   212,    37,    38,    39,
+     243,   140,   243,   164,    44,   243,   243,   241,   243,   110,
+     243,   243,   118,   243,   243,   243,   232,   243,   110,   243,
+     236,    61,    62,   134,   118,   241,    71,    72,   243,    74,
+     243,   243,   240,    73,   243,   127,    76,    77,   243,   243,
+     243,   180,   181,   243,   243,   243,   243,    87,   241,   243,
+     132,   243,   243,   243,    94,   243,    96,   243,    98,   118,
+     100,   101,   107,   243,   104,   105,   243,   159,   160,   243,
+     115,   243,   243,   243,   243,   243,   116,   243,     1,     1,
+     243,   121,   122,   243,   124,   125,   126,   243,   243,   129,
+     243,   243,   137,   232,   139,   140,   243,    20,     1,   238,
+       3,   243,     5,   243,   221,   243,   243,   243,    30,   241,
+      32,   118,   157,   243,   154,   243,   243,    20,    41,   243,
+     212,   243,   243,   243,   243,   165,   166,   167,   168,   169,
+     170,   171,   118,   243,   243,   243,   181,    59,    41,   243,
+     232,   186,   118,   243,   236,   190,    69,   243,    70,   194,
+     243,   118,   243,   243,   199,    58,   243,    60,   203,   243,
+      82,    83,    84,    15,   243,   243,    69,   243,   243,   214,
+     243,   216,   217,    95,   219,   243,   240,    99,    81,   240,
+     243,   243,   222,   223,   224,   230,   226,   227,   110,   243,
+      42,   113,   114,   238,   243,   235,   243,   237,   240,   243,
+     243,  1270,   243,   132,   127,   243,   243,   110,   243,   243,
+     243,   243,   135,   136,     0,     1,   243,   243,     4,   243,
+     142,   243,   243,    75,   243,   243,   243,   243,   131,   243,
+      16,   243,   155,   243,    20,   243,   158,    23,   243,   161,
+     162,   163,   243,   243,   240,    31,   243,   150,    74,   243,
+     118,     1,   221,   118,   118,   221,   159,    43,   221,   111,
+     112,   118,    48,    49,   118,   117,   221,   118,    18,    19,
+     221,     1,   221,   118,    24,   143,   144,   145,   146,   147,
+     148,   149,    68,   118,   118,   118,    72,   118,   210,   141,
+     118,   118,   240,   118,    50,   118,    52,    53,   243,    85,
+     221,   243,   221,   221,   156,   221,    36,   210,   221,   232,
+     221,   233,   234,   221,   140,    45,    46,    47,   118,    69,
+      50,    51,   108,   109,   221,    55,    56,    57,   221,   221,
+     233,   221,   242,   118,   240,   132,   243,   123,   243,    89,
+      90,    91,    50,    93,    52,    53,   172,    97,   243,   243,
+     132,   240,   243,   103,   140,   181,   243,   243,   243,   243,
+     110,   243,   243,   243,   190,   240,   152,   153,   220,   119,
+     120,   839,   840,   841,   842,   843,   844,   845,   240,   132,
+     130,   132,   243,    50,   243,   240,   118,   239,   214,   221,
+     216,   217,   178,   243,   243,   243,   243,   243,   240,   243,
+     243,   151,   243,   243,   230,   191,   243,   243,   221,   221,
+     196,   221,   238,   221,   221,   201,   240,   173,   204,   175,
+     176,    74,   132,   179,   180,   221,   182,   183,   132,   185,
+     132,   187,   243,   132,   190,   118,   192,   193,   118,   132,
+     132,   132,   198,   132,   132,   132,   202,   197,   132,   240,
+     206,   207,   208,   132,   132,   132,   132,   213,   221,   240,
+     243,   240,   218,   240,   132,   173,   118,   175,   176,   243,
+     243,   179,   180,   243,   182,   183,   243,   185,   240,   187,
+     240,   240,   190,   118,   192,   193,   243,   140,   243,   243,
+     198,   240,   240,   240,   202,   240,   240,   240,   206,   207,
+     208,   240,   240,   240,   240,   213,   173,   240,   175,   176,
+     218,   240,   179,   180,   240,   182,   183,   240,   185,   172,
+     187,   240,   118,   190,   118,   192,   193,   118,   181,   118,
+     132,   198,     1,   118,   118,   202,   118,   190,   243,   206,
+     207,   208,   240,   118,   132,   132,   213,   221,   221,   132,
+     240,   218,   132,   132,   132,   132,   132,   243,   132,    28,
+      29,   214,   132,   216,   217,   132,    35,   132,   240,   240,
+     132,   132,   132,   132,   240,   240,   240,   230,   240,   240,
+     240,   240,   240,   240,   240,   238,   240,   118,   132,   240,
+     240,   240,   240,   240,    63,    64,    65,    66,   240,   240,
+     240,   240,   240,   240,   240,   132,   240,   240,   240,    78,
+      79,    80,   240,   240,   240,   240,   240,   240,   240,    88,
+      89,   240,   240,    92,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   132,   240,
+     132,   132,   240,   132,   132,   118,   243,   240,   240,   132,
+     240,   132,   132,   221,   240,   132,   132,   132,   221,  1254,
+     132,   132,   243,   438,   132,   132,   132,   132,   240,   240,
+     243,   240,   132,   132,   240,   132,   240,   132,   132,   132,
+      77,   510,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   118,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   140,   140,
+     240,   243,   240,  1356,   240,   240,   245,   240,   240,   243,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   132,   240,   138,   138,
+     240,   138,  1081,   240,   240,   240,   240,   138,   240,   597,
+     525,   240,   240,  1315,  1317,  1293,   240,  1304,  1187,   497,
+     240,   474,  1302,   541,   583,  1320,   240,   240,   240,   240,
+     228,  1327,   240,   382,   240,  1298,   307,   487,   610,   240,
+     240,   240,   244,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   116,   401,   240,   243,   243,
+     240,   240,   240,   240,   240,   240,   225,   169,    96,  1155,
+    1157,   245,   245,   240,   245,   245,   245,   243,   240,   240,
+     240,    -1,    -1,    -1,   242,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   274,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   305,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   299,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   347,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   409
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   411
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
      symbol of state STATE-NUM.  */
 static const yytype_uint16 yystos[] =
 {
-       0,   244,     0,     1,     4,    16,    20,    22,    30,    42,
-      47,    48,    67,    71,    84,   106,   107,   121,   138,   150,
-     151,   175,   188,   193,   198,   201,   245,   250,   255,   281,
-     287,   293,   301,   315,   335,   358,   372,   387,   394,   398,
-     408,   417,   438,   444,   450,   454,   460,   516,   532,   237,
-     238,   239,   239,   336,   418,   445,   239,   455,   239,   373,
-     439,   359,   239,   288,   316,   388,   239,   239,   409,   239,
-     294,   239,   399,     1,    31,    39,   108,   282,   283,   284,
-     285,   286,     1,    27,    28,    34,    62,    63,    64,    65,
-      77,    78,    79,    87,    88,    91,   517,   518,   519,   520,
-     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,   239,   239,   239,     1,    66,   451,   452,   453,   239,
-       1,     6,     7,     9,    10,    14,    24,    25,    26,    33,
-      36,    37,    38,    43,    60,    61,    72,    75,    76,    86,
-      93,    95,    97,    99,   102,   103,   114,   119,   120,   122,
-     123,   124,   127,   152,   163,   164,   165,   166,   167,   168,
-     169,   219,   220,   221,   223,   224,   232,   234,   461,   462,
-     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
-     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
-     483,   484,   485,   486,   487,   488,   489,   490,   491,   492,
-     493,   494,   495,   496,   497,   498,   499,   500,   501,   502,
-     503,   504,   508,   512,   513,   514,   515,   239,   239,   239,
-       1,   105,   126,   251,   252,   253,   254,   239,   239,   239,
-       1,    35,    44,    45,    46,    49,    50,    54,    55,    56,
-     533,   534,   535,   536,   537,   538,   539,   540,   541,   542,
-     543,     1,    29,    31,    58,    69,    81,    82,    83,    94,
-      98,   108,   111,   112,   140,   156,   159,   160,   161,   207,
-     230,   231,   256,   257,   258,   259,   260,   261,   262,   263,
-     264,   268,   269,   270,   271,   272,   273,   274,   275,   276,
-     277,   278,   279,   280,   239,     1,   228,   302,   303,   304,
-     305,   306,   239,     1,   108,   395,   396,   397,   239,   237,
-     240,   240,   240,   238,   283,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   240,   240,   240,   238,   518,
-       1,    18,    19,    23,    68,    88,    89,    90,    92,    96,
-     101,   108,   117,   118,   128,   149,   194,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,     1,     3,     5,    20,    40,
-      57,    59,    68,    80,   108,   129,   148,   157,   207,   230,
-     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
-     429,   433,   434,   435,   436,   437,     1,    66,   132,   446,
-     447,   448,   449,   240,   238,   452,     1,   108,   132,   456,
-     457,   458,   459,   240,   240,   240,   240,   240,   240,   240,
+       0,   247,     0,     1,     4,    16,    20,    23,    31,    43,
+      48,    49,    68,    72,    85,   108,   109,   123,   140,   152,
+     153,   178,   191,   196,   201,   204,   248,   255,   260,   286,
+     292,   298,   306,   320,   340,   363,   377,   392,   399,   403,
+     413,   422,   443,   449,   455,   459,   465,   522,   538,   240,
+     241,   242,   242,   341,   423,   450,   242,   460,   242,   378,
+     444,   364,   242,   293,   321,   393,   242,   242,   414,   242,
+     299,   242,   404,     1,    32,    40,   110,   287,   288,   289,
+     290,   291,     1,    28,    29,    35,    63,    64,    65,    66,
+      78,    79,    80,    88,    89,    92,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,   532,   533,   534,   535,   536,
+     537,   242,   242,   242,     1,    67,   456,   457,   458,   242,
+       1,     6,     7,     9,    10,    14,    25,    26,    27,    34,
+      37,    38,    39,    44,    61,    62,    73,    76,    77,    87,
+      94,    96,    98,   100,   101,   104,   105,   116,   121,   122,
+     124,   125,   126,   129,   154,   165,   166,   167,   168,   169,
+     170,   171,   222,   223,   224,   226,   227,   235,   237,   466,
+     467,   468,   469,   470,   471,   472,   473,   474,   475,   476,
+     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
+     487,   488,   489,   490,   491,   492,   493,   494,   495,   496,
+     497,   498,   499,   500,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   510,   514,   518,   519,   520,   521,   242,
+     242,   242,     1,   107,   128,   256,   257,   258,   259,   242,
+     242,   242,     1,    36,    45,    46,    47,    50,    51,    55,
+      56,    57,   539,   540,   541,   542,   543,   544,   545,   546,
+     547,   548,   549,     1,    30,    32,    59,    70,    82,    83,
+      84,    95,    99,   110,   113,   114,   142,   158,   161,   162,
+     163,   210,   233,   234,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   242,     1,   231,   307,
+     308,   309,   310,   311,   242,     1,   110,   400,   401,   402,
+     242,   240,   243,   243,   243,   241,   288,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     241,   524,     1,    18,    19,    24,    69,    89,    90,    91,
+      93,    97,   103,   110,   119,   120,   130,   151,   197,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,   358,   359,     1,     3,     5,
+      20,    41,    58,    60,    69,    81,   110,   131,   150,   159,
+     210,   233,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,   438,   439,   440,   441,   442,     1,    67,
+     134,   451,   452,   453,   454,   243,   241,   457,     1,   110,
+     134,   461,   462,   463,   464,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   515,   511,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   241,   467,     1,    20,    41,    69,   127,
+     135,   136,   155,   232,   379,   380,   381,   382,   383,   384,
+     385,   389,   390,   391,     1,   134,   232,   445,   446,   447,
+     448,     1,    58,    67,    69,   131,   365,   369,   370,   371,
+     375,   376,   240,   243,   243,   241,   257,     1,    86,   184,
+     294,   295,   296,   297,     1,    20,    41,    69,   110,   127,
+     159,   160,   212,   232,   236,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   336,     1,    43,    86,
+     134,   394,   395,   396,   397,   398,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   241,   540,   240,   243,   243,
+     243,   243,   270,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   241,   262,
+       1,   110,   229,   415,   416,   417,   418,   240,   243,   241,
+     308,   184,     1,   110,   177,   195,   211,   300,   301,   302,
+     303,   304,   305,   243,   241,   401,     1,   110,   229,   232,
+     405,   406,   407,   408,   409,   132,   132,   132,   240,   118,
+     118,   250,   221,   118,   250,   250,   250,   118,   250,   250,
+     118,   118,   118,   240,   240,   243,   243,   243,   360,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   241,   343,   240,   243,   243,   243,   243,   243,   243,
+     435,   243,   243,   243,   243,   243,   243,   243,   241,   425,
+     243,   243,   241,   452,   132,   240,   243,   243,   241,   462,
+     221,   250,   118,   250,   250,   221,   118,   250,   221,   118,
+     118,   118,   221,   221,   221,   250,   118,   118,   118,   118,
+     250,   118,   118,   118,   254,   118,   118,   221,   243,   243,
+     221,   250,   250,   221,   221,   221,   221,   225,   221,   225,
+     221,   221,   221,   221,   118,   250,   221,   250,   250,   221,
+     118,   240,   240,   243,   243,   386,   243,   243,   243,   243,
+     243,   241,   380,   243,   243,   241,   446,   240,   243,   243,
+     366,   243,   241,   370,   132,   132,   240,   240,   243,   243,
+     241,   295,   240,   243,   243,   337,   243,   243,   243,   243,
+     333,   243,   243,   241,   323,   240,   243,   243,   243,   241,
+     395,   221,   221,   250,   132,   221,   132,   221,   221,   221,
+     240,   118,   132,   221,   132,   243,   132,   132,   118,   118,
+     132,   132,   132,   132,   132,   132,   132,   132,   132,   132,
+     132,   240,   240,   243,   419,   241,   416,   221,   240,   242,
+     240,   243,   243,   243,   243,   241,   301,   132,   240,   240,
+     243,   410,   243,   241,   406,   240,   240,   240,   240,   143,
+     144,   145,   146,   147,   148,   149,   249,   250,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     118,   118,   250,   243,   118,   118,   250,   118,   118,   250,
+     132,   118,   118,   250,   118,   252,   252,   240,   132,   188,
+     189,   132,   221,   132,   132,   243,   132,   132,   118,   132,
+     132,   132,   132,   240,   132,   132,   240,   240,   132,   132,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,    11,    12,    13,   253,   254,   240,
+     240,   240,   240,    50,   173,   175,   176,   179,   180,   182,
+     183,   185,   187,   190,   192,   193,   198,   202,   206,   207,
+     208,   213,   218,   516,   517,    50,    52,    53,   173,   175,
+     176,   179,   180,   182,   183,   185,   187,   190,   192,   193,
+     198,   202,   206,   207,   208,   213,   218,   512,   513,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     132,   221,   243,   132,   118,   132,   132,   132,   240,   132,
+     132,   240,   132,   132,   243,   118,   373,   374,   240,   240,
+     240,   132,   132,   240,   132,   221,   243,   132,   132,   132,
+     221,   243,   132,   132,   240,   132,   132,   132,   240,   240,
      240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   240,   240,   240,   240,   509,
-     505,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   240,    17,   102,   106,   164,   271,   272,   240,   240,
      240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
-     238,   462,     1,    20,    40,    68,   125,   133,   134,   153,
-     229,   374,   375,   376,   377,   378,   379,   380,   384,   385,
-     386,     1,   132,   229,   440,   441,   442,   443,     1,    57,
-      66,    68,   129,   360,   364,   365,   366,   370,   371,   237,
-     240,   240,   238,   252,     1,    85,   181,   289,   290,   291,
-     292,     1,    20,    40,    68,   108,   125,   157,   158,   209,
-     229,   233,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   331,     1,    42,    85,   132,   389,   390,
-     391,   392,   393,   240,   240,   240,   240,   240,   240,   240,
-     240,   240,   238,   534,   237,   240,   240,   240,   240,   265,
+     240,   240,   240,   132,   243,   240,   240,     1,   110,   205,
+     229,   312,   313,   314,   315,   316,   132,   132,   132,   132,
+     240,   240,   132,   243,   132,   240,   249,   249,   249,   249,
+     249,   249,   249,   240,   240,   240,    54,   133,   361,   362,
      240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   238,   257,     1,   108,   226,
-     410,   411,   412,   413,   237,   240,   238,   303,   181,     1,
-     108,   174,   192,   208,   295,   296,   297,   298,   299,   300,
-     240,   238,   396,     1,   108,   226,   229,   400,   401,   402,
-     403,   404,   130,   130,   130,   237,   116,   116,   247,   218,
-     116,   247,   247,   247,   116,   247,   247,   116,   116,   116,
-     237,   237,   240,   240,   240,   355,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   240,   240,   240,   238,   338,
-     237,   240,   240,   240,   240,   240,   240,   430,   240,   240,
-     240,   240,   240,   240,   240,   238,   420,   240,   240,   238,
-     447,   130,   237,   240,   240,   238,   457,   218,   247,   116,
-     247,   247,   218,   116,   247,   218,   116,   116,   116,   218,
-     218,   218,   247,   116,   116,   116,   116,   247,   116,   116,
-     116,   116,   218,   240,   240,   218,   247,   247,   218,   218,
-     218,   218,   222,   218,   222,   218,   218,   218,   218,   116,
-     247,   218,   247,   247,   218,   116,   237,   237,   240,   240,
-     381,   240,   240,   240,   240,   240,   238,   375,   240,   240,
-     238,   441,   237,   240,   240,   361,   240,   238,   365,   130,
-     130,   237,   237,   240,   240,   238,   290,   237,   240,   240,
-     332,   240,   240,   240,   240,   328,   240,   240,   238,   318,
-     237,   240,   240,   240,   238,   390,   218,   218,   247,   130,
-     218,   130,   218,   218,   218,   237,   116,   130,   218,   130,
-     240,   130,   130,   116,   116,   130,   130,   130,   130,   130,
-     130,   130,   130,   130,   130,   130,   237,   237,   240,   414,
-     238,   411,   218,   237,   239,   237,   240,   240,   240,   240,
-     238,   296,   130,   237,   237,   240,   405,   240,   238,   401,
-     237,   237,   237,   237,   141,   142,   143,   144,   145,   146,
-     147,   246,   247,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   116,   116,   247,   240,   116,
-     116,   247,   116,   116,   247,   130,   116,   116,   247,   116,
-     249,   249,   237,   130,   185,   186,   130,   218,   130,   130,
-     240,   130,   130,   116,   130,   130,   130,   130,   237,   130,
-     130,   237,   237,   130,   130,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,    49,   171,   172,   173,   176,   177,   179,   180,
-     182,   184,   187,   189,   190,   195,   199,   203,   204,   205,
-     210,   215,   510,   511,    49,    51,    52,   171,   172,   173,
-     176,   177,   179,   180,   182,   184,   187,   189,   190,   195,
-     199,   203,   204,   205,   210,   215,   506,   507,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   130,
-     218,   240,   130,   116,   130,   130,   130,   237,   130,   130,
-     237,   130,   130,   240,   116,   368,   369,   237,   237,   237,
-     130,   130,   237,   130,   218,   240,   130,   130,   130,   218,
-     240,   130,   130,   237,   130,   130,   130,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,    17,   100,   104,   162,   266,   267,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-     237,   237,   130,   240,   237,   237,     1,   108,   202,   226,
-     307,   308,   309,   310,   311,   130,   130,   130,   130,   237,
-     237,   130,   240,   130,   237,   246,   246,   246,   246,   246,
-     246,   246,   237,   237,   237,    53,   131,   356,   357,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,    11,
-      12,    13,   248,   249,   237,   237,   237,   237,   237,   237,
-     237,   237,   237,     8,   206,   431,   432,   237,   237,   237,
-     237,   237,   237,   237,   237,   237,   237,   237,   237,   241,
-     237,   241,   237,   237,    15,    41,    74,   109,   110,   115,
-     139,   154,   217,   236,   382,   383,   237,   237,   237,   237,
-     237,   237,   237,   237,   237,    49,   197,   206,   362,   363,
-     225,   241,   367,   237,   237,   237,   237,     4,    21,    22,
-      32,    70,    71,    73,   105,   113,   135,   137,   138,   155,
-     178,   183,   187,   191,   196,   200,   211,   213,   214,   216,
-     227,   235,   333,   334,   237,   237,   237,   237,    49,    51,
-      52,   171,   172,   173,   176,   177,   179,   180,   182,   184,
-     187,   189,   190,   195,   199,   203,   204,   205,   210,   215,
-     329,   330,   237,   237,   237,   237,   237,   237,   241,   237,
-      73,   138,   170,   178,   187,   211,   213,   214,   227,   235,
-     415,   416,   237,   240,   240,   312,   238,   308,   237,   237,
-     237,   237,   237,    73,   138,   170,   178,   187,   211,   213,
-     214,   227,   235,   406,   407,   237,   237,   241,   248,   248,
-     248,   237,   241,   511,   507,   237,   241,   237,   241,   116,
-     369,   237,   242,   242,   242,   242,   242,   242,   237,   241,
-     237,   241,   267,   237,   241,   130,   212,   249,   240,   237,
-     237,   241,   357,   432,   383,   363,   136,   138,   136,   138,
-     136,   136,   334,   330,   416,   237,   237,   237,    71,    73,
-     121,   138,   177,   178,   229,   235,   313,   314,   407,   237,
-     241,   314
+      11,    12,    13,   251,   252,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,     8,    22,   174,   209,   436,   437,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,   253,   253,   253,   240,   244,   240,   244,   240,   240,
+      15,    42,    75,   111,   112,   117,   141,   156,   220,   239,
+     387,   388,   240,   240,   240,   240,   240,   240,   240,   240,
+     240,    50,   200,   209,   367,   368,   228,   244,   372,   240,
+     240,   240,   240,     4,    21,    23,    33,    71,    72,    74,
+     107,   115,   137,   139,   140,   157,   181,   186,   190,   194,
+     199,   203,   214,   216,   217,   219,   230,   238,   338,   339,
+     240,   240,   240,   240,    50,    52,    53,   173,   175,   176,
+     179,   180,   182,   183,   185,   187,   190,   192,   193,   198,
+     202,   206,   207,   208,   213,   218,   334,   335,   240,   240,
+     240,   240,   240,   240,   244,   240,    74,   140,   172,   181,
+     190,   214,   216,   217,   230,   238,   420,   421,   240,   243,
+     243,   317,   241,   313,   240,   240,   240,   240,   240,    74,
+     140,   172,   181,   190,   214,   216,   217,   230,   238,   411,
+     412,   240,   240,   244,   251,   251,   251,   240,   244,   517,
+     513,   240,   244,   240,   244,   118,   374,   240,   245,   245,
+     245,   245,   245,   245,   240,   244,   240,   244,   272,   240,
+     244,   132,   215,   252,   243,   240,   240,   244,   362,   437,
+     388,   368,   138,   140,   138,   140,   138,   138,   339,   335,
+     421,   240,   240,   240,    72,    74,   123,   140,   180,   181,
+     232,   238,   318,   319,   412,   240,   244,   319
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint16 yyr1[] =
 {
-       0,   243,   244,   244,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   246,   246,
-     247,   247,   247,   247,   247,   247,   247,   247,   248,   248,
-     249,   249,   249,   249,   250,   251,   251,   252,   252,   252,
-     253,   254,   255,   256,   256,   257,   257,   257,   257,   257,
-     257,   257,   257,   257,   257,   257,   257,   257,   257,   257,
-     257,   257,   257,   257,   257,   257,   258,   259,   260,   261,
-     262,   263,   265,   264,   266,   266,   267,   267,   267,   267,
-     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,   282,   283,   283,   283,   283,
-     284,   285,   286,   288,   287,   289,   289,   290,   290,   290,
-     291,   292,   294,   293,   295,   295,   296,   296,   296,   296,
-     296,   297,   298,   299,   300,   301,   302,   302,   303,   303,
-     303,   304,   306,   305,   307,   307,   308,   308,   308,   308,
-     309,   310,   310,   312,   311,   313,   313,   314,   314,   314,
-     314,   314,   314,   314,   314,   316,   315,   317,   317,   318,
-     318,   318,   318,   318,   318,   318,   318,   318,   318,   318,
-     319,   320,   321,   322,   323,   324,   325,   326,   328,   327,
-     329,   329,   330,   330,   330,   330,   330,   330,   330,   330,
-     330,   330,   330,   330,   330,   330,   330,   330,   330,   330,
-     330,   330,   330,   330,   332,   331,   333,   333,   334,   334,
-     334,   334,   334,   334,   334,   334,   334,   334,   334,   334,
-     334,   334,   334,   334,   334,   334,   334,   334,   334,   334,
-     334,   334,   334,   334,   334,   334,   334,   336,   335,   337,
-     337,   338,   338,   338,   338,   338,   338,   338,   338,   338,
-     338,   338,   338,   338,   338,   338,   338,   338,   339,   340,
-     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-     351,   352,   353,   355,   354,   356,   356,   357,   357,   359,
-     358,   361,   360,   362,   362,   363,   363,   363,   364,   364,
-     365,   365,   365,   365,   365,   367,   366,   368,   368,   369,
-     369,   370,   371,   373,   372,   374,   374,   375,   375,   375,
-     375,   375,   375,   375,   375,   375,   376,   377,   378,   379,
-     381,   380,   382,   382,   383,   383,   383,   383,   383,   383,
-     383,   383,   383,   383,   384,   385,   386,   388,   387,   389,
-     389,   390,   390,   390,   390,   391,   392,   393,   394,   395,
-     395,   396,   396,   397,   399,   398,   400,   400,   401,   401,
-     401,   401,   402,   403,   405,   404,   406,   406,   407,   407,
-     407,   407,   407,   407,   407,   407,   407,   407,   409,   408,
-     410,   410,   411,   411,   411,   412,   414,   413,   415,   415,
-     416,   416,   416,   416,   416,   416,   416,   416,   416,   416,
-     418,   417,   419,   419,   420,   420,   420,   420,   420,   420,
-     420,   420,   420,   420,   420,   420,   420,   420,   420,   421,
-     422,   423,   424,   425,   426,   427,   428,   428,   430,   429,
-     431,   431,   432,   432,   433,   434,   435,   436,   437,   439,
-     438,   440,   440,   441,   441,   441,   442,   443,   445,   444,
-     446,   446,   447,   447,   447,   448,   449,   450,   451,   451,
-     452,   452,   453,   455,   454,   456,   456,   457,   457,   457,
-     458,   459,   460,   461,   461,   462,   462,   462,   462,   462,
-     462,   462,   462,   462,   462,   462,   462,   462,   462,   462,
-     462,   462,   462,   462,   462,   462,   462,   462,   462,   462,
-     462,   462,   462,   462,   462,   462,   462,   462,   462,   462,
-     462,   462,   462,   462,   462,   462,   462,   462,   462,   462,
-     462,   462,   462,   463,   464,   465,   466,   467,   468,   469,
-     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-     480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-     490,   490,   491,   491,   492,   493,   494,   495,   496,   497,
-     498,   499,   500,   501,   502,   503,   505,   504,   506,   506,
-     507,   507,   507,   507,   507,   507,   507,   507,   507,   507,
-     507,   507,   507,   507,   507,   507,   507,   507,   507,   507,
-     507,   507,   509,   508,   510,   510,   511,   511,   511,   511,
-     511,   511,   511,   511,   511,   511,   511,   511,   511,   511,
-     511,   511,   511,   511,   511,   511,   512,   513,   514,   515,
-     516,   517,   517,   518,   518,   518,   518,   518,   518,   518,
-     518,   518,   518,   518,   518,   518,   518,   519,   520,   521,
-     522,   523,   524,   525,   526,   527,   528,   529,   530,   531,
-     532,   533,   533,   534,   534,   534,   534,   534,   534,   534,
-     534,   534,   534,   535,   536,   537,   538,   539,   540,   541,
-     542,   543
+       0,   246,   247,   247,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   249,   249,
+     250,   250,   250,   250,   250,   250,   250,   250,   251,   251,
+     252,   252,   252,   252,   253,   253,   254,   254,   254,   254,
+     255,   256,   256,   257,   257,   257,   258,   259,   260,   261,
+     261,   262,   262,   262,   262,   262,   262,   262,   262,   262,
+     262,   262,   262,   262,   262,   262,   262,   262,   262,   262,
+     262,   262,   263,   264,   265,   266,   267,   268,   270,   269,
+     271,   271,   272,   272,   272,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   287,   288,   288,   288,   288,   289,   290,   291,   293,
+     292,   294,   294,   295,   295,   295,   296,   297,   299,   298,
+     300,   300,   301,   301,   301,   301,   301,   302,   303,   304,
+     305,   306,   307,   307,   308,   308,   308,   309,   311,   310,
+     312,   312,   313,   313,   313,   313,   314,   315,   315,   317,
+     316,   318,   318,   319,   319,   319,   319,   319,   319,   319,
+     319,   321,   320,   322,   322,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   323,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   333,   332,   334,   334,   335,   335,
+     335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
+     335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
+     337,   336,   338,   338,   339,   339,   339,   339,   339,   339,
+     339,   339,   339,   339,   339,   339,   339,   339,   339,   339,
+     339,   339,   339,   339,   339,   339,   339,   339,   339,   339,
+     339,   339,   339,   341,   340,   342,   342,   343,   343,   343,
+     343,   343,   343,   343,   343,   343,   343,   343,   343,   343,
+     343,   343,   343,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,   358,   360,
+     359,   361,   361,   362,   362,   364,   363,   366,   365,   367,
+     367,   368,   368,   368,   369,   369,   370,   370,   370,   370,
+     370,   372,   371,   373,   373,   374,   374,   375,   376,   378,
+     377,   379,   379,   380,   380,   380,   380,   380,   380,   380,
+     380,   380,   381,   382,   383,   384,   386,   385,   387,   387,
+     388,   388,   388,   388,   388,   388,   388,   388,   388,   388,
+     389,   390,   391,   393,   392,   394,   394,   395,   395,   395,
+     395,   396,   397,   398,   399,   400,   400,   401,   401,   402,
+     404,   403,   405,   405,   406,   406,   406,   406,   407,   408,
+     410,   409,   411,   411,   412,   412,   412,   412,   412,   412,
+     412,   412,   412,   412,   414,   413,   415,   415,   416,   416,
+     416,   417,   419,   418,   420,   420,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   423,   422,   424,   424,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   433,   435,   434,   436,   436,   437,   437,
+     437,   437,   438,   439,   440,   441,   442,   444,   443,   445,
+     445,   446,   446,   446,   447,   448,   450,   449,   451,   451,
+     452,   452,   452,   453,   454,   455,   456,   456,   457,   457,
+     458,   460,   459,   461,   461,   462,   462,   462,   463,   464,
+     465,   466,   466,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   468,   469,   470,   471,   472,   473,   474,   475,
+     476,   477,   478,   479,   480,   481,   482,   483,   484,   485,
+     486,   487,   488,   489,   490,   491,   492,   493,   494,   495,
+     496,   496,   497,   497,   498,   499,   500,   501,   502,   503,
+     504,   505,   506,   507,   508,   509,   511,   510,   512,   512,
+     513,   513,   513,   513,   513,   513,   513,   513,   513,   513,
+     513,   513,   513,   513,   513,   513,   513,   513,   513,   513,
+     513,   513,   515,   514,   516,   516,   517,   517,   517,   517,
+     517,   517,   517,   517,   517,   517,   517,   517,   517,   517,
+     517,   517,   517,   517,   517,   517,   518,   519,   520,   521,
+     522,   523,   523,   524,   524,   524,   524,   524,   524,   524,
+     524,   524,   524,   524,   524,   524,   524,   525,   526,   527,
+     528,   529,   530,   531,   532,   533,   534,   535,   536,   537,
+     538,   539,   539,   540,   540,   540,   540,   540,   540,   540,
+     540,   540,   540,   541,   542,   543,   544,   545,   546,   547,
+     548,   549
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -2170,56 +2187,57 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     2,     2,     0,     1,
        2,     3,     3,     3,     3,     3,     3,     3,     0,     1,
-       2,     3,     3,     3,     5,     2,     1,     1,     1,     2,
-       4,     4,     5,     2,     1,     1,     1,     1,     1,     1,
+       2,     3,     3,     3,     0,     1,     2,     3,     3,     3,
+       5,     2,     1,     1,     1,     2,     4,     4,     5,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     4,     4,     4,     4,     4,     4,     0,     5,
+       3,     1,     1,     1,     1,     1,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     5,
+       2,     1,     1,     1,     1,     2,     4,     4,     4,     0,
+       6,     2,     1,     1,     1,     2,     4,     4,     0,     6,
+       2,     1,     1,     1,     1,     1,     2,     4,     4,     4,
+       4,     5,     2,     1,     1,     1,     2,     4,     0,     6,
+       2,     1,     1,     1,     1,     2,     4,     4,     4,     0,
+       5,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     6,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     2,     4,     4,     4,     4,
-       4,     4,     0,     5,     3,     1,     1,     1,     1,     1,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     5,     2,     1,     1,     1,     1,     2,
-       4,     4,     4,     0,     6,     2,     1,     1,     1,     2,
-       4,     4,     0,     6,     2,     1,     1,     1,     1,     1,
-       2,     4,     4,     4,     4,     5,     2,     1,     1,     1,
-       2,     4,     0,     6,     2,     1,     1,     1,     1,     2,
-       4,     4,     4,     0,     5,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     6,     2,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       4,     4,     4,     4,     4,     4,     4,     4,     0,     5,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     4,     0,     5,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     5,     3,     1,     3,     1,
-       3,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     1,     1,     1,     0,     6,     2,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     0,     5,     3,     1,     1,     1,     0,
-       6,     0,     5,     3,     1,     1,     1,     1,     2,     1,
-       1,     1,     1,     1,     2,     0,     5,     3,     1,     1,
-       3,     4,     4,     0,     6,     2,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     4,     4,     4,     4,
+       0,     5,     3,     1,     3,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     1,     1,     0,     6,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     0,
+       5,     3,     1,     1,     1,     0,     6,     0,     5,     3,
+       1,     1,     1,     1,     2,     1,     1,     1,     1,     1,
+       2,     0,     5,     3,     1,     1,     3,     4,     4,     0,
+       6,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     4,     4,     4,     4,     0,     5,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     0,     6,     2,     1,     1,     1,     1,
+       2,     4,     4,     4,     5,     2,     1,     1,     1,     4,
+       0,     6,     2,     1,     1,     1,     1,     2,     4,     4,
        0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     4,     4,     4,     0,     6,     2,
-       1,     1,     1,     1,     2,     4,     4,     4,     5,     2,
-       1,     1,     1,     4,     0,     6,     2,     1,     1,     1,
-       1,     2,     4,     4,     0,     5,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     6,
-       2,     1,     1,     1,     2,     4,     0,     5,     3,     1,
+       1,     1,     1,     1,     0,     6,     2,     1,     1,     1,
+       2,     4,     0,     5,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     6,     2,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     6,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     0,     5,
-       3,     1,     1,     1,     4,     4,     4,     4,     4,     0,
-       6,     2,     1,     1,     1,     1,     4,     4,     0,     6,
-       2,     1,     1,     1,     1,     4,     4,     5,     2,     1,
-       1,     1,     4,     0,     6,     2,     1,     1,     1,     1,
-       4,     4,     5,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     0,     5,     3,     1,     1,     1,
+       1,     1,     4,     4,     4,     4,     4,     0,     6,     2,
+       1,     1,     1,     1,     4,     4,     0,     6,     2,     1,
+       1,     1,     1,     4,     4,     5,     2,     1,     1,     1,
+       4,     0,     6,     2,     1,     1,     1,     1,     4,     4,
+       5,     2,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     4,     4,     4,     4,     4,     4,     4,
+       1,     1,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
@@ -2911,109 +2929,139 @@ yyreduce:
   switch (yyn)
     {
         case 28:
-#line 412 "conf_parser.y" /* yacc.c:1646  */
+#line 418 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = 0; }
-#line 2917 "conf_parser.c" /* yacc.c:1646  */
+#line 2935 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 30:
-#line 413 "conf_parser.y" /* yacc.c:1646  */
+#line 419 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2923 "conf_parser.c" /* yacc.c:1646  */
+#line 2941 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 31:
-#line 414 "conf_parser.y" /* yacc.c:1646  */
+#line 420 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2929 "conf_parser.c" /* yacc.c:1646  */
+#line 2947 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 32:
-#line 415 "conf_parser.y" /* yacc.c:1646  */
+#line 421 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
-#line 2935 "conf_parser.c" /* yacc.c:1646  */
+#line 2953 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 33:
-#line 416 "conf_parser.y" /* yacc.c:1646  */
+#line 422 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
-#line 2941 "conf_parser.c" /* yacc.c:1646  */
+#line 2959 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 34:
-#line 417 "conf_parser.y" /* yacc.c:1646  */
+#line 423 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
-#line 2947 "conf_parser.c" /* yacc.c:1646  */
+#line 2965 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 35:
-#line 418 "conf_parser.y" /* yacc.c:1646  */
+#line 424 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
-#line 2953 "conf_parser.c" /* yacc.c:1646  */
+#line 2971 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 36:
-#line 419 "conf_parser.y" /* yacc.c:1646  */
+#line 425 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
-#line 2959 "conf_parser.c" /* yacc.c:1646  */
+#line 2977 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 37:
-#line 420 "conf_parser.y" /* yacc.c:1646  */
+#line 426 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
-#line 2965 "conf_parser.c" /* yacc.c:1646  */
+#line 2983 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 38:
-#line 423 "conf_parser.y" /* yacc.c:1646  */
+#line 429 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = 0; }
-#line 2971 "conf_parser.c" /* yacc.c:1646  */
+#line 2989 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 40:
-#line 424 "conf_parser.y" /* yacc.c:1646  */
+#line 430 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2977 "conf_parser.c" /* yacc.c:1646  */
+#line 2995 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 41:
-#line 425 "conf_parser.y" /* yacc.c:1646  */
+#line 431 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2983 "conf_parser.c" /* yacc.c:1646  */
+#line 3001 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 42:
-#line 426 "conf_parser.y" /* yacc.c:1646  */
+#line 432 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
-#line 2989 "conf_parser.c" /* yacc.c:1646  */
+#line 3007 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 43:
-#line 427 "conf_parser.y" /* yacc.c:1646  */
+#line 433 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
-#line 2995 "conf_parser.c" /* yacc.c:1646  */
+#line 3013 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 50:
+  case 44:
+#line 436 "conf_parser.y" /* yacc.c:1646  */
+    { (yyval.size) = 0; }
+#line 3019 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 46:
+#line 437 "conf_parser.y" /* yacc.c:1646  */
+    { (yyval.size) = (uintmax_t)(yyvsp[-1].number) + (yyvsp[0].size); }
+#line 3025 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 47:
+#line 438 "conf_parser.y" /* yacc.c:1646  */
+    { (yyval.size) = (uintmax_t)(yyvsp[-2].number) + (yyvsp[0].size); }
+#line 3031 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 48:
+#line 439 "conf_parser.y" /* yacc.c:1646  */
+    { (yyval.size) = (uintmax_t)(yyvsp[-2].number) * 1024 + (yyvsp[0].size); }
+#line 3037 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 49:
 #line 440 "conf_parser.y" /* yacc.c:1646  */
+    { (yyval.size) = (uintmax_t)(yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].size); }
+#line 3043 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 56:
+#line 453 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     add_conf_module(libio_basename(yylval.string));
 }
-#line 3004 "conf_parser.c" /* yacc.c:1646  */
+#line 3052 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 51:
-#line 446 "conf_parser.y" /* yacc.c:1646  */
+  case 57:
+#line 459 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     mod_add_path(yylval.string);
 }
-#line 3013 "conf_parser.c" /* yacc.c:1646  */
+#line 3061 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 76:
-#line 482 "conf_parser.y" /* yacc.c:1646  */
+  case 82:
+#line 495 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3021,11 +3069,11 @@ yyreduce:
     ConfigServerInfo.ssl_certificate_file = xstrdup(yylval.string);
   }
 }
-#line 3025 "conf_parser.c" /* yacc.c:1646  */
+#line 3073 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 77:
-#line 491 "conf_parser.y" /* yacc.c:1646  */
+  case 83:
+#line 504 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3033,11 +3081,11 @@ yyreduce:
     ConfigServerInfo.rsa_private_key_file = xstrdup(yylval.string);
   }
 }
-#line 3037 "conf_parser.c" /* yacc.c:1646  */
+#line 3085 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 78:
-#line 500 "conf_parser.y" /* yacc.c:1646  */
+  case 84:
+#line 513 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3045,11 +3093,11 @@ yyreduce:
     ConfigServerInfo.ssl_dh_param_file = xstrdup(yylval.string);
   }
 }
-#line 3049 "conf_parser.c" /* yacc.c:1646  */
+#line 3097 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 79:
-#line 509 "conf_parser.y" /* yacc.c:1646  */
+  case 85:
+#line 522 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3057,11 +3105,11 @@ yyreduce:
     ConfigServerInfo.ssl_cipher_list = xstrdup(yylval.string);
   }
 }
-#line 3061 "conf_parser.c" /* yacc.c:1646  */
+#line 3109 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 80:
-#line 518 "conf_parser.y" /* yacc.c:1646  */
+  case 86:
+#line 531 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3069,11 +3117,11 @@ yyreduce:
     ConfigServerInfo.ssl_message_digest_algorithm = xstrdup(yylval.string);
   }
 }
-#line 3073 "conf_parser.c" /* yacc.c:1646  */
+#line 3121 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 81:
-#line 527 "conf_parser.y" /* yacc.c:1646  */
+  case 87:
+#line 540 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3081,64 +3129,64 @@ yyreduce:
     ConfigServerInfo.ssl_dh_elliptic_curve = xstrdup(yylval.string);
   }
 }
-#line 3085 "conf_parser.c" /* yacc.c:1646  */
+#line 3133 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 82:
-#line 536 "conf_parser.y" /* yacc.c:1646  */
+  case 88:
+#line 549 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     ConfigServerInfo.libgeoip_database_options = 0;
 }
-#line 3094 "conf_parser.c" /* yacc.c:1646  */
+#line 3142 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 86:
-#line 543 "conf_parser.y" /* yacc.c:1646  */
+  case 92:
+#line 556 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_LIBGEOIP
   if (conf_parser_ctx.pass == 1)
     ConfigServerInfo.libgeoip_database_options |= GEOIP_STANDARD;
 #endif
 }
-#line 3105 "conf_parser.c" /* yacc.c:1646  */
+#line 3153 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 87:
-#line 549 "conf_parser.y" /* yacc.c:1646  */
+  case 93:
+#line 562 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_LIBGEOIP
   if (conf_parser_ctx.pass == 1)
     ConfigServerInfo.libgeoip_database_options |= GEOIP_MEMORY_CACHE;
 #endif
 }
-#line 3116 "conf_parser.c" /* yacc.c:1646  */
+#line 3164 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 88:
-#line 555 "conf_parser.y" /* yacc.c:1646  */
+  case 94:
+#line 568 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_LIBGEOIP
   if (conf_parser_ctx.pass == 1)
     ConfigServerInfo.libgeoip_database_options |= GEOIP_MMAP_CACHE;
 #endif
 }
-#line 3127 "conf_parser.c" /* yacc.c:1646  */
+#line 3175 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 89:
-#line 561 "conf_parser.y" /* yacc.c:1646  */
+  case 95:
+#line 574 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_LIBGEOIP
   if (conf_parser_ctx.pass == 1)
     ConfigServerInfo.libgeoip_database_options |= GEOIP_CHECK_CACHE;
 #endif
 }
-#line 3138 "conf_parser.c" /* yacc.c:1646  */
+#line 3186 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 90:
-#line 569 "conf_parser.y" /* yacc.c:1646  */
+  case 96:
+#line 582 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3152,11 +3200,11 @@ yyreduce:
 #endif
   }
 }
-#line 3156 "conf_parser.c" /* yacc.c:1646  */
+#line 3204 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 91:
-#line 584 "conf_parser.y" /* yacc.c:1646  */
+  case 97:
+#line 597 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3170,11 +3218,11 @@ yyreduce:
 #endif
   }
 }
-#line 3174 "conf_parser.c" /* yacc.c:1646  */
+#line 3222 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 92:
-#line 599 "conf_parser.y" /* yacc.c:1646  */
+  case 98:
+#line 612 "conf_parser.y" /* yacc.c:1646  */
     {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && !ConfigServerInfo.name)
@@ -3188,11 +3236,11 @@ yyreduce:
     }
   }
 }
-#line 3192 "conf_parser.c" /* yacc.c:1646  */
+#line 3240 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 93:
-#line 614 "conf_parser.y" /* yacc.c:1646  */
+  case 99:
+#line 627 "conf_parser.y" /* yacc.c:1646  */
     {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && !ConfigServerInfo.sid)
@@ -3206,24 +3254,24 @@ yyreduce:
     }
   }
 }
-#line 3210 "conf_parser.c" /* yacc.c:1646  */
+#line 3258 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 94:
-#line 629 "conf_parser.y" /* yacc.c:1646  */
+  case 100:
+#line 642 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
     xfree(ConfigServerInfo.description);
     ConfigServerInfo.description = xstrdup(yylval.string);
-    strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+    client_set_info(&me, ConfigServerInfo.description);
   }
 }
-#line 3223 "conf_parser.c" /* yacc.c:1646  */
+#line 3271 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 95:
-#line 639 "conf_parser.y" /* yacc.c:1646  */
+  case 101:
+#line 652 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3236,11 +3284,11 @@ yyreduce:
     ConfigServerInfo.network_name = xstrdup(yylval.string);
   }
 }
-#line 3240 "conf_parser.c" /* yacc.c:1646  */
+#line 3288 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 96:
-#line 653 "conf_parser.y" /* yacc.c:1646  */
+  case 102:
+#line 666 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3248,11 +3296,11 @@ yyreduce:
   xfree(ConfigServerInfo.network_desc);
   ConfigServerInfo.network_desc = xstrdup(yylval.string);
 }
-#line 3252 "conf_parser.c" /* yacc.c:1646  */
+#line 3300 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 97:
-#line 662 "conf_parser.y" /* yacc.c:1646  */
+  case 103:
+#line 675 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2 && *yylval.string != '*')
   {
@@ -3279,11 +3327,11 @@ yyreduce:
     }
   }
 }
-#line 3283 "conf_parser.c" /* yacc.c:1646  */
+#line 3331 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 98:
-#line 690 "conf_parser.y" /* yacc.c:1646  */
+  case 104:
+#line 703 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2 && *yylval.string != '*')
   {
@@ -3310,11 +3358,11 @@ yyreduce:
     }
   }
 }
-#line 3314 "conf_parser.c" /* yacc.c:1646  */
+#line 3362 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 99:
-#line 718 "conf_parser.y" /* yacc.c:1646  */
+  case 105:
+#line 731 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3338,11 +3386,11 @@ yyreduce:
   else
     ConfigServerInfo.default_max_clients = (yyvsp[-1].number);
 }
-#line 3342 "conf_parser.c" /* yacc.c:1646  */
+#line 3390 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 100:
-#line 743 "conf_parser.y" /* yacc.c:1646  */
+  case 106:
+#line 756 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3363,11 +3411,11 @@ yyreduce:
   else
     ConfigServerInfo.max_nick_length = (yyvsp[-1].number);
 }
-#line 3367 "conf_parser.c" /* yacc.c:1646  */
+#line 3415 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 101:
-#line 765 "conf_parser.y" /* yacc.c:1646  */
+  case 107:
+#line 778 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3388,20 +3436,20 @@ yyreduce:
   else
     ConfigServerInfo.max_topic_length = (yyvsp[-1].number);
 }
-#line 3392 "conf_parser.c" /* yacc.c:1646  */
+#line 3440 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 102:
-#line 787 "conf_parser.y" /* yacc.c:1646  */
+  case 108:
+#line 800 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerInfo.hub = yylval.number;
 }
-#line 3401 "conf_parser.c" /* yacc.c:1646  */
+#line 3449 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 110:
-#line 805 "conf_parser.y" /* yacc.c:1646  */
+  case 116:
+#line 818 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3409,11 +3457,11 @@ yyreduce:
   xfree(ConfigAdminInfo.name);
   ConfigAdminInfo.name = xstrdup(yylval.string);
 }
-#line 3413 "conf_parser.c" /* yacc.c:1646  */
+#line 3461 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 111:
-#line 814 "conf_parser.y" /* yacc.c:1646  */
+  case 117:
+#line 827 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3421,11 +3469,11 @@ yyreduce:
   xfree(ConfigAdminInfo.email);
   ConfigAdminInfo.email = xstrdup(yylval.string);
 }
-#line 3425 "conf_parser.c" /* yacc.c:1646  */
+#line 3473 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 112:
-#line 823 "conf_parser.y" /* yacc.c:1646  */
+  case 118:
+#line 836 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3433,20 +3481,20 @@ yyreduce:
   xfree(ConfigAdminInfo.description);
   ConfigAdminInfo.description = xstrdup(yylval.string);
 }
-#line 3437 "conf_parser.c" /* yacc.c:1646  */
+#line 3485 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 113:
-#line 836 "conf_parser.y" /* yacc.c:1646  */
+  case 119:
+#line 849 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3446 "conf_parser.c" /* yacc.c:1646  */
+#line 3494 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 114:
-#line 840 "conf_parser.y" /* yacc.c:1646  */
+  case 120:
+#line 853 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -3459,38 +3507,38 @@ yyreduce:
   DLINK_FOREACH(node, block_state.mask.list.head)
     motd_add(node->data, block_state.file.buf);
 }
-#line 3463 "conf_parser.c" /* yacc.c:1646  */
+#line 3511 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 120:
-#line 857 "conf_parser.y" /* yacc.c:1646  */
+  case 126:
+#line 870 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3472 "conf_parser.c" /* yacc.c:1646  */
+#line 3520 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 121:
-#line 863 "conf_parser.y" /* yacc.c:1646  */
+  case 127:
+#line 876 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3481 "conf_parser.c" /* yacc.c:1646  */
+#line 3529 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 122:
-#line 873 "conf_parser.y" /* yacc.c:1646  */
+  case 128:
+#line 886 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3490 "conf_parser.c" /* yacc.c:1646  */
+#line 3538 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 123:
-#line 877 "conf_parser.y" /* yacc.c:1646  */
+  case 129:
+#line 890 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3504,38 +3552,38 @@ yyreduce:
   pseudo_register(block_state.name.buf, block_state.nick.buf, block_state.host.buf,
                   block_state.prepend.buf, block_state.command.buf);
 }
-#line 3508 "conf_parser.c" /* yacc.c:1646  */
+#line 3556 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 131:
-#line 895 "conf_parser.y" /* yacc.c:1646  */
+  case 137:
+#line 908 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.command.buf, yylval.string, sizeof(block_state.command.buf));
 }
-#line 3517 "conf_parser.c" /* yacc.c:1646  */
+#line 3565 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 132:
-#line 901 "conf_parser.y" /* yacc.c:1646  */
+  case 138:
+#line 914 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3526 "conf_parser.c" /* yacc.c:1646  */
+#line 3574 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 133:
-#line 907 "conf_parser.y" /* yacc.c:1646  */
+  case 139:
+#line 920 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.prepend.buf, yylval.string, sizeof(block_state.prepend.buf));
 }
-#line 3535 "conf_parser.c" /* yacc.c:1646  */
+#line 3583 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 134:
-#line 913 "conf_parser.y" /* yacc.c:1646  */
+  case 140:
+#line 926 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3552,29 +3600,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 3556 "conf_parser.c" /* yacc.c:1646  */
+#line 3604 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 141:
-#line 941 "conf_parser.y" /* yacc.c:1646  */
+  case 147:
+#line 954 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigLog.use_logging = yylval.number;
 }
-#line 3565 "conf_parser.c" /* yacc.c:1646  */
+#line 3613 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 142:
-#line 947 "conf_parser.y" /* yacc.c:1646  */
+  case 148:
+#line 960 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3574 "conf_parser.c" /* yacc.c:1646  */
+#line 3622 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 143:
-#line 951 "conf_parser.y" /* yacc.c:1646  */
+  case 149:
+#line 964 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3583,119 +3631,119 @@ yyreduce:
     log_set_file(block_state.type.value, block_state.size.value,
                  block_state.file.buf);
 }
-#line 3587 "conf_parser.c" /* yacc.c:1646  */
+#line 3635 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 150:
-#line 967 "conf_parser.y" /* yacc.c:1646  */
+  case 156:
+#line 980 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
 
   strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3598 "conf_parser.c" /* yacc.c:1646  */
+#line 3646 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 151:
-#line 975 "conf_parser.y" /* yacc.c:1646  */
+  case 157:
+#line 988 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.size.value = (yyvsp[-1].number);
 }
-#line 3606 "conf_parser.c" /* yacc.c:1646  */
+#line 3654 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 152:
-#line 978 "conf_parser.y" /* yacc.c:1646  */
+  case 158:
+#line 991 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.size.value = 0;
 }
-#line 3614 "conf_parser.c" /* yacc.c:1646  */
+#line 3662 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 153:
-#line 983 "conf_parser.y" /* yacc.c:1646  */
+  case 159:
+#line 996 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = 0;
 }
-#line 3623 "conf_parser.c" /* yacc.c:1646  */
+#line 3671 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 157:
-#line 990 "conf_parser.y" /* yacc.c:1646  */
+  case 163:
+#line 1003 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_USER;
 }
-#line 3632 "conf_parser.c" /* yacc.c:1646  */
+#line 3680 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 158:
-#line 994 "conf_parser.y" /* yacc.c:1646  */
+  case 164:
+#line 1007 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_OPER;
 }
-#line 3641 "conf_parser.c" /* yacc.c:1646  */
+#line 3689 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 159:
-#line 998 "conf_parser.y" /* yacc.c:1646  */
+  case 165:
+#line 1011 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_XLINE;
 }
-#line 3650 "conf_parser.c" /* yacc.c:1646  */
+#line 3698 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 160:
-#line 1002 "conf_parser.y" /* yacc.c:1646  */
+  case 166:
+#line 1015 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_RESV;
 }
-#line 3659 "conf_parser.c" /* yacc.c:1646  */
+#line 3707 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 161:
-#line 1006 "conf_parser.y" /* yacc.c:1646  */
+  case 167:
+#line 1019 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DLINE;
 }
-#line 3668 "conf_parser.c" /* yacc.c:1646  */
+#line 3716 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 162:
-#line 1010 "conf_parser.y" /* yacc.c:1646  */
+  case 168:
+#line 1023 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KLINE;
 }
-#line 3677 "conf_parser.c" /* yacc.c:1646  */
+#line 3725 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 163:
-#line 1014 "conf_parser.y" /* yacc.c:1646  */
+  case 169:
+#line 1027 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KILL;
 }
-#line 3686 "conf_parser.c" /* yacc.c:1646  */
+#line 3734 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 164:
-#line 1018 "conf_parser.y" /* yacc.c:1646  */
+  case 170:
+#line 1031 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DEBUG;
 }
-#line 3695 "conf_parser.c" /* yacc.c:1646  */
+#line 3743 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 165:
-#line 1028 "conf_parser.y" /* yacc.c:1646  */
+  case 171:
+#line 1041 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3703,11 +3751,11 @@ yyreduce:
   reset_block_state();
   block_state.flags.value |= CONF_FLAGS_ENCRYPTED;
 }
-#line 3707 "conf_parser.c" /* yacc.c:1646  */
+#line 3755 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 166:
-#line 1035 "conf_parser.y" /* yacc.c:1646  */
+  case 172:
+#line 1048 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -3760,47 +3808,47 @@ yyreduce:
     conf_add_class_to_conf(conf, block_state.class.buf);
   }
 }
-#line 3764 "conf_parser.c" /* yacc.c:1646  */
+#line 3812 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 180:
-#line 1102 "conf_parser.y" /* yacc.c:1646  */
+  case 186:
+#line 1115 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3773 "conf_parser.c" /* yacc.c:1646  */
+#line 3821 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 181:
-#line 1108 "conf_parser.y" /* yacc.c:1646  */
+  case 187:
+#line 1121 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3782 "conf_parser.c" /* yacc.c:1646  */
+#line 3830 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 182:
-#line 1114 "conf_parser.y" /* yacc.c:1646  */
+  case 188:
+#line 1127 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 3791 "conf_parser.c" /* yacc.c:1646  */
+#line 3839 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 183:
-#line 1120 "conf_parser.y" /* yacc.c:1646  */
+  case 189:
+#line 1133 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.whois.buf, yylval.string, sizeof(block_state.whois.buf));
 }
-#line 3800 "conf_parser.c" /* yacc.c:1646  */
+#line 3848 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 184:
-#line 1126 "conf_parser.y" /* yacc.c:1646  */
+  case 190:
+#line 1139 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3810,20 +3858,20 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
 }
-#line 3814 "conf_parser.c" /* yacc.c:1646  */
+#line 3862 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 185:
-#line 1137 "conf_parser.y" /* yacc.c:1646  */
+  case 191:
+#line 1150 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 3823 "conf_parser.c" /* yacc.c:1646  */
+#line 3871 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 186:
-#line 1143 "conf_parser.y" /* yacc.c:1646  */
+  case 192:
+#line 1156 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3833,497 +3881,497 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_SSL;
 }
-#line 3837 "conf_parser.c" /* yacc.c:1646  */
+#line 3885 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 187:
-#line 1154 "conf_parser.y" /* yacc.c:1646  */
+  case 193:
+#line 1167 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 3846 "conf_parser.c" /* yacc.c:1646  */
+#line 3894 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 188:
-#line 1160 "conf_parser.y" /* yacc.c:1646  */
+  case 194:
+#line 1173 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value = 0;
 }
-#line 3855 "conf_parser.c" /* yacc.c:1646  */
+#line 3903 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 192:
-#line 1167 "conf_parser.y" /* yacc.c:1646  */
+  case 198:
+#line 1180 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_BOTS;
 }
-#line 3864 "conf_parser.c" /* yacc.c:1646  */
+#line 3912 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 193:
-#line 1171 "conf_parser.y" /* yacc.c:1646  */
+  case 199:
+#line 1184 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CCONN;
 }
-#line 3873 "conf_parser.c" /* yacc.c:1646  */
+#line 3921 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 194:
-#line 1175 "conf_parser.y" /* yacc.c:1646  */
+  case 200:
+#line 1188 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEAF;
 }
-#line 3882 "conf_parser.c" /* yacc.c:1646  */
+#line 3930 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 195:
-#line 1179 "conf_parser.y" /* yacc.c:1646  */
+  case 201:
+#line 1192 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEBUG;
 }
-#line 3891 "conf_parser.c" /* yacc.c:1646  */
+#line 3939 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 196:
-#line 1183 "conf_parser.y" /* yacc.c:1646  */
+  case 202:
+#line 1196 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FULL;
 }
-#line 3900 "conf_parser.c" /* yacc.c:1646  */
+#line 3948 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 197:
-#line 1187 "conf_parser.y" /* yacc.c:1646  */
+  case 203:
+#line 1200 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDDEN;
 }
-#line 3909 "conf_parser.c" /* yacc.c:1646  */
+#line 3957 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 198:
-#line 1191 "conf_parser.y" /* yacc.c:1646  */
+  case 204:
+#line 1204 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDECHANS;
 }
-#line 3918 "conf_parser.c" /* yacc.c:1646  */
+#line 3966 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 199:
-#line 1195 "conf_parser.y" /* yacc.c:1646  */
+  case 205:
+#line 1208 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDEIDLE;
 }
-#line 3927 "conf_parser.c" /* yacc.c:1646  */
+#line 3975 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 200:
-#line 1199 "conf_parser.y" /* yacc.c:1646  */
+  case 206:
+#line 1212 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SKILL;
 }
-#line 3936 "conf_parser.c" /* yacc.c:1646  */
+#line 3984 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 201:
-#line 1203 "conf_parser.y" /* yacc.c:1646  */
+  case 207:
+#line 1216 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_NCHANGE;
 }
-#line 3945 "conf_parser.c" /* yacc.c:1646  */
+#line 3993 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 202:
-#line 1207 "conf_parser.y" /* yacc.c:1646  */
+  case 208:
+#line 1220 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REJ;
 }
-#line 3954 "conf_parser.c" /* yacc.c:1646  */
+#line 4002 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 203:
-#line 1211 "conf_parser.y" /* yacc.c:1646  */
+  case 209:
+#line 1224 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_UNAUTH;
 }
-#line 3963 "conf_parser.c" /* yacc.c:1646  */
+#line 4011 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 204:
-#line 1215 "conf_parser.y" /* yacc.c:1646  */
+  case 210:
+#line 1228 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SPY;
 }
-#line 3972 "conf_parser.c" /* yacc.c:1646  */
+#line 4020 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 205:
-#line 1219 "conf_parser.y" /* yacc.c:1646  */
+  case 211:
+#line 1232 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXTERNAL;
 }
-#line 3981 "conf_parser.c" /* yacc.c:1646  */
+#line 4029 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 206:
-#line 1223 "conf_parser.y" /* yacc.c:1646  */
+  case 212:
+#line 1236 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SERVNOTICE;
 }
-#line 3990 "conf_parser.c" /* yacc.c:1646  */
+#line 4038 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 207:
-#line 1227 "conf_parser.y" /* yacc.c:1646  */
+  case 213:
+#line 1240 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_INVISIBLE;
 }
-#line 3999 "conf_parser.c" /* yacc.c:1646  */
+#line 4047 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 208:
-#line 1231 "conf_parser.y" /* yacc.c:1646  */
+  case 214:
+#line 1244 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_WALLOP;
 }
-#line 4008 "conf_parser.c" /* yacc.c:1646  */
+#line 4056 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 209:
-#line 1235 "conf_parser.y" /* yacc.c:1646  */
+  case 215:
+#line 1248 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SOFTCALLERID;
 }
-#line 4017 "conf_parser.c" /* yacc.c:1646  */
+#line 4065 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 210:
-#line 1239 "conf_parser.y" /* yacc.c:1646  */
+  case 216:
+#line 1252 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CALLERID;
 }
-#line 4026 "conf_parser.c" /* yacc.c:1646  */
+#line 4074 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 211:
-#line 1243 "conf_parser.y" /* yacc.c:1646  */
+  case 217:
+#line 1256 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_LOCOPS;
 }
-#line 4035 "conf_parser.c" /* yacc.c:1646  */
+#line 4083 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 212:
-#line 1247 "conf_parser.y" /* yacc.c:1646  */
+  case 218:
+#line 1260 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REGONLY;
 }
-#line 4044 "conf_parser.c" /* yacc.c:1646  */
+#line 4092 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 213:
-#line 1251 "conf_parser.y" /* yacc.c:1646  */
+  case 219:
+#line 1264 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FARCONNECT;
 }
-#line 4053 "conf_parser.c" /* yacc.c:1646  */
+#line 4101 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 214:
-#line 1257 "conf_parser.y" /* yacc.c:1646  */
+  case 220:
+#line 1270 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = 0;
 }
-#line 4062 "conf_parser.c" /* yacc.c:1646  */
+#line 4110 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 218:
-#line 1264 "conf_parser.y" /* yacc.c:1646  */
+  case 224:
+#line 1277 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL_REMOTE;
 }
-#line 4071 "conf_parser.c" /* yacc.c:1646  */
+#line 4119 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 219:
-#line 1268 "conf_parser.y" /* yacc.c:1646  */
+  case 225:
+#line 1281 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL;
 }
-#line 4080 "conf_parser.c" /* yacc.c:1646  */
+#line 4128 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 220:
-#line 1272 "conf_parser.y" /* yacc.c:1646  */
+  case 226:
+#line 1285 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT_REMOTE;
 }
-#line 4089 "conf_parser.c" /* yacc.c:1646  */
+#line 4137 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 221:
-#line 1276 "conf_parser.y" /* yacc.c:1646  */
+  case 227:
+#line 1289 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT;
 }
-#line 4098 "conf_parser.c" /* yacc.c:1646  */
+#line 4146 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 222:
-#line 1280 "conf_parser.y" /* yacc.c:1646  */
+  case 228:
+#line 1293 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT_REMOTE;
 }
-#line 4107 "conf_parser.c" /* yacc.c:1646  */
+#line 4155 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 223:
-#line 1284 "conf_parser.y" /* yacc.c:1646  */
+  case 229:
+#line 1297 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT;
 }
-#line 4116 "conf_parser.c" /* yacc.c:1646  */
+#line 4164 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 224:
-#line 1288 "conf_parser.y" /* yacc.c:1646  */
+  case 230:
+#line 1301 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KLINE;
 }
-#line 4125 "conf_parser.c" /* yacc.c:1646  */
+#line 4173 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 225:
-#line 1292 "conf_parser.y" /* yacc.c:1646  */
+  case 231:
+#line 1305 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNKLINE;
 }
-#line 4134 "conf_parser.c" /* yacc.c:1646  */
+#line 4182 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 226:
-#line 1296 "conf_parser.y" /* yacc.c:1646  */
+  case 232:
+#line 1309 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DLINE;
 }
-#line 4143 "conf_parser.c" /* yacc.c:1646  */
+#line 4191 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 227:
-#line 1300 "conf_parser.y" /* yacc.c:1646  */
+  case 233:
+#line 1313 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNDLINE;
 }
-#line 4152 "conf_parser.c" /* yacc.c:1646  */
+#line 4200 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 228:
-#line 1304 "conf_parser.y" /* yacc.c:1646  */
+  case 234:
+#line 1317 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_XLINE;
 }
-#line 4161 "conf_parser.c" /* yacc.c:1646  */
+#line 4209 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 229:
-#line 1308 "conf_parser.y" /* yacc.c:1646  */
+  case 235:
+#line 1321 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNXLINE;
 }
-#line 4170 "conf_parser.c" /* yacc.c:1646  */
+#line 4218 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 230:
-#line 1312 "conf_parser.y" /* yacc.c:1646  */
+  case 236:
+#line 1325 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DIE;
 }
-#line 4179 "conf_parser.c" /* yacc.c:1646  */
+#line 4227 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 231:
-#line 1316 "conf_parser.y" /* yacc.c:1646  */
+  case 237:
+#line 1329 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESTART;
 }
-#line 4188 "conf_parser.c" /* yacc.c:1646  */
+#line 4236 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 232:
-#line 1320 "conf_parser.y" /* yacc.c:1646  */
+  case 238:
+#line 1333 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH_REMOTE;
 }
-#line 4197 "conf_parser.c" /* yacc.c:1646  */
+#line 4245 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 233:
-#line 1324 "conf_parser.y" /* yacc.c:1646  */
+  case 239:
+#line 1337 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH;
 }
-#line 4206 "conf_parser.c" /* yacc.c:1646  */
+#line 4254 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 234:
-#line 1328 "conf_parser.y" /* yacc.c:1646  */
+  case 240:
+#line 1341 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_ADMIN;
 }
-#line 4215 "conf_parser.c" /* yacc.c:1646  */
+#line 4263 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 235:
-#line 1332 "conf_parser.y" /* yacc.c:1646  */
+  case 241:
+#line 1345 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_GLOBOPS;
 }
-#line 4224 "conf_parser.c" /* yacc.c:1646  */
+#line 4272 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 236:
-#line 1336 "conf_parser.y" /* yacc.c:1646  */
+  case 242:
+#line 1349 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_WALLOPS;
 }
-#line 4233 "conf_parser.c" /* yacc.c:1646  */
+#line 4281 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 237:
-#line 1340 "conf_parser.y" /* yacc.c:1646  */
+  case 243:
+#line 1353 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_LOCOPS;
 }
-#line 4242 "conf_parser.c" /* yacc.c:1646  */
+#line 4290 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 238:
-#line 1344 "conf_parser.y" /* yacc.c:1646  */
+  case 244:
+#line 1357 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REMOTEBAN;
 }
-#line 4251 "conf_parser.c" /* yacc.c:1646  */
+#line 4299 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 239:
-#line 1348 "conf_parser.y" /* yacc.c:1646  */
+  case 245:
+#line 1361 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SET;
 }
-#line 4260 "conf_parser.c" /* yacc.c:1646  */
+#line 4308 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 240:
-#line 1352 "conf_parser.y" /* yacc.c:1646  */
+  case 246:
+#line 1365 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_MODULE;
 }
-#line 4269 "conf_parser.c" /* yacc.c:1646  */
+#line 4317 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 241:
-#line 1356 "conf_parser.y" /* yacc.c:1646  */
+  case 247:
+#line 1369 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_OPME;
 }
-#line 4278 "conf_parser.c" /* yacc.c:1646  */
+#line 4326 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 242:
-#line 1360 "conf_parser.y" /* yacc.c:1646  */
+  case 248:
+#line 1373 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_NICK_RESV;
 }
-#line 4287 "conf_parser.c" /* yacc.c:1646  */
+#line 4335 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 243:
-#line 1364 "conf_parser.y" /* yacc.c:1646  */
+  case 249:
+#line 1377 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_JOIN_RESV;
 }
-#line 4296 "conf_parser.c" /* yacc.c:1646  */
+#line 4344 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 244:
-#line 1368 "conf_parser.y" /* yacc.c:1646  */
+  case 250:
+#line 1381 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESV;
 }
-#line 4305 "conf_parser.c" /* yacc.c:1646  */
+#line 4353 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 245:
-#line 1372 "conf_parser.y" /* yacc.c:1646  */
+  case 251:
+#line 1385 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNRESV;
 }
-#line 4314 "conf_parser.c" /* yacc.c:1646  */
+#line 4362 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 246:
-#line 1376 "conf_parser.y" /* yacc.c:1646  */
+  case 252:
+#line 1389 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CLOSE;
 }
-#line 4323 "conf_parser.c" /* yacc.c:1646  */
+#line 4371 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 247:
-#line 1386 "conf_parser.y" /* yacc.c:1646  */
+  case 253:
+#line 1399 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4336,11 +4384,11 @@ yyreduce:
   block_state.max_sendq.value = DEFAULT_SENDQ;
   block_state.max_recvq.value = DEFAULT_RECVQ;
 }
-#line 4340 "conf_parser.c" /* yacc.c:1646  */
+#line 4388 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 248:
-#line 1398 "conf_parser.y" /* yacc.c:1646  */
+  case 254:
+#line 1411 "conf_parser.y" /* yacc.c:1646  */
     {
   struct ClassItem *class = NULL;
 
@@ -4383,129 +4431,129 @@ yyreduce:
   class->cidr_bitlen_ipv6 = block_state.cidr_bitlen_ipv6.value;
   class->number_per_cidr = block_state.number_per_cidr.value;
 }
-#line 4387 "conf_parser.c" /* yacc.c:1646  */
+#line 4435 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 268:
-#line 1461 "conf_parser.y" /* yacc.c:1646  */
+  case 274:
+#line 1474 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4396 "conf_parser.c" /* yacc.c:1646  */
+#line 4444 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 269:
-#line 1467 "conf_parser.y" /* yacc.c:1646  */
+  case 275:
+#line 1480 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.ping_freq.value = (yyvsp[-1].number);
 }
-#line 4405 "conf_parser.c" /* yacc.c:1646  */
+#line 4453 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 270:
-#line 1473 "conf_parser.y" /* yacc.c:1646  */
+  case 276:
+#line 1486 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip.value = (yyvsp[-1].number);
 }
-#line 4414 "conf_parser.c" /* yacc.c:1646  */
+#line 4462 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 271:
-#line 1479 "conf_parser.y" /* yacc.c:1646  */
+  case 277:
+#line 1492 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.con_freq.value = (yyvsp[-1].number);
 }
-#line 4423 "conf_parser.c" /* yacc.c:1646  */
+#line 4471 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 272:
-#line 1485 "conf_parser.y" /* yacc.c:1646  */
+  case 278:
+#line 1498 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_channels.value = (yyvsp[-1].number);
 }
-#line 4432 "conf_parser.c" /* yacc.c:1646  */
+#line 4480 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 273:
-#line 1491 "conf_parser.y" /* yacc.c:1646  */
+  case 279:
+#line 1504 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_total.value = (yyvsp[-1].number);
 }
-#line 4441 "conf_parser.c" /* yacc.c:1646  */
+#line 4489 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 274:
-#line 1497 "conf_parser.y" /* yacc.c:1646  */
+  case 280:
+#line 1510 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_global.value = (yyvsp[-1].number);
 }
-#line 4450 "conf_parser.c" /* yacc.c:1646  */
+#line 4498 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 275:
-#line 1503 "conf_parser.y" /* yacc.c:1646  */
+  case 281:
+#line 1516 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_local.value = (yyvsp[-1].number);
 }
-#line 4459 "conf_parser.c" /* yacc.c:1646  */
+#line 4507 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 276:
-#line 1509 "conf_parser.y" /* yacc.c:1646  */
+  case 282:
+#line 1522 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_sendq.value = (yyvsp[-1].number);
 }
-#line 4468 "conf_parser.c" /* yacc.c:1646  */
+#line 4516 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 277:
-#line 1515 "conf_parser.y" /* yacc.c:1646  */
+  case 283:
+#line 1528 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     if ((yyvsp[-1].number) >= CLIENT_FLOOD_MIN && (yyvsp[-1].number) <= CLIENT_FLOOD_MAX)
       block_state.max_recvq.value = (yyvsp[-1].number);
 }
-#line 4478 "conf_parser.c" /* yacc.c:1646  */
+#line 4526 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 278:
-#line 1522 "conf_parser.y" /* yacc.c:1646  */
+  case 284:
+#line 1535 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv4.value = (yyvsp[-1].number) > 32 ? 32 : (yyvsp[-1].number);
 }
-#line 4487 "conf_parser.c" /* yacc.c:1646  */
+#line 4535 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 279:
-#line 1528 "conf_parser.y" /* yacc.c:1646  */
+  case 285:
+#line 1541 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv6.value = (yyvsp[-1].number) > 128 ? 128 : (yyvsp[-1].number);
 }
-#line 4496 "conf_parser.c" /* yacc.c:1646  */
+#line 4544 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 280:
-#line 1534 "conf_parser.y" /* yacc.c:1646  */
+  case 286:
+#line 1547 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.number_per_cidr.value = (yyvsp[-1].number);
 }
-#line 4505 "conf_parser.c" /* yacc.c:1646  */
+#line 4553 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 281:
-#line 1540 "conf_parser.y" /* yacc.c:1646  */
+  case 287:
+#line 1553 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4513,11 +4561,11 @@ yyreduce:
   block_state.min_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4517 "conf_parser.c" /* yacc.c:1646  */
+#line 4565 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 282:
-#line 1549 "conf_parser.y" /* yacc.c:1646  */
+  case 288:
+#line 1562 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4525,88 +4573,88 @@ yyreduce:
   block_state.max_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4529 "conf_parser.c" /* yacc.c:1646  */
+#line 4577 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 283:
-#line 1558 "conf_parser.y" /* yacc.c:1646  */
+  case 289:
+#line 1571 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value &= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4538 "conf_parser.c" /* yacc.c:1646  */
+#line 4586 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 287:
-#line 1565 "conf_parser.y" /* yacc.c:1646  */
+  case 293:
+#line 1578 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_RANDOM_IDLE;
 }
-#line 4547 "conf_parser.c" /* yacc.c:1646  */
+#line 4595 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 288:
-#line 1569 "conf_parser.y" /* yacc.c:1646  */
+  case 294:
+#line 1582 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_HIDE_IDLE_FROM_OPERS;
 }
-#line 4556 "conf_parser.c" /* yacc.c:1646  */
+#line 4604 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 289:
-#line 1579 "conf_parser.y" /* yacc.c:1646  */
+  case 295:
+#line 1592 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4565 "conf_parser.c" /* yacc.c:1646  */
+#line 4613 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 291:
-#line 1585 "conf_parser.y" /* yacc.c:1646  */
+  case 297:
+#line 1598 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.flags.value = 0;
 }
-#line 4573 "conf_parser.c" /* yacc.c:1646  */
+#line 4621 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 295:
-#line 1591 "conf_parser.y" /* yacc.c:1646  */
+  case 301:
+#line 1604 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_SSL;
 }
-#line 4582 "conf_parser.c" /* yacc.c:1646  */
+#line 4630 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 296:
-#line 1595 "conf_parser.y" /* yacc.c:1646  */
+  case 302:
+#line 1608 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_HIDDEN;
 }
-#line 4591 "conf_parser.c" /* yacc.c:1646  */
+#line 4639 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 297:
-#line 1599 "conf_parser.y" /* yacc.c:1646  */
+  case 303:
+#line 1612 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_SERVER;
 }
-#line 4600 "conf_parser.c" /* yacc.c:1646  */
+#line 4648 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 305:
-#line 1607 "conf_parser.y" /* yacc.c:1646  */
+  case 311:
+#line 1620 "conf_parser.y" /* yacc.c:1646  */
     { block_state.flags.value = 0; }
-#line 4606 "conf_parser.c" /* yacc.c:1646  */
+#line 4654 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 309:
-#line 1612 "conf_parser.y" /* yacc.c:1646  */
+  case 315:
+#line 1625 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4620,11 +4668,11 @@ yyreduce:
     listener_add((yyvsp[0].number), block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4624 "conf_parser.c" /* yacc.c:1646  */
+#line 4672 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 310:
-#line 1625 "conf_parser.y" /* yacc.c:1646  */
+  case 316:
+#line 1638 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4640,38 +4688,38 @@ yyreduce:
       listener_add(i, block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4644 "conf_parser.c" /* yacc.c:1646  */
+#line 4692 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 311:
-#line 1642 "conf_parser.y" /* yacc.c:1646  */
+  case 317:
+#line 1655 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4653 "conf_parser.c" /* yacc.c:1646  */
+#line 4701 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 312:
-#line 1648 "conf_parser.y" /* yacc.c:1646  */
+  case 318:
+#line 1661 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4662 "conf_parser.c" /* yacc.c:1646  */
+#line 4710 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 313:
-#line 1658 "conf_parser.y" /* yacc.c:1646  */
+  case 319:
+#line 1671 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4671 "conf_parser.c" /* yacc.c:1646  */
+#line 4719 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 314:
-#line 1662 "conf_parser.y" /* yacc.c:1646  */
+  case 320:
+#line 1675 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -4712,38 +4760,38 @@ yyreduce:
     add_conf_by_address(CONF_CLIENT, conf);
   }
 }
-#line 4716 "conf_parser.c" /* yacc.c:1646  */
+#line 4764 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 326:
-#line 1715 "conf_parser.y" /* yacc.c:1646  */
+  case 332:
+#line 1728 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4725 "conf_parser.c" /* yacc.c:1646  */
+#line 4773 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 327:
-#line 1721 "conf_parser.y" /* yacc.c:1646  */
+  case 333:
+#line 1734 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4734 "conf_parser.c" /* yacc.c:1646  */
+#line 4782 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 328:
-#line 1727 "conf_parser.y" /* yacc.c:1646  */
+  case 334:
+#line 1740 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4743 "conf_parser.c" /* yacc.c:1646  */
+#line 4791 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 329:
-#line 1733 "conf_parser.y" /* yacc.c:1646  */
+  case 335:
+#line 1746 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4753,110 +4801,110 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 4757 "conf_parser.c" /* yacc.c:1646  */
+#line 4805 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 330:
-#line 1744 "conf_parser.y" /* yacc.c:1646  */
+  case 336:
+#line 1757 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value &= (CONF_FLAGS_ENCRYPTED | CONF_FLAGS_SPOOF_IP);
 }
-#line 4766 "conf_parser.c" /* yacc.c:1646  */
+#line 4814 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 334:
-#line 1751 "conf_parser.y" /* yacc.c:1646  */
+  case 340:
+#line 1764 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_SPOOF_NOTICE;
 }
-#line 4775 "conf_parser.c" /* yacc.c:1646  */
+#line 4823 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 335:
-#line 1755 "conf_parser.y" /* yacc.c:1646  */
+  case 341:
+#line 1768 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NOLIMIT;
 }
-#line 4784 "conf_parser.c" /* yacc.c:1646  */
+#line 4832 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 336:
-#line 1759 "conf_parser.y" /* yacc.c:1646  */
+  case 342:
+#line 1772 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTKLINE;
 }
-#line 4793 "conf_parser.c" /* yacc.c:1646  */
+#line 4841 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 337:
-#line 1763 "conf_parser.y" /* yacc.c:1646  */
+  case 343:
+#line 1776 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTXLINE;
 }
-#line 4802 "conf_parser.c" /* yacc.c:1646  */
+#line 4850 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 338:
-#line 1767 "conf_parser.y" /* yacc.c:1646  */
+  case 344:
+#line 1780 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_IDENTD;
 }
-#line 4811 "conf_parser.c" /* yacc.c:1646  */
+#line 4859 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 339:
-#line 1771 "conf_parser.y" /* yacc.c:1646  */
+  case 345:
+#line 1784 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_CAN_FLOOD;
 }
-#line 4820 "conf_parser.c" /* yacc.c:1646  */
+#line 4868 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 340:
-#line 1775 "conf_parser.y" /* yacc.c:1646  */
+  case 346:
+#line 1788 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NO_TILDE;
 }
-#line 4829 "conf_parser.c" /* yacc.c:1646  */
+#line 4877 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 341:
-#line 1779 "conf_parser.y" /* yacc.c:1646  */
+  case 347:
+#line 1792 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTRESV;
 }
-#line 4838 "conf_parser.c" /* yacc.c:1646  */
+#line 4886 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 342:
-#line 1783 "conf_parser.y" /* yacc.c:1646  */
+  case 348:
+#line 1796 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_WEBIRC;
 }
-#line 4847 "conf_parser.c" /* yacc.c:1646  */
+#line 4895 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 343:
-#line 1787 "conf_parser.y" /* yacc.c:1646  */
+  case 349:
+#line 1800 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_PASSWORD;
 }
-#line 4856 "conf_parser.c" /* yacc.c:1646  */
+#line 4904 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 344:
-#line 1793 "conf_parser.y" /* yacc.c:1646  */
+  case 350:
+#line 1806 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4869,11 +4917,11 @@ yyreduce:
   else
     ilog(LOG_TYPE_IRCD, "Spoof either is too long or contains invalid characters. Ignoring it.");
 }
-#line 4873 "conf_parser.c" /* yacc.c:1646  */
+#line 4921 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 345:
-#line 1807 "conf_parser.y" /* yacc.c:1646  */
+  case 351:
+#line 1820 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4881,11 +4929,11 @@ yyreduce:
   strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
   block_state.flags.value |= CONF_FLAGS_REDIR;
 }
-#line 4885 "conf_parser.c" /* yacc.c:1646  */
+#line 4933 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 346:
-#line 1816 "conf_parser.y" /* yacc.c:1646  */
+  case 352:
+#line 1829 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4893,11 +4941,11 @@ yyreduce:
   block_state.flags.value |= CONF_FLAGS_REDIR;
   block_state.port.value = (yyvsp[-1].number);
 }
-#line 4897 "conf_parser.c" /* yacc.c:1646  */
+#line 4945 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 347:
-#line 1829 "conf_parser.y" /* yacc.c:1646  */
+  case 353:
+#line 1842 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4905,49 +4953,49 @@ yyreduce:
   reset_block_state();
   strlcpy(block_state.rpass.buf, CONF_NOREASON, sizeof(block_state.rpass.buf));
 }
-#line 4909 "conf_parser.c" /* yacc.c:1646  */
+#line 4957 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 348:
-#line 1836 "conf_parser.y" /* yacc.c:1646  */
+  case 354:
+#line 1849 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
 
   resv_make(block_state.name.buf, block_state.rpass.buf, &block_state.mask.list);
 }
-#line 4920 "conf_parser.c" /* yacc.c:1646  */
+#line 4968 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 355:
-#line 1847 "conf_parser.y" /* yacc.c:1646  */
+  case 361:
+#line 1860 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4929 "conf_parser.c" /* yacc.c:1646  */
+#line 4977 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 356:
-#line 1853 "conf_parser.y" /* yacc.c:1646  */
+  case 362:
+#line 1866 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4938 "conf_parser.c" /* yacc.c:1646  */
+#line 4986 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 357:
-#line 1859 "conf_parser.y" /* yacc.c:1646  */
+  case 363:
+#line 1872 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4947 "conf_parser.c" /* yacc.c:1646  */
+#line 4995 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 363:
-#line 1874 "conf_parser.y" /* yacc.c:1646  */
+  case 369:
+#line 1887 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4958,11 +5006,11 @@ yyreduce:
     service->name = xstrdup(yylval.string);
   }
 }
-#line 4962 "conf_parser.c" /* yacc.c:1646  */
+#line 5010 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 364:
-#line 1890 "conf_parser.y" /* yacc.c:1646  */
+  case 370:
+#line 1903 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4974,11 +5022,11 @@ yyreduce:
   strlcpy(block_state.host.buf, "*", sizeof(block_state.host.buf));
   block_state.flags.value = SHARED_ALL;
 }
-#line 4978 "conf_parser.c" /* yacc.c:1646  */
+#line 5026 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 365:
-#line 1901 "conf_parser.y" /* yacc.c:1646  */
+  case 371:
+#line 1914 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4989,20 +5037,20 @@ yyreduce:
   shared->user = xstrdup(block_state.user.buf);
   shared->host = xstrdup(block_state.host.buf);
 }
-#line 4993 "conf_parser.c" /* yacc.c:1646  */
+#line 5041 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 372:
-#line 1916 "conf_parser.y" /* yacc.c:1646  */
+  case 378:
+#line 1929 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5002 "conf_parser.c" /* yacc.c:1646  */
+#line 5050 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 373:
-#line 1922 "conf_parser.y" /* yacc.c:1646  */
+  case 379:
+#line 1935 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5020,110 +5068,110 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 5024 "conf_parser.c" /* yacc.c:1646  */
+#line 5072 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 374:
-#line 1941 "conf_parser.y" /* yacc.c:1646  */
+  case 380:
+#line 1954 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 5033 "conf_parser.c" /* yacc.c:1646  */
+#line 5081 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 378:
-#line 1948 "conf_parser.y" /* yacc.c:1646  */
+  case 384:
+#line 1961 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_KLINE;
 }
-#line 5042 "conf_parser.c" /* yacc.c:1646  */
+#line 5090 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 379:
-#line 1952 "conf_parser.y" /* yacc.c:1646  */
+  case 385:
+#line 1965 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNKLINE;
 }
-#line 5051 "conf_parser.c" /* yacc.c:1646  */
+#line 5099 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 380:
-#line 1956 "conf_parser.y" /* yacc.c:1646  */
+  case 386:
+#line 1969 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_DLINE;
 }
-#line 5060 "conf_parser.c" /* yacc.c:1646  */
+#line 5108 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 381:
-#line 1960 "conf_parser.y" /* yacc.c:1646  */
+  case 387:
+#line 1973 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNDLINE;
 }
-#line 5069 "conf_parser.c" /* yacc.c:1646  */
+#line 5117 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 382:
-#line 1964 "conf_parser.y" /* yacc.c:1646  */
+  case 388:
+#line 1977 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_XLINE;
 }
-#line 5078 "conf_parser.c" /* yacc.c:1646  */
+#line 5126 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 383:
-#line 1968 "conf_parser.y" /* yacc.c:1646  */
+  case 389:
+#line 1981 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNXLINE;
 }
-#line 5087 "conf_parser.c" /* yacc.c:1646  */
+#line 5135 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 384:
-#line 1972 "conf_parser.y" /* yacc.c:1646  */
+  case 390:
+#line 1985 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_RESV;
 }
-#line 5096 "conf_parser.c" /* yacc.c:1646  */
+#line 5144 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 385:
-#line 1976 "conf_parser.y" /* yacc.c:1646  */
+  case 391:
+#line 1989 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNRESV;
 }
-#line 5105 "conf_parser.c" /* yacc.c:1646  */
+#line 5153 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 386:
-#line 1980 "conf_parser.y" /* yacc.c:1646  */
+  case 392:
+#line 1993 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_LOCOPS;
 }
-#line 5114 "conf_parser.c" /* yacc.c:1646  */
+#line 5162 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 387:
-#line 1984 "conf_parser.y" /* yacc.c:1646  */
+  case 393:
+#line 1997 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = SHARED_ALL;
 }
-#line 5123 "conf_parser.c" /* yacc.c:1646  */
+#line 5171 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 388:
-#line 1994 "conf_parser.y" /* yacc.c:1646  */
+  case 394:
+#line 2007 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5133,11 +5181,11 @@ yyreduce:
   strlcpy(block_state.name.buf, "*", sizeof(block_state.name.buf));
   block_state.flags.value = CLUSTER_ALL;
 }
-#line 5137 "conf_parser.c" /* yacc.c:1646  */
+#line 5185 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 389:
-#line 2003 "conf_parser.y" /* yacc.c:1646  */
+  case 395:
+#line 2016 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5146,119 +5194,119 @@ yyreduce:
   cluster->type = block_state.flags.value;
   cluster->server = xstrdup(block_state.name.buf);
 }
-#line 5150 "conf_parser.c" /* yacc.c:1646  */
+#line 5198 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 395:
-#line 2016 "conf_parser.y" /* yacc.c:1646  */
+  case 401:
+#line 2029 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5159 "conf_parser.c" /* yacc.c:1646  */
+#line 5207 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 396:
-#line 2022 "conf_parser.y" /* yacc.c:1646  */
+  case 402:
+#line 2035 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 5168 "conf_parser.c" /* yacc.c:1646  */
+#line 5216 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 400:
-#line 2029 "conf_parser.y" /* yacc.c:1646  */
+  case 406:
+#line 2042 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_KLINE;
 }
-#line 5177 "conf_parser.c" /* yacc.c:1646  */
+#line 5225 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 401:
-#line 2033 "conf_parser.y" /* yacc.c:1646  */
+  case 407:
+#line 2046 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNKLINE;
 }
-#line 5186 "conf_parser.c" /* yacc.c:1646  */
+#line 5234 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 402:
-#line 2037 "conf_parser.y" /* yacc.c:1646  */
+  case 408:
+#line 2050 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_DLINE;
 }
-#line 5195 "conf_parser.c" /* yacc.c:1646  */
+#line 5243 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 403:
-#line 2041 "conf_parser.y" /* yacc.c:1646  */
+  case 409:
+#line 2054 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNDLINE;
 }
-#line 5204 "conf_parser.c" /* yacc.c:1646  */
+#line 5252 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 404:
-#line 2045 "conf_parser.y" /* yacc.c:1646  */
+  case 410:
+#line 2058 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_XLINE;
 }
-#line 5213 "conf_parser.c" /* yacc.c:1646  */
+#line 5261 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 405:
-#line 2049 "conf_parser.y" /* yacc.c:1646  */
+  case 411:
+#line 2062 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNXLINE;
 }
-#line 5222 "conf_parser.c" /* yacc.c:1646  */
+#line 5270 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 406:
-#line 2053 "conf_parser.y" /* yacc.c:1646  */
+  case 412:
+#line 2066 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_RESV;
 }
-#line 5231 "conf_parser.c" /* yacc.c:1646  */
+#line 5279 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 407:
-#line 2057 "conf_parser.y" /* yacc.c:1646  */
+  case 413:
+#line 2070 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNRESV;
 }
-#line 5240 "conf_parser.c" /* yacc.c:1646  */
+#line 5288 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 408:
-#line 2061 "conf_parser.y" /* yacc.c:1646  */
+  case 414:
+#line 2074 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_LOCOPS;
 }
-#line 5249 "conf_parser.c" /* yacc.c:1646  */
+#line 5297 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 409:
-#line 2065 "conf_parser.y" /* yacc.c:1646  */
+  case 415:
+#line 2078 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = CLUSTER_ALL;
 }
-#line 5258 "conf_parser.c" /* yacc.c:1646  */
+#line 5306 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 410:
-#line 2075 "conf_parser.y" /* yacc.c:1646  */
+  case 416:
+#line 2088 "conf_parser.y" /* yacc.c:1646  */
     {
 
   if (conf_parser_ctx.pass != 2)
@@ -5268,11 +5316,11 @@ yyreduce:
   block_state.aftype.value = AF_INET;
   block_state.port.value = PORTNUM;
 }
-#line 5272 "conf_parser.c" /* yacc.c:1646  */
+#line 5320 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 411:
-#line 2084 "conf_parser.y" /* yacc.c:1646  */
+  case 417:
+#line 2097 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
   struct addrinfo hints, *res;
@@ -5334,38 +5382,38 @@ yyreduce:
   conf_add_class_to_conf(conf, block_state.class.buf);
   lookup_confhost(conf);
 }
-#line 5338 "conf_parser.c" /* yacc.c:1646  */
+#line 5386 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 429:
-#line 2164 "conf_parser.y" /* yacc.c:1646  */
+  case 435:
+#line 2177 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5347 "conf_parser.c" /* yacc.c:1646  */
+#line 5395 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 430:
-#line 2170 "conf_parser.y" /* yacc.c:1646  */
+  case 436:
+#line 2183 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.host.buf, yylval.string, sizeof(block_state.host.buf));
 }
-#line 5356 "conf_parser.c" /* yacc.c:1646  */
+#line 5404 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 431:
-#line 2176 "conf_parser.y" /* yacc.c:1646  */
+  case 437:
+#line 2189 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.bind.buf, yylval.string, sizeof(block_state.bind.buf));
 }
-#line 5365 "conf_parser.c" /* yacc.c:1646  */
+#line 5413 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 432:
-#line 2182 "conf_parser.y" /* yacc.c:1646  */
+  case 438:
+#line 2195 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5377,11 +5425,11 @@ yyreduce:
   else
     strlcpy(block_state.spass.buf, yylval.string, sizeof(block_state.spass.buf));
 }
-#line 5381 "conf_parser.c" /* yacc.c:1646  */
+#line 5429 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 433:
-#line 2195 "conf_parser.y" /* yacc.c:1646  */
+  case 439:
+#line 2208 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5393,73 +5441,91 @@ yyreduce:
   else
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5397 "conf_parser.c" /* yacc.c:1646  */
+#line 5445 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 434:
-#line 2208 "conf_parser.y" /* yacc.c:1646  */
+  case 440:
+#line 2221 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 5406 "conf_parser.c" /* yacc.c:1646  */
+#line 5454 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 435:
-#line 2214 "conf_parser.y" /* yacc.c:1646  */
+  case 441:
+#line 2227 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = (yyvsp[-1].number);
 }
-#line 5415 "conf_parser.c" /* yacc.c:1646  */
+#line 5463 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 436:
-#line 2220 "conf_parser.y" /* yacc.c:1646  */
+  case 442:
+#line 2233 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET;
 }
-#line 5424 "conf_parser.c" /* yacc.c:1646  */
+#line 5472 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 437:
-#line 2224 "conf_parser.y" /* yacc.c:1646  */
+  case 443:
+#line 2237 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET6;
 }
-#line 5433 "conf_parser.c" /* yacc.c:1646  */
+#line 5481 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 438:
-#line 2230 "conf_parser.y" /* yacc.c:1646  */
+  case 444:
+#line 2243 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.flags.value &= CONF_FLAGS_ENCRYPTED;
 }
-#line 5441 "conf_parser.c" /* yacc.c:1646  */
+#line 5489 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 442:
-#line 2236 "conf_parser.y" /* yacc.c:1646  */
+  case 448:
+#line 2249 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_ALLOW_AUTO_CONN;
 }
-#line 5450 "conf_parser.c" /* yacc.c:1646  */
+#line 5498 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 443:
-#line 2240 "conf_parser.y" /* yacc.c:1646  */
+  case 449:
+#line 2253 "conf_parser.y" /* yacc.c:1646  */
+    {
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_COMPRESSED;
+}
+#line 5507 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 450:
+#line 2257 "conf_parser.y" /* yacc.c:1646  */
+    {
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_BSIZE;
+}
+#line 5516 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 451:
+#line 2261 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_SSL;
 }
-#line 5459 "conf_parser.c" /* yacc.c:1646  */
+#line 5525 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 444:
-#line 2246 "conf_parser.y" /* yacc.c:1646  */
+  case 452:
+#line 2267 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5469,38 +5535,38 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 5473 "conf_parser.c" /* yacc.c:1646  */
+#line 5539 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 445:
-#line 2257 "conf_parser.y" /* yacc.c:1646  */
+  case 453:
+#line 2278 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.hub.list);
 }
-#line 5482 "conf_parser.c" /* yacc.c:1646  */
+#line 5548 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 446:
-#line 2263 "conf_parser.y" /* yacc.c:1646  */
+  case 454:
+#line 2284 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.leaf.list);
 }
-#line 5491 "conf_parser.c" /* yacc.c:1646  */
+#line 5557 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 447:
-#line 2269 "conf_parser.y" /* yacc.c:1646  */
+  case 455:
+#line 2290 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 5500 "conf_parser.c" /* yacc.c:1646  */
+#line 5566 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 448:
-#line 2275 "conf_parser.y" /* yacc.c:1646  */
+  case 456:
+#line 2296 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_TLS
   if (conf_parser_ctx.pass == 2)
@@ -5510,20 +5576,20 @@ yyreduce:
     conf_error_report("Ignoring connect::ciphers -- no TLS support");
 #endif
 }
-#line 5514 "conf_parser.c" /* yacc.c:1646  */
+#line 5580 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 449:
-#line 2290 "conf_parser.y" /* yacc.c:1646  */
+  case 457:
+#line 2311 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5523 "conf_parser.c" /* yacc.c:1646  */
+#line 5589 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 450:
-#line 2294 "conf_parser.y" /* yacc.c:1646  */
+  case 458:
+#line 2315 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
 
@@ -5544,11 +5610,11 @@ yyreduce:
     conf->reason = xstrdup(CONF_NOREASON);
   add_conf_by_address(CONF_KLINE, conf);
 }
-#line 5548 "conf_parser.c" /* yacc.c:1646  */
+#line 5614 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 456:
-#line 2319 "conf_parser.y" /* yacc.c:1646  */
+  case 464:
+#line 2340 "conf_parser.y" /* yacc.c:1646  */
     {
 
   if (conf_parser_ctx.pass == 2)
@@ -5567,29 +5633,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 5571 "conf_parser.c" /* yacc.c:1646  */
+#line 5637 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 457:
-#line 2339 "conf_parser.y" /* yacc.c:1646  */
+  case 465:
+#line 2360 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5580 "conf_parser.c" /* yacc.c:1646  */
+#line 5646 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 458:
-#line 2349 "conf_parser.y" /* yacc.c:1646  */
+  case 466:
+#line 2370 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5589 "conf_parser.c" /* yacc.c:1646  */
+#line 5655 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 459:
-#line 2353 "conf_parser.y" /* yacc.c:1646  */
+  case 467:
+#line 2374 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
 
@@ -5611,29 +5677,29 @@ yyreduce:
     add_conf_by_address(CONF_DLINE, conf);
   }
 }
-#line 5615 "conf_parser.c" /* yacc.c:1646  */
+#line 5681 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 465:
-#line 2379 "conf_parser.y" /* yacc.c:1646  */
+  case 473:
+#line 2400 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 5624 "conf_parser.c" /* yacc.c:1646  */
+#line 5690 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 466:
-#line 2385 "conf_parser.y" /* yacc.c:1646  */
+  case 474:
+#line 2406 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5633 "conf_parser.c" /* yacc.c:1646  */
+#line 5699 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 472:
-#line 2400 "conf_parser.y" /* yacc.c:1646  */
+  case 480:
+#line 2421 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5646,20 +5712,20 @@ yyreduce:
     }
   }
 }
-#line 5650 "conf_parser.c" /* yacc.c:1646  */
+#line 5716 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 473:
-#line 2417 "conf_parser.y" /* yacc.c:1646  */
+  case 481:
+#line 2438 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5659 "conf_parser.c" /* yacc.c:1646  */
+#line 5725 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 474:
-#line 2421 "conf_parser.y" /* yacc.c:1646  */
+  case 482:
+#line 2442 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5675,872 +5741,889 @@ yyreduce:
   else
     gecos->reason = xstrdup(CONF_NOREASON);
 }
-#line 5679 "conf_parser.c" /* yacc.c:1646  */
+#line 5745 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 480:
-#line 2441 "conf_parser.y" /* yacc.c:1646  */
+  case 488:
+#line 2462 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5688 "conf_parser.c" /* yacc.c:1646  */
+#line 5754 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 481:
-#line 2447 "conf_parser.y" /* yacc.c:1646  */
+  case 489:
+#line 2468 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5697 "conf_parser.c" /* yacc.c:1646  */
+#line 5763 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 533:
-#line 2510 "conf_parser.y" /* yacc.c:1646  */
+  case 542:
+#line 2532 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.away_count = (yyvsp[-1].number);
 }
-#line 5705 "conf_parser.c" /* yacc.c:1646  */
+#line 5771 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 534:
-#line 2515 "conf_parser.y" /* yacc.c:1646  */
+  case 543:
+#line 2537 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.away_time = (yyvsp[-1].number);
 }
-#line 5713 "conf_parser.c" /* yacc.c:1646  */
+#line 5779 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 535:
-#line 2520 "conf_parser.y" /* yacc.c:1646  */
+  case 544:
+#line 2542 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_watch = (yyvsp[-1].number);
 }
-#line 5721 "conf_parser.c" /* yacc.c:1646  */
+#line 5787 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 545:
+#line 2547 "conf_parser.y" /* yacc.c:1646  */
+    {
+  /* Kept in megabytes, rounded up */
+  const uintmax_t megabytes = (yyvsp[-1].size) / (1024 * 1024) + ((yyvsp[-1].size) % (1024 * 1024) != 0);
+
+  if (conf_parser_ctx.pass != 2)
+    break;
+
+  if (megabytes > UINT_MAX || megabytes > SIZE_MAX / (1024 * 1024))
+    conf_error_report("Ignoring general::memory_budget -- too large");
+  else
+    ConfigGeneral.memory_budget = megabytes;
+}
+#line 5804 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 536:
-#line 2525 "conf_parser.y" /* yacc.c:1646  */
+  case 546:
+#line 2561 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.whowas_history_length = (yyvsp[-1].number);
 }
-#line 5729 "conf_parser.c" /* yacc.c:1646  */
+#line 5812 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 537:
-#line 2530 "conf_parser.y" /* yacc.c:1646  */
+  case 547:
+#line 2566 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigGeneral.cycle_on_host_change = yylval.number;
 }
-#line 5738 "conf_parser.c" /* yacc.c:1646  */
+#line 5821 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 538:
-#line 2536 "conf_parser.y" /* yacc.c:1646  */
+  case 548:
+#line 2572 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dline_min_cidr = (yyvsp[-1].number);
 }
-#line 5746 "conf_parser.c" /* yacc.c:1646  */
+#line 5829 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 539:
-#line 2541 "conf_parser.y" /* yacc.c:1646  */
+  case 549:
+#line 2577 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5754 "conf_parser.c" /* yacc.c:1646  */
+#line 5837 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 540:
-#line 2546 "conf_parser.y" /* yacc.c:1646  */
+  case 550:
+#line 2582 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kline_min_cidr = (yyvsp[-1].number);
 }
-#line 5762 "conf_parser.c" /* yacc.c:1646  */
+#line 5845 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 541:
-#line 2551 "conf_parser.y" /* yacc.c:1646  */
+  case 551:
+#line 2587 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5770 "conf_parser.c" /* yacc.c:1646  */
+#line 5853 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 542:
-#line 2556 "conf_parser.y" /* yacc.c:1646  */
+  case 552:
+#line 2592 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.tkline_expire_notices = yylval.number;
 }
-#line 5778 "conf_parser.c" /* yacc.c:1646  */
+#line 5861 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 543:
-#line 2561 "conf_parser.y" /* yacc.c:1646  */
+  case 553:
+#line 2597 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kill_chase_time_limit = (yyvsp[-1].number);
 }
-#line 5786 "conf_parser.c" /* yacc.c:1646  */
+#line 5869 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 544:
-#line 2566 "conf_parser.y" /* yacc.c:1646  */
+  case 554:
+#line 2602 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ignore_bogus_ts = yylval.number;
 }
-#line 5794 "conf_parser.c" /* yacc.c:1646  */
+#line 5877 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 545:
-#line 2571 "conf_parser.y" /* yacc.c:1646  */
+  case 555:
+#line 2607 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.failed_oper_notice = yylval.number;
 }
-#line 5802 "conf_parser.c" /* yacc.c:1646  */
+#line 5885 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 546:
-#line 2576 "conf_parser.y" /* yacc.c:1646  */
+  case 556:
+#line 2612 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.anti_nick_flood = yylval.number;
 }
-#line 5810 "conf_parser.c" /* yacc.c:1646  */
+#line 5893 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 547:
-#line 2581 "conf_parser.y" /* yacc.c:1646  */
+  case 557:
+#line 2617 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_nick_time = (yyvsp[-1].number);
 }
-#line 5818 "conf_parser.c" /* yacc.c:1646  */
+#line 5901 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 548:
-#line 2586 "conf_parser.y" /* yacc.c:1646  */
+  case 558:
+#line 2622 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_nick_changes = (yyvsp[-1].number);
 }
-#line 5826 "conf_parser.c" /* yacc.c:1646  */
+#line 5909 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 549:
-#line 2591 "conf_parser.y" /* yacc.c:1646  */
+  case 559:
+#line 2627 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_accept = (yyvsp[-1].number);
 }
-#line 5834 "conf_parser.c" /* yacc.c:1646  */
+#line 5917 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 550:
-#line 2596 "conf_parser.y" /* yacc.c:1646  */
+  case 560:
+#line 2632 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.anti_spam_exit_message_time = (yyvsp[-1].number);
 }
-#line 5842 "conf_parser.c" /* yacc.c:1646  */
+#line 5925 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 551:
-#line 2601 "conf_parser.y" /* yacc.c:1646  */
+  case 561:
+#line 2637 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ts_warn_delta = (yyvsp[-1].number);
 }
-#line 5850 "conf_parser.c" /* yacc.c:1646  */
+#line 5933 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 552:
-#line 2606 "conf_parser.y" /* yacc.c:1646  */
+  case 562:
+#line 2642 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigGeneral.ts_max_delta = (yyvsp[-1].number);
 }
-#line 5859 "conf_parser.c" /* yacc.c:1646  */
+#line 5942 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 553:
-#line 2612 "conf_parser.y" /* yacc.c:1646  */
+  case 563:
+#line 2648 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.invisible_on_connect = yylval.number;
 }
-#line 5867 "conf_parser.c" /* yacc.c:1646  */
+#line 5950 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 554:
-#line 2617 "conf_parser.y" /* yacc.c:1646  */
+  case 564:
+#line 2653 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.warn_no_connect_block = yylval.number;
 }
-#line 5875 "conf_parser.c" /* yacc.c:1646  */
+#line 5958 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 555:
-#line 2622 "conf_parser.y" /* yacc.c:1646  */
+  case 565:
+#line 2658 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_e_disabled = yylval.number;
 }
-#line 5883 "conf_parser.c" /* yacc.c:1646  */
+#line 5966 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 556:
-#line 2627 "conf_parser.y" /* yacc.c:1646  */
+  case 566:
+#line 2663 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_m_oper_only = yylval.number;
 }
-#line 5891 "conf_parser.c" /* yacc.c:1646  */
+#line 5974 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 557:
-#line 2632 "conf_parser.y" /* yacc.c:1646  */
+  case 567:
+#line 2668 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_o_oper_only = yylval.number;
 }
-#line 5899 "conf_parser.c" /* yacc.c:1646  */
+#line 5982 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 558:
-#line 2637 "conf_parser.y" /* yacc.c:1646  */
+  case 568:
+#line 2673 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_P_oper_only = yylval.number;
 }
-#line 5907 "conf_parser.c" /* yacc.c:1646  */
+#line 5990 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 559:
-#line 2642 "conf_parser.y" /* yacc.c:1646  */
+  case 569:
+#line 2678 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_u_oper_only = yylval.number;
 }
-#line 5915 "conf_parser.c" /* yacc.c:1646  */
+#line 5998 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 560:
-#line 2647 "conf_parser.y" /* yacc.c:1646  */
+  case 570:
+#line 2683 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_k_oper_only = 2 * yylval.number;
 }
-#line 5923 "conf_parser.c" /* yacc.c:1646  */
+#line 6006 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 561:
-#line 2650 "conf_parser.y" /* yacc.c:1646  */
+  case 571:
+#line 2686 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_k_oper_only = 1;
 }
-#line 5931 "conf_parser.c" /* yacc.c:1646  */
+#line 6014 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 562:
-#line 2655 "conf_parser.y" /* yacc.c:1646  */
+  case 572:
+#line 2691 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_i_oper_only = 2 * yylval.number;
 }
-#line 5939 "conf_parser.c" /* yacc.c:1646  */
+#line 6022 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 563:
-#line 2658 "conf_parser.y" /* yacc.c:1646  */
+  case 573:
+#line 2694 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_i_oper_only = 1;
 }
-#line 5947 "conf_parser.c" /* yacc.c:1646  */
+#line 6030 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 564:
-#line 2663 "conf_parser.y" /* yacc.c:1646  */
+  case 574:
+#line 2699 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.pace_wait = (yyvsp[-1].number);
 }
-#line 5955 "conf_parser.c" /* yacc.c:1646  */
+#line 6038 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 565:
-#line 2668 "conf_parser.y" /* yacc.c:1646  */
+  case 575:
+#line 2704 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.caller_id_wait = (yyvsp[-1].number);
 }
-#line 5963 "conf_parser.c" /* yacc.c:1646  */
+#line 6046 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 566:
-#line 2673 "conf_parser.y" /* yacc.c:1646  */
+  case 576:
+#line 2709 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.opers_bypass_callerid = yylval.number;
 }
-#line 5971 "conf_parser.c" /* yacc.c:1646  */
+#line 6054 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 567:
-#line 2678 "conf_parser.y" /* yacc.c:1646  */
+  case 577:
+#line 2714 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.pace_wait_simple = (yyvsp[-1].number);
 }
-#line 5979 "conf_parser.c" /* yacc.c:1646  */
+#line 6062 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 568:
-#line 2683 "conf_parser.y" /* yacc.c:1646  */
+  case 578:
+#line 2719 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.short_motd = yylval.number;
 }
-#line 5987 "conf_parser.c" /* yacc.c:1646  */
+#line 6070 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 569:
-#line 2688 "conf_parser.y" /* yacc.c:1646  */
+  case 579:
+#line 2724 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.no_oper_flood = yylval.number;
 }
-#line 5995 "conf_parser.c" /* yacc.c:1646  */
+#line 6078 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 570:
-#line 2693 "conf_parser.y" /* yacc.c:1646  */
+  case 580:
+#line 2729 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dots_in_ident = (yyvsp[-1].number);
 }
-#line 6003 "conf_parser.c" /* yacc.c:1646  */
+#line 6086 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 571:
-#line 2698 "conf_parser.y" /* yacc.c:1646  */
+  case 581:
+#line 2734 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_targets = (yyvsp[-1].number);
 }
-#line 6011 "conf_parser.c" /* yacc.c:1646  */
+#line 6094 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 572:
-#line 2703 "conf_parser.y" /* yacc.c:1646  */
+  case 582:
+#line 2739 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ping_cookie = yylval.number;
 }
-#line 6019 "conf_parser.c" /* yacc.c:1646  */
+#line 6102 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 573:
-#line 2708 "conf_parser.y" /* yacc.c:1646  */
+  case 583:
+#line 2744 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.disable_auth = yylval.number;
 }
-#line 6027 "conf_parser.c" /* yacc.c:1646  */
+#line 6110 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 574:
-#line 2713 "conf_parser.y" /* yacc.c:1646  */
+  case 584:
+#line 2749 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.throttle_count = (yyvsp[-1].number);
 }
-#line 6035 "conf_parser.c" /* yacc.c:1646  */
+#line 6118 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 575:
-#line 2718 "conf_parser.y" /* yacc.c:1646  */
+  case 585:
+#line 2754 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.throttle_time = (yyvsp[-1].number);
 }
-#line 6043 "conf_parser.c" /* yacc.c:1646  */
+#line 6126 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 576:
-#line 2723 "conf_parser.y" /* yacc.c:1646  */
+  case 586:
+#line 2759 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes = 0;
 }
-#line 6051 "conf_parser.c" /* yacc.c:1646  */
+#line 6134 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 580:
-#line 2729 "conf_parser.y" /* yacc.c:1646  */
+  case 590:
+#line 2765 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_BOTS;
 }
-#line 6059 "conf_parser.c" /* yacc.c:1646  */
+#line 6142 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 581:
-#line 2732 "conf_parser.y" /* yacc.c:1646  */
+  case 591:
+#line 2768 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_CCONN;
 }
-#line 6067 "conf_parser.c" /* yacc.c:1646  */
+#line 6150 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 582:
-#line 2735 "conf_parser.y" /* yacc.c:1646  */
+  case 592:
+#line 2771 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_DEAF;
 }
-#line 6075 "conf_parser.c" /* yacc.c:1646  */
+#line 6158 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 583:
-#line 2738 "conf_parser.y" /* yacc.c:1646  */
+  case 593:
+#line 2774 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_DEBUG;
 }
-#line 6083 "conf_parser.c" /* yacc.c:1646  */
+#line 6166 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 584:
-#line 2741 "conf_parser.y" /* yacc.c:1646  */
+  case 594:
+#line 2777 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_FULL;
 }
-#line 6091 "conf_parser.c" /* yacc.c:1646  */
+#line 6174 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 585:
-#line 2744 "conf_parser.y" /* yacc.c:1646  */
+  case 595:
+#line 2780 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDDEN;
 }
-#line 6099 "conf_parser.c" /* yacc.c:1646  */
+#line 6182 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 586:
-#line 2747 "conf_parser.y" /* yacc.c:1646  */
+  case 596:
+#line 2783 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDECHANS;
 }
-#line 6107 "conf_parser.c" /* yacc.c:1646  */
+#line 6190 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 587:
-#line 2750 "conf_parser.y" /* yacc.c:1646  */
+  case 597:
+#line 2786 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDEIDLE;
 }
-#line 6115 "conf_parser.c" /* yacc.c:1646  */
+#line 6198 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 588:
-#line 2753 "conf_parser.y" /* yacc.c:1646  */
+  case 598:
+#line 2789 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SKILL;
 }
-#line 6123 "conf_parser.c" /* yacc.c:1646  */
+#line 6206 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 589:
-#line 2756 "conf_parser.y" /* yacc.c:1646  */
+  case 599:
+#line 2792 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_NCHANGE;
 }
-#line 6131 "conf_parser.c" /* yacc.c:1646  */
+#line 6214 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 590:
-#line 2759 "conf_parser.y" /* yacc.c:1646  */
+  case 600:
+#line 2795 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_REJ;
 }
-#line 6139 "conf_parser.c" /* yacc.c:1646  */
+#line 6222 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 591:
-#line 2762 "conf_parser.y" /* yacc.c:1646  */
+  case 601:
+#line 2798 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_UNAUTH;
 }
-#line 6147 "conf_parser.c" /* yacc.c:1646  */
+#line 6230 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 592:
-#line 2765 "conf_parser.y" /* yacc.c:1646  */
+  case 602:
+#line 2801 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SPY;
 }
-#line 6155 "conf_parser.c" /* yacc.c:1646  */
+#line 6238 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 593:
-#line 2768 "conf_parser.y" /* yacc.c:1646  */
+  case 603:
+#line 2804 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_EXTERNAL;
 }
-#line 6163 "conf_parser.c" /* yacc.c:1646  */
+#line 6246 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 594:
-#line 2771 "conf_parser.y" /* yacc.c:1646  */
+  case 604:
+#line 2807 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SERVNOTICE;
 }
-#line 6171 "conf_parser.c" /* yacc.c:1646  */
+#line 6254 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 595:
-#line 2774 "conf_parser.y" /* yacc.c:1646  */
+  case 605:
+#line 2810 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_INVISIBLE;
 }
-#line 6179 "conf_parser.c" /* yacc.c:1646  */
+#line 6262 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 596:
-#line 2777 "conf_parser.y" /* yacc.c:1646  */
+  case 606:
+#line 2813 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_WALLOP;
 }
-#line 6187 "conf_parser.c" /* yacc.c:1646  */
+#line 6270 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 597:
-#line 2780 "conf_parser.y" /* yacc.c:1646  */
+  case 607:
+#line 2816 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6195 "conf_parser.c" /* yacc.c:1646  */
+#line 6278 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 598:
-#line 2783 "conf_parser.y" /* yacc.c:1646  */
+  case 608:
+#line 2819 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_CALLERID;
 }
-#line 6203 "conf_parser.c" /* yacc.c:1646  */
+#line 6286 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 599:
-#line 2786 "conf_parser.y" /* yacc.c:1646  */
+  case 609:
+#line 2822 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_LOCOPS;
 }
-#line 6211 "conf_parser.c" /* yacc.c:1646  */
+#line 6294 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 600:
-#line 2789 "conf_parser.y" /* yacc.c:1646  */
+  case 610:
+#line 2825 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_REGONLY;
 }
-#line 6219 "conf_parser.c" /* yacc.c:1646  */
+#line 6302 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 601:
-#line 2792 "conf_parser.y" /* yacc.c:1646  */
+  case 611:
+#line 2828 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_FARCONNECT;
 }
-#line 6227 "conf_parser.c" /* yacc.c:1646  */
+#line 6310 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 602:
-#line 2797 "conf_parser.y" /* yacc.c:1646  */
+  case 612:
+#line 2833 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes = 0;
 }
-#line 6235 "conf_parser.c" /* yacc.c:1646  */
+#line 6318 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 606:
-#line 2803 "conf_parser.y" /* yacc.c:1646  */
+  case 616:
+#line 2839 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_BOTS;
 }
-#line 6243 "conf_parser.c" /* yacc.c:1646  */
+#line 6326 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 607:
-#line 2806 "conf_parser.y" /* yacc.c:1646  */
+  case 617:
+#line 2842 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_CCONN;
 }
-#line 6251 "conf_parser.c" /* yacc.c:1646  */
+#line 6334 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 608:
-#line 2809 "conf_parser.y" /* yacc.c:1646  */
+  case 618:
+#line 2845 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_DEAF;
 }
-#line 6259 "conf_parser.c" /* yacc.c:1646  */
+#line 6342 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 609:
-#line 2812 "conf_parser.y" /* yacc.c:1646  */
+  case 619:
+#line 2848 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_DEBUG;
 }
-#line 6267 "conf_parser.c" /* yacc.c:1646  */
+#line 6350 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 610:
-#line 2815 "conf_parser.y" /* yacc.c:1646  */
+  case 620:
+#line 2851 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_FULL;
 }
-#line 6275 "conf_parser.c" /* yacc.c:1646  */
+#line 6358 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 611:
-#line 2818 "conf_parser.y" /* yacc.c:1646  */
+  case 621:
+#line 2854 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SKILL;
 }
-#line 6283 "conf_parser.c" /* yacc.c:1646  */
+#line 6366 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 612:
-#line 2821 "conf_parser.y" /* yacc.c:1646  */
+  case 622:
+#line 2857 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_HIDDEN;
 }
-#line 6291 "conf_parser.c" /* yacc.c:1646  */
+#line 6374 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 613:
-#line 2824 "conf_parser.y" /* yacc.c:1646  */
+  case 623:
+#line 2860 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_NCHANGE;
 }
-#line 6299 "conf_parser.c" /* yacc.c:1646  */
+#line 6382 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 614:
-#line 2827 "conf_parser.y" /* yacc.c:1646  */
+  case 624:
+#line 2863 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_REJ;
 }
-#line 6307 "conf_parser.c" /* yacc.c:1646  */
+#line 6390 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 615:
-#line 2830 "conf_parser.y" /* yacc.c:1646  */
+  case 625:
+#line 2866 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_UNAUTH;
 }
-#line 6315 "conf_parser.c" /* yacc.c:1646  */
+#line 6398 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 616:
-#line 2833 "conf_parser.y" /* yacc.c:1646  */
+  case 626:
+#line 2869 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SPY;
 }
-#line 6323 "conf_parser.c" /* yacc.c:1646  */
+#line 6406 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 617:
-#line 2836 "conf_parser.y" /* yacc.c:1646  */
+  case 627:
+#line 2872 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_EXTERNAL;
 }
-#line 6331 "conf_parser.c" /* yacc.c:1646  */
+#line 6414 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 618:
-#line 2839 "conf_parser.y" /* yacc.c:1646  */
+  case 628:
+#line 2875 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SERVNOTICE;
 }
-#line 6339 "conf_parser.c" /* yacc.c:1646  */
+#line 6422 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 619:
-#line 2842 "conf_parser.y" /* yacc.c:1646  */
+  case 629:
+#line 2878 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_INVISIBLE;
 }
-#line 6347 "conf_parser.c" /* yacc.c:1646  */
+#line 6430 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 620:
-#line 2845 "conf_parser.y" /* yacc.c:1646  */
+  case 630:
+#line 2881 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_WALLOP;
 }
-#line 6355 "conf_parser.c" /* yacc.c:1646  */
+#line 6438 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 621:
-#line 2848 "conf_parser.y" /* yacc.c:1646  */
+  case 631:
+#line 2884 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6363 "conf_parser.c" /* yacc.c:1646  */
+#line 6446 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 622:
-#line 2851 "conf_parser.y" /* yacc.c:1646  */
+  case 632:
+#line 2887 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_CALLERID;
 }
-#line 6371 "conf_parser.c" /* yacc.c:1646  */
+#line 6454 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 623:
-#line 2854 "conf_parser.y" /* yacc.c:1646  */
+  case 633:
+#line 2890 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_LOCOPS;
 }
-#line 6379 "conf_parser.c" /* yacc.c:1646  */
+#line 6462 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 624:
-#line 2857 "conf_parser.y" /* yacc.c:1646  */
+  case 634:
+#line 2893 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_REGONLY;
 }
-#line 6387 "conf_parser.c" /* yacc.c:1646  */
+#line 6470 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 625:
-#line 2860 "conf_parser.y" /* yacc.c:1646  */
+  case 635:
+#line 2896 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_FARCONNECT;
 }
-#line 6395 "conf_parser.c" /* yacc.c:1646  */
+#line 6478 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 626:
-#line 2865 "conf_parser.y" /* yacc.c:1646  */
+  case 636:
+#line 2901 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.min_nonwildcard = (yyvsp[-1].number);
 }
-#line 6403 "conf_parser.c" /* yacc.c:1646  */
+#line 6486 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 627:
-#line 2870 "conf_parser.y" /* yacc.c:1646  */
+  case 637:
+#line 2906 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.min_nonwildcard_simple = (yyvsp[-1].number);
 }
-#line 6411 "conf_parser.c" /* yacc.c:1646  */
+#line 6494 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 628:
-#line 2875 "conf_parser.y" /* yacc.c:1646  */
+  case 638:
+#line 2911 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.default_floodcount = (yyvsp[-1].number);
 }
-#line 6419 "conf_parser.c" /* yacc.c:1646  */
+#line 6502 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 629:
-#line 2880 "conf_parser.y" /* yacc.c:1646  */
+  case 639:
+#line 2916 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.default_floodtime = (yyvsp[-1].number);
 }
-#line 6427 "conf_parser.c" /* yacc.c:1646  */
+#line 6510 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 647:
-#line 2907 "conf_parser.y" /* yacc.c:1646  */
+  case 657:
+#line 2943 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.disable_fake_channels = yylval.number;
 }
-#line 6435 "conf_parser.c" /* yacc.c:1646  */
+#line 6518 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 648:
-#line 2912 "conf_parser.y" /* yacc.c:1646  */
+  case 658:
+#line 2948 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_client_count = (yyvsp[-1].number);
 }
-#line 6443 "conf_parser.c" /* yacc.c:1646  */
+#line 6526 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 649:
-#line 2917 "conf_parser.y" /* yacc.c:1646  */
+  case 659:
+#line 2953 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_client_time = (yyvsp[-1].number);
 }
-#line 6451 "conf_parser.c" /* yacc.c:1646  */
+#line 6534 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 650:
-#line 2922 "conf_parser.y" /* yacc.c:1646  */
+  case 660:
+#line 2958 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_delay_channel = (yyvsp[-1].number);
 }
-#line 6459 "conf_parser.c" /* yacc.c:1646  */
+#line 6542 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 651:
-#line 2927 "conf_parser.y" /* yacc.c:1646  */
+  case 661:
+#line 2963 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_expire_time = (yyvsp[-1].number);
 }
-#line 6467 "conf_parser.c" /* yacc.c:1646  */
+#line 6550 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 652:
-#line 2932 "conf_parser.y" /* yacc.c:1646  */
+  case 662:
+#line 2968 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_client_count = (yyvsp[-1].number);
 }
-#line 6475 "conf_parser.c" /* yacc.c:1646  */
+#line 6558 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 653:
-#line 2937 "conf_parser.y" /* yacc.c:1646  */
+  case 663:
+#line 2973 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_client_time = (yyvsp[-1].number);
 }
-#line 6483 "conf_parser.c" /* yacc.c:1646  */
+#line 6566 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 654:
-#line 2942 "conf_parser.y" /* yacc.c:1646  */
+  case 664:
+#line 2978 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_delay_channel = (yyvsp[-1].number);
 }
-#line 6491 "conf_parser.c" /* yacc.c:1646  */
+#line 6574 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 655:
-#line 2947 "conf_parser.y" /* yacc.c:1646  */
+  case 665:
+#line 2983 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_channels = (yyvsp[-1].number);
 }
-#line 6499 "conf_parser.c" /* yacc.c:1646  */
+#line 6582 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 656:
-#line 2952 "conf_parser.y" /* yacc.c:1646  */
+  case 666:
+#line 2988 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_invites = (yyvsp[-1].number);
 }
-#line 6507 "conf_parser.c" /* yacc.c:1646  */
+#line 6590 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 657:
-#line 2957 "conf_parser.y" /* yacc.c:1646  */
+  case 667:
+#line 2993 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_bans = (yyvsp[-1].number);
 }
-#line 6515 "conf_parser.c" /* yacc.c:1646  */
+#line 6598 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 658:
-#line 2962 "conf_parser.y" /* yacc.c:1646  */
+  case 668:
+#line 2998 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.default_join_flood_count = yylval.number;
 }
-#line 6523 "conf_parser.c" /* yacc.c:1646  */
+#line 6606 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 659:
-#line 2967 "conf_parser.y" /* yacc.c:1646  */
+  case 669:
+#line 3003 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.default_join_flood_time = (yyvsp[-1].number);
 }
-#line 6531 "conf_parser.c" /* yacc.c:1646  */
+#line 6614 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 673:
-#line 2990 "conf_parser.y" /* yacc.c:1646  */
+  case 683:
+#line 3026 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.flatten_links = yylval.number;
 }
-#line 6540 "conf_parser.c" /* yacc.c:1646  */
+#line 6623 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 674:
-#line 2996 "conf_parser.y" /* yacc.c:1646  */
+  case 684:
+#line 3032 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6555,11 +6638,11 @@ yyreduce:
     ConfigServerHide.flatten_links_delay = (yyvsp[-1].number);
   }
 }
-#line 6559 "conf_parser.c" /* yacc.c:1646  */
+#line 6642 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 675:
-#line 3012 "conf_parser.y" /* yacc.c:1646  */
+  case 685:
+#line 3048 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6567,38 +6650,38 @@ yyreduce:
     ConfigServerHide.flatten_links_file = xstrdup(yylval.string);
   }
 }
-#line 6571 "conf_parser.c" /* yacc.c:1646  */
+#line 6654 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 676:
-#line 3021 "conf_parser.y" /* yacc.c:1646  */
+  case 686:
+#line 3057 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.disable_remote_commands = yylval.number;
 }
-#line 6580 "conf_parser.c" /* yacc.c:1646  */
+#line 6663 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 677:
-#line 3027 "conf_parser.y" /* yacc.c:1646  */
+  case 687:
+#line 3063 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_servers = yylval.number;
 }
-#line 6589 "conf_parser.c" /* yacc.c:1646  */
+#line 6672 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 678:
-#line 3033 "conf_parser.y" /* yacc.c:1646  */
+  case 688:
+#line 3069 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_services = yylval.number;
 }
-#line 6598 "conf_parser.c" /* yacc.c:1646  */
+#line 6681 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 679:
-#line 3039 "conf_parser.y" /* yacc.c:1646  */
+  case 689:
+#line 3075 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6606,29 +6689,29 @@ yyreduce:
     ConfigServerHide.hidden_name = xstrdup(yylval.string);
   }
 }
-#line 6610 "conf_parser.c" /* yacc.c:1646  */
+#line 6693 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 680:
-#line 3048 "conf_parser.y" /* yacc.c:1646  */
+  case 690:
+#line 3084 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hidden = yylval.number;
 }
-#line 6619 "conf_parser.c" /* yacc.c:1646  */
+#line 6702 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 681:
-#line 3054 "conf_parser.y" /* yacc.c:1646  */
+  case 691:
+#line 3090 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_server_ips = yylval.number;
 }
-#line 6628 "conf_parser.c" /* yacc.c:1646  */
+#line 6711 "conf_parser.c" /* yacc.c:1646  */
     break;
 
 
-#line 6632 "conf_parser.c" /* yacc.c:1646  */
+#line 6715 "conf_parser.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -64,221 +64,224 @@ extern int yydebug;
     CIDR_BITLEN_IPV6 = 274,
     CLASS = 275,
     CLOSE = 276,
-    CONNECT = 277,
-    CONNECTFREQ = 278,
-    CYCLE_ON_HOST_CHANGE = 279,
-    DEFAULT_FLOODCOUNT = 280,
-    DEFAULT_FLOODTIME = 281,
-    DEFAULT_JOIN_FLOOD_COUNT = 282,
-    DEFAULT_JOIN_FLOOD_TIME = 283,
-    DEFAULT_MAX_CLIENTS = 284,
-    DENY = 285,
-    DESCRIPTION = 286,
-    DIE = 287,
-    DISABLE_AUTH = 288,
-    DISABLE_FAKE_CHANNELS = 289,
-    DISABLE_REMOTE_COMMANDS = 290,
-    DLINE_MIN_CIDR = 291,
-    DLINE_MIN_CIDR6 = 292,
-    DOTS_IN_IDENT = 293,
-    EMAIL = 294,
-    ENCRYPTED = 295,
-    EXCEED_LIMIT = 296,
-    EXEMPT = 297,
-    FAILED_OPER_NOTICE = 298,
-    FLATTEN_LINKS = 299,
-    FLATTEN_LINKS_DELAY = 300,
-    FLATTEN_LINKS_FILE = 301,
-    GECOS = 302,
-    GENERAL = 303,
-    HIDDEN = 304,
-    HIDDEN_NAME = 305,
-    HIDE_CHANS = 306,
-    HIDE_IDLE = 307,
-    HIDE_IDLE_FROM_OPERS = 308,
-    HIDE_SERVER_IPS = 309,
-    HIDE_SERVERS = 310,
-    HIDE_SERVICES = 311,
-    HOST = 312,
-    HUB = 313,
-    HUB_MASK = 314,
-    IGNORE_BOGUS_TS = 315,
-    INVISIBLE_ON_CONNECT = 316,
-    INVITE_CLIENT_COUNT = 317,
-    INVITE_CLIENT_TIME = 318,
-    INVITE_DELAY_CHANNEL = 319,
-    INVITE_EXPIRE_TIME = 320,
-    IP = 321,
-    IRCD_AUTH = 322,
-    IRCD_FLAGS = 323,
-    IRCD_SID = 324,
-    JOIN = 325,
-    KILL = 326,
-    KILL_CHASE_TIME_LIMIT = 327,
-    KLINE = 328,
-    KLINE_EXEMPT = 329,
-    KLINE_MIN_CIDR = 330,
-    KLINE_MIN_CIDR6 = 331,
-    KNOCK_CLIENT_COUNT = 332,
-    KNOCK_CLIENT_TIME = 333,
-    KNOCK_DELAY_CHANNEL = 334,
-    LEAF_MASK = 335,
-    LIBGEOIP_DATABASE_OPTIONS = 336,
-    LIBGEOIP_IPV4_DATABASE_FILE = 337,
-    LIBGEOIP_IPV6_DATABASE_FILE = 338,
-    LISTEN = 339,
-    MASK = 340,
-    MAX_ACCEPT = 341,
-    MAX_BANS = 342,
-    MAX_CHANNELS = 343,
-    MAX_GLOBAL = 344,
-    MAX_IDLE = 345,
-    MAX_INVITES = 346,
-    MAX_LOCAL = 347,
-    MAX_NICK_CHANGES = 348,
-    MAX_NICK_LENGTH = 349,
-    MAX_NICK_TIME = 350,
-    MAX_NUMBER = 351,
-    MAX_TARGETS = 352,
-    MAX_TOPIC_LENGTH = 353,
-    MAX_WATCH = 354,
-    MEMORY_CACHE = 355,
-    MIN_IDLE = 356,
-    MIN_NONWILDCARD = 357,
-    MIN_NONWILDCARD_SIMPLE = 358,
-    MMAP_CACHE = 359,
-    MODULE = 360,
-    MODULES = 361,
-    MOTD = 362,
-    NAME = 363,
-    NEED_IDENT = 364,
-    NEED_PASSWORD = 365,
-    NETWORK_DESC = 366,
-    NETWORK_NAME = 367,
-    NICK = 368,
-    NO_OPER_FLOOD = 369,
-    NO_TILDE = 370,
-    NUMBER = 371,
-    NUMBER_PER_CIDR = 372,
-    NUMBER_PER_IP = 373,
-    OPER_ONLY_UMODES = 374,
-    OPER_UMODES = 375,
-    OPERATOR = 376,
-    OPERS_BYPASS_CALLERID = 377,
-    PACE_WAIT = 378,
-    PACE_WAIT_SIMPLE = 379,
-    PASSWORD = 380,
-    PATH = 381,
-    PING_COOKIE = 382,
-    PING_TIME = 383,
-    PORT = 384,
-    QSTRING = 385,
-    RANDOM_IDLE = 386,
-    REASON = 387,
-    REDIRPORT = 388,
-    REDIRSERV = 389,
-    REHASH = 390,
-    REMOTE = 391,
-    REMOTEBAN = 392,
-    RESV = 393,
-    RESV_EXEMPT = 394,
-    RSA_PRIVATE_KEY_FILE = 395,
-    SECONDS = 396,
-    MINUTES = 397,
-    HOURS = 398,
-    DAYS = 399,
-    WEEKS = 400,
-    MONTHS = 401,
-    YEARS = 402,
-    SEND_PASSWORD = 403,
-    SENDQ = 404,
-    SERVERHIDE = 405,
-    SERVERINFO = 406,
-    SHORT_MOTD = 407,
-    SPOOF = 408,
-    SPOOF_NOTICE = 409,
-    SQUIT = 410,
-    SSL_CERTIFICATE_FILE = 411,
-    SSL_CERTIFICATE_FINGERPRINT = 412,
-    SSL_CONNECTION_REQUIRED = 413,
-    SSL_DH_ELLIPTIC_CURVE = 414,
-    SSL_DH_PARAM_FILE = 415,
-    SSL_MESSAGE_DIGEST_ALGORITHM = 416,
-    STANDARD = 417,
-    STATS_E_DISABLED = 418,
-    STATS_I_OPER_ONLY = 419,
-    STATS_K_OPER_ONLY = 420,
-    STATS_M_OPER_ONLY = 421,
-    STATS_O_OPER_ONLY = 422,
-    STATS_P_OPER_ONLY = 423,
-    STATS_U_OPER_ONLY = 424,
-    T_ALL = 425,
-    T_BOTS = 426,
-    T_CALLERID = 427,
-    T_CCONN = 428,
-    T_COMMAND = 429,
-    T_CLUSTER = 430,
-    T_DEAF = 431,
-    T_DEBUG = 432,
-    T_DLINE = 433,
-    T_EXTERNAL = 434,
-    T_FARCONNECT = 435,
-    T_FILE = 436,
-    T_FULL = 437,
-    T_GLOBOPS = 438,
-    T_INVISIBLE = 439,
-    T_IPV4 = 440,
-    T_IPV6 = 441,
-    T_LOCOPS = 442,
-    T_LOG = 443,
-    T_NCHANGE = 444,
-    T_NONONREG = 445,
-    T_OPME = 446,
-    T_PREPEND = 447,
-    T_PSEUDO = 448,
-    T_RECVQ = 449,
-    T_REJ = 450,
-    T_RESTART = 451,
-    T_SERVER = 452,
-    T_SERVICE = 453,
-    T_SERVNOTICE = 454,
-    T_SET = 455,
-    T_SHARED = 456,
-    T_SIZE = 457,
-    T_SKILL = 458,
-    T_SOFTCALLERID = 459,
-    T_SPY = 460,
-    T_SSL = 461,
-    T_SSL_CIPHER_LIST = 462,
-    T_TARGET = 463,
-    T_UMODES = 464,
-    T_UNAUTH = 465,
-    T_UNDLINE = 466,
-    T_UNLIMITED = 467,
-    T_UNRESV = 468,
-    T_UNXLINE = 469,
-    T_WALLOP = 470,
-    T_WALLOPS = 471,
-    T_WEBIRC = 472,
-    TBOOL = 473,
-    THROTTLE_COUNT = 474,
-    THROTTLE_TIME = 475,
-    TKLINE_EXPIRE_NOTICES = 476,
-    TMASKED = 477,
-    TS_MAX_DELTA = 478,
-    TS_WARN_DELTA = 479,
-    TWODOTS = 480,
-    TYPE = 481,
-    UNKLINE = 482,
-    USE_LOGGING = 483,
-    USER = 484,
-    VHOST = 485,
-    VHOST6 = 486,
-    WARN_NO_CONNECT_BLOCK = 487,
-    WHOIS = 488,
-    WHOWAS_HISTORY_LENGTH = 489,
-    XLINE = 490,
-    XLINE_EXEMPT = 491
+    COMPRESSED = 277,
+    CONNECT = 278,
+    CONNECTFREQ = 279,
+    CYCLE_ON_HOST_CHANGE = 280,
+    DEFAULT_FLOODCOUNT = 281,
+    DEFAULT_FLOODTIME = 282,
+    DEFAULT_JOIN_FLOOD_COUNT = 283,
+    DEFAULT_JOIN_FLOOD_TIME = 284,
+    DEFAULT_MAX_CLIENTS = 285,
+    DENY = 286,
+    DESCRIPTION = 287,
+    DIE = 288,
+    DISABLE_AUTH = 289,
+    DISABLE_FAKE_CHANNELS = 290,
+    DISABLE_REMOTE_COMMANDS = 291,
+    DLINE_MIN_CIDR = 292,
+    DLINE_MIN_CIDR6 = 293,
+    DOTS_IN_IDENT = 294,
+    EMAIL = 295,
+    ENCRYPTED = 296,
+    EXCEED_LIMIT = 297,
+    EXEMPT = 298,
+    FAILED_OPER_NOTICE = 299,
+    FLATTEN_LINKS = 300,
+    FLATTEN_LINKS_DELAY = 301,
+    FLATTEN_LINKS_FILE = 302,
+    GECOS = 303,
+    GENERAL = 304,
+    HIDDEN = 305,
+    HIDDEN_NAME = 306,
+    HIDE_CHANS = 307,
+    HIDE_IDLE = 308,
+    HIDE_IDLE_FROM_OPERS = 309,
+    HIDE_SERVER_IPS = 310,
+    HIDE_SERVERS = 311,
+    HIDE_SERVICES = 312,
+    HOST = 313,
+    HUB = 314,
+    HUB_MASK = 315,
+    IGNORE_BOGUS_TS = 316,
+    INVISIBLE_ON_CONNECT = 317,
+    INVITE_CLIENT_COUNT = 318,
+    INVITE_CLIENT_TIME = 319,
+    INVITE_DELAY_CHANNEL = 320,
+    INVITE_EXPIRE_TIME = 321,
+    IP = 322,
+    IRCD_AUTH = 323,
+    IRCD_FLAGS = 324,
+    IRCD_SID = 325,
+    JOIN = 326,
+    KILL = 327,
+    KILL_CHASE_TIME_LIMIT = 328,
+    KLINE = 329,
+    KLINE_EXEMPT = 330,
+    KLINE_MIN_CIDR = 331,
+    KLINE_MIN_CIDR6 = 332,
+    KNOCK_CLIENT_COUNT = 333,
+    KNOCK_CLIENT_TIME = 334,
+    KNOCK_DELAY_CHANNEL = 335,
+    LEAF_MASK = 336,
+    LIBGEOIP_DATABASE_OPTIONS = 337,
+    LIBGEOIP_IPV4_DATABASE_FILE = 338,
+    LIBGEOIP_IPV6_DATABASE_FILE = 339,
+    LISTEN = 340,
+    MASK = 341,
+    MAX_ACCEPT = 342,
+    MAX_BANS = 343,
+    MAX_CHANNELS = 344,
+    MAX_GLOBAL = 345,
+    MAX_IDLE = 346,
+    MAX_INVITES = 347,
+    MAX_LOCAL = 348,
+    MAX_NICK_CHANGES = 349,
+    MAX_NICK_LENGTH = 350,
+    MAX_NICK_TIME = 351,
+    MAX_NUMBER = 352,
+    MAX_TARGETS = 353,
+    MAX_TOPIC_LENGTH = 354,
+    MAX_WATCH = 355,
+    MEMORY_BUDGET = 356,
+    MEMORY_CACHE = 357,
+    MIN_IDLE = 358,
+    MIN_NONWILDCARD = 359,
+    MIN_NONWILDCARD_SIMPLE = 360,
+    MMAP_CACHE = 361,
+    MODULE = 362,
+    MODULES = 363,
+    MOTD = 364,
+    NAME = 365,
+    NEED_IDENT = 366,
+    NEED_PASSWORD = 367,
+    NETWORK_DESC = 368,
+    NETWORK_NAME = 369,
+    NICK = 370,
+    NO_OPER_FLOOD = 371,
+    NO_TILDE = 372,
+    NUMBER = 373,
+    NUMBER_PER_CIDR = 374,
+    NUMBER_PER_IP = 375,
+    OPER_ONLY_UMODES = 376,
+    OPER_UMODES = 377,
+    OPERATOR = 378,
+    OPERS_BYPASS_CALLERID = 379,
+    PACE_WAIT = 380,
+    PACE_WAIT_SIMPLE = 381,
+    PASSWORD = 382,
+    PATH = 383,
+    PING_COOKIE = 384,
+    PING_TIME = 385,
+    PORT = 386,
+    QSTRING = 387,
+    RANDOM_IDLE = 388,
+    REASON = 389,
+    REDIRPORT = 390,
+    REDIRSERV = 391,
+    REHASH = 392,
+    REMOTE = 393,
+    REMOTEBAN = 394,
+    RESV = 395,
+    RESV_EXEMPT = 396,
+    RSA_PRIVATE_KEY_FILE = 397,
+    SECONDS = 398,
+    MINUTES = 399,
+    HOURS = 400,
+    DAYS = 401,
+    WEEKS = 402,
+    MONTHS = 403,
+    YEARS = 404,
+    SEND_PASSWORD = 405,
+    SENDQ = 406,
+    SERVERHIDE = 407,
+    SERVERINFO = 408,
+    SHORT_MOTD = 409,
+    SPOOF = 410,
+    SPOOF_NOTICE = 411,
+    SQUIT = 412,
+    SSL_CERTIFICATE_FILE = 413,
+    SSL_CERTIFICATE_FINGERPRINT = 414,
+    SSL_CONNECTION_REQUIRED = 415,
+    SSL_DH_ELLIPTIC_CURVE = 416,
+    SSL_DH_PARAM_FILE = 417,
+    SSL_MESSAGE_DIGEST_ALGORITHM = 418,
+    STANDARD = 419,
+    STATS_E_DISABLED = 420,
+    STATS_I_OPER_ONLY = 421,
+    STATS_K_OPER_ONLY = 422,
+    STATS_M_OPER_ONLY = 423,
+    STATS_O_OPER_ONLY = 424,
+    STATS_P_OPER_ONLY = 425,
+    STATS_U_OPER_ONLY = 426,
+    T_ALL = 427,
+    T_BOTS = 428,
+    T_BSIZE = 429,
+    T_CALLERID = 430,
+    T_CCONN = 431,
+    T_COMMAND = 432,
+    T_CLUSTER = 433,
+    T_DEAF = 434,
+    T_DEBUG = 435,
+    T_DLINE = 436,
+    T_EXTERNAL = 437,
+    T_FARCONNECT = 438,
+    T_FILE = 439,
+    T_FULL = 440,
+    T_GLOBOPS = 441,
+    T_INVISIBLE = 442,
+    T_IPV4 = 443,
+    T_IPV6 = 444,
+    T_LOCOPS = 445,
+    T_LOG = 446,
+    T_NCHANGE = 447,
+    T_NONONREG = 448,
+    T_OPME = 449,
+    T_PREPEND = 450,
+    T_PSEUDO = 451,
+    T_RECVQ = 452,
+    T_REJ = 453,
+    T_RESTART = 454,
+    T_SERVER = 455,
+    T_SERVICE = 456,
+    T_SERVNOTICE = 457,
+    T_SET = 458,
+    T_SHARED = 459,
+    T_SIZE = 460,
+    T_SKILL = 461,
+    T_SOFTCALLERID = 462,
+    T_SPY = 463,
+    T_SSL = 464,
+    T_SSL_CIPHER_LIST = 465,
+    T_TARGET = 466,
+    T_UMODES = 467,
+    T_UNAUTH = 468,
+    T_UNDLINE = 469,
+    T_UNLIMITED = 470,
+    T_UNRESV = 471,
+    T_UNXLINE = 472,
+    T_WALLOP = 473,
+    T_WALLOPS = 474,
+    T_WEBIRC = 475,
+    TBOOL = 476,
+    THROTTLE_COUNT = 477,
+    THROTTLE_TIME = 478,
+    TKLINE_EXPIRE_NOTICES = 479,
+    TMASKED = 480,
+    TS_MAX_DELTA = 481,
+    TS_WARN_DELTA = 482,
+    TWODOTS = 483,
+    TYPE = 484,
+    UNKLINE = 485,
+    USE_LOGGING = 486,
+    USER = 487,
+    VHOST = 488,
+    VHOST6 = 489,
+    WARN_NO_CONNECT_BLOCK = 490,
+    WHOIS = 491,
+    WHOWAS_HISTORY_LENGTH = 492,
+    XLINE = 493,
+    XLINE_EXEMPT = 494
   };
 #endif
 /* Tokens.  */
@@ -301,221 +304,224 @@ extern int yydebug;
 #define CIDR_BITLEN_IPV6 274
 #define CLASS 275
 #define CLOSE 276
-#define CONNECT 277
-#define CONNECTFREQ 278
-#define CYCLE_ON_HOST_CHANGE 279
-#define DEFAULT_FLOODCOUNT 280
-#define DEFAULT_FLOODTIME 281
-#define DEFAULT_JOIN_FLOOD_COUNT 282
-#define DEFAULT_JOIN_FLOOD_TIME 283
-#define DEFAULT_MAX_CLIENTS 284
-#define DENY 285
-#define DESCRIPTION 286
-#define DIE 287
-#define DISABLE_AUTH 288
-#define DISABLE_FAKE_CHANNELS 289
-#define DISABLE_REMOTE_COMMANDS 290
-#define DLINE_MIN_CIDR 291
-#define DLINE_MIN_CIDR6 292
-#define DOTS_IN_IDENT 293
-#define EMAIL 294
-#define ENCRYPTED 295
-#define EXCEED_LIMIT 296
-#define EXEMPT 297
-#define FAILED_OPER_NOTICE 298
-#define FLATTEN_LINKS 299
-#define FLATTEN_LINKS_DELAY 300
-#define FLATTEN_LINKS_FILE 301
-#define GECOS 302
-#define GENERAL 303
-#define HIDDEN 304
-#define HIDDEN_NAME 305
-#define HIDE_CHANS 306
-#define HIDE_IDLE 307
-#define HIDE_IDLE_FROM_OPERS 308
-#define HIDE_SERVER_IPS 309
-#define HIDE_SERVERS 310
-#define HIDE_SERVICES 311
-#define HOST 312
-#define HUB 313
-#define HUB_MASK 314
-#define IGNORE_BOGUS_TS 315
-#define INVISIBLE_ON_CONNECT 316
-#define INVITE_CLIENT_COUNT 317
-#define INVITE_CLIENT_TIME 318
-#define INVITE_DELAY_CHANNEL 319
-#define INVITE_EXPIRE_TIME 320
-#define IP 321
-#define IRCD_AUTH 322
-#define IRCD_FLAGS 323
-#define IRCD_SID 324
-#define JOIN 325
-#define KILL 326
-#define KILL_CHASE_TIME_LIMIT 327
-#define KLINE 328
-#define KLINE_EXEMPT 329
-#define KLINE_MIN_CIDR 330
-#define KLINE_MIN_CIDR6 331
-#define KNOCK_CLIENT_COUNT 332
-#define KNOCK_CLIENT_TIME 333
-#define KNOCK_DELAY_CHANNEL 334
-#define LEAF_MASK 335
-#define LIBGEOIP_DATABASE_OPTIONS 336
-#define LIBGEOIP_IPV4_DATABASE_FILE 337
-#define LIBGEOIP_IPV6_DATABASE_FILE 338
-#define LISTEN 339
-#define MASK 340
-#define MAX_ACCEPT 341
-#define MAX_BANS 342
-#define MAX_CHANNELS 343
-#define MAX_GLOBAL 344
-#define MAX_IDLE 345
-#define MAX_INVITES 346
-#define MAX_LOCAL 347
-#define MAX_NICK_CHANGES 348
-#define MAX_NICK_LENGTH 349
-#define MAX_NICK_TIME 350
-#define MAX_NUMBER 351
-#define MAX_TARGETS 352
-#define MAX_TOPIC_LENGTH 353
-#define MAX_WATCH 354
-#define MEMORY_CACHE 355
-#define MIN_IDLE 356
-#define MIN_NONWILDCARD 357
-#define MIN_NONWILDCARD_SIMPLE 358
-#define MMAP_CACHE 359
-#define MODULE 360
-#define MODULES 361
-#define MOTD 362
-#define NAME 363
-#define NEED_IDENT 364
-#define NEED_PASSWORD 365
-#define NETWORK_DESC 366
-#define NETWORK_NAME 367
-#define NICK 368
-#define NO_OPER_FLOOD 369
-#define NO_TILDE 370
-#define NUMBER 371
-#define NUMBER_PER_CIDR 372
-#define NUMBER_PER_IP 373
-#define OPER_ONLY_UMODES 374
-#define OPER_UMODES 375
-#define OPERATOR 376
-#define OPERS_BYPASS_CALLERID 377
-#define PACE_WAIT 378
-#define PACE_WAIT_SIMPLE 379
-#define PASSWORD 380
-#define PATH 381
-#define PING_COOKIE 382
-#define PING_TIME 383
-#define PORT 384
-#define QSTRING 385
-#define RANDOM_IDLE 386
-#define REASON 387
-#define REDIRPORT 388
-#define REDIRSERV 389
-#define REHASH 390
-#define REMOTE 391
-#define REMOTEBAN 392
-#define RESV 393
-#define RESV_EXEMPT 394
-#define RSA_PRIVATE_KEY_FILE 395
-#define SECONDS 396
-#define MINUTES 397
-#define HOURS 398
-#define DAYS 399
-#define WEEKS 400
-#define MONTHS 401
-#define YEARS 402
-#define SEND_PASSWORD 403
-#define SENDQ 404
-#define SERVERHIDE 405
-#define SERVERINFO 406
-#define SHORT_MOTD 407
-#define SPOOF 408
-#define SPOOF_NOTICE 409
-#define SQUIT 410
-#define SSL_CERTIFICATE_FILE 411
-#define SSL_CERTIFICATE_FINGERPRINT 412
-#define SSL_CONNECTION_REQUIRED 413
-#define SSL_DH_ELLIPTIC_CURVE 414
-#define SSL_DH_PARAM_FILE 415
-#define SSL_MESSAGE_DIGEST_ALGORITHM 416
-#define STANDARD 417
-#define STATS_E_DISABLED 418
-#define STATS_I_OPER_ONLY 419
-#define STATS_K_OPER_ONLY 420
-#define STATS_M_OPER_ONLY 421
-#define STATS_O_OPER_ONLY 422
-#define STATS_P_OPER_ONLY 423
-#define STATS_U_OPER_ONLY 424
-#define T_ALL 425
-#define T_BOTS 426
-#define T_CALLERID 427
-#define T_CCONN 428
-#define T_COMMAND 429
-#define T_CLUSTER 430
-#define T_DEAF 431
-#define T_DEBUG 432
-#define T_DLINE 433
-#define T_EXTERNAL 434
-#define T_FARCONNECT 435
-#define T_FILE 436
-#define T_FULL 437
-#define T_GLOBOPS 438
-#define T_INVISIBLE 439
-#define T_IPV4 440
-#define T_IPV6 441
-#define T_LOCOPS 442
-#define T_LOG 443
-#define T_NCHANGE 444
-#define T_NONONREG 445
-#define T_OPME 446
-#define T_PREPEND 447
-#define T_PSEUDO 448
-#define T_RECVQ 449
-#define T_REJ 450
-#define T_RESTART 451
-#define T_SERVER 452
-#define T_SERVICE 453
-#define T_SERVNOTICE 454
-#define T_SET 455
-#define T_SHARED 456
-#define T_SIZE 457
-#define T_SKILL 458
-#define T_SOFTCALLERID 459
-#define T_SPY 460
-#define T_SSL 461
-#define T_SSL_CIPHER_LIST 462
-#define T_TARGET 463
-#define T_UMODES 464
-#define T_UNAUTH 465
-#define T_UNDLINE 466
-#define T_UNLIMITED 467
-#define T_UNRESV 468
-#define T_UNXLINE 469
-#define T_WALLOP 470
-#define T_WALLOPS 471
-#define T_WEBIRC 472
-#define TBOOL 473
-#define THROTTLE_COUNT 474
-#define THROTTLE_TIME 475
-#define TKLINE_EXPIRE_NOTICES 476
-#define TMASKED 477
-#define TS_MAX_DELTA 478
-#define TS_WARN_DELTA 479
-#define TWODOTS 480
-#define TYPE 481
-#define UNKLINE 482
-#define USE_LOGGING 483
-#define USER 484
-#define VHOST 485
-#define VHOST6 486
-#define WARN_NO_CONNECT_BLOCK 487
-#define WHOIS 488
-#define WHOWAS_HISTORY_LENGTH 489
-#define XLINE 490
-#define XLINE_EXEMPT 491
+#define COMPRESSED 277
+#define CONNECT 278
+#define CONNECTFREQ 279
+#define CYCLE_ON_HOST_CHANGE 280
+#define DEFAULT_FLOODCOUNT 281
+#define DEFAULT_FLOODTIME 282
+#define DEFAULT_JOIN_FLOOD_COUNT 283
+#define DEFAULT_JOIN_FLOOD_TIME 284
+#define DEFAULT_MAX_CLIENTS 285
+#define DENY 286
+#define DESCRIPTION 287
+#define DIE 288
+#define DISABLE_AUTH 289
+#define DISABLE_FAKE_CHANNELS 290
+#define DISABLE_REMOTE_COMMANDS 291
+#define DLINE_MIN_CIDR 292
+#define DLINE_MIN_CIDR6 293
+#define DOTS_IN_IDENT 294
+#define EMAIL 295
+#define ENCRYPTED 296
+#define EXCEED_LIMIT 297
+#define EXEMPT 298
+#define FAILED_OPER_NOTICE 299
+#define FLATTEN_LINKS 300
+#define FLATTEN_LINKS_DELAY 301
+#define FLATTEN_LINKS_FILE 302
+#define GECOS 303
+#define GENERAL 304
+#define HIDDEN 305
+#define HIDDEN_NAME 306
+#define HIDE_CHANS 307
+#define HIDE_IDLE 308
+#define HIDE_IDLE_FROM_OPERS 309
+#define HIDE_SERVER_IPS 310
+#define HIDE_SERVERS 311
+#define HIDE_SERVICES 312
+#define HOST 313
+#define HUB 314
+#define HUB_MASK 315
+#define IGNORE_BOGUS_TS 316
+#define INVISIBLE_ON_CONNECT 317
+#define INVITE_CLIENT_COUNT 318
+#define INVITE_CLIENT_TIME 319
+#define INVITE_DELAY_CHANNEL 320
+#define INVITE_EXPIRE_TIME 321
+#define IP 322
+#define IRCD_AUTH 323
+#define IRCD_FLAGS 324
+#define IRCD_SID 325
+#define JOIN 326
+#define KILL 327
+#define KILL_CHASE_TIME_LIMIT 328
+#define KLINE 329
+#define KLINE_EXEMPT 330
+#define KLINE_MIN_CIDR 331
+#define KLINE_MIN_CIDR6 332
+#define KNOCK_CLIENT_COUNT 333
+#define KNOCK_CLIENT_TIME 334
+#define KNOCK_DELAY_CHANNEL 335
+#define LEAF_MASK 336
+#define LIBGEOIP_DATABASE_OPTIONS 337
+#define LIBGEOIP_IPV4_DATABASE_FILE 338
+#define LIBGEOIP_IPV6_DATABASE_FILE 339
+#define LISTEN 340
+#define MASK 341
+#define MAX_ACCEPT 342
+#define MAX_BANS 343
+#define MAX_CHANNELS 344
+#define MAX_GLOBAL 345
+#define MAX_IDLE 346
+#define MAX_INVITES 347
+#define MAX_LOCAL 348
+#define MAX_NICK_CHANGES 349
+#define MAX_NICK_LENGTH 350
+#define MAX_NICK_TIME 351
+#define MAX_NUMBER 352
+#define MAX_TARGETS 353
+#define MAX_TOPIC_LENGTH 354
+#define MAX_WATCH 355
+#define MEMORY_BUDGET 356
+#define MEMORY_CACHE 357
+#define MIN_IDLE 358
+#define MIN_NONWILDCARD 359
+#define MIN_NONWILDCARD_SIMPLE 360
+#define MMAP_CACHE 361
+#define MODULE 362
+#define MODULES 363
+#define MOTD 364
+#define NAME 365
+#define NEED_IDENT 366
+#define NEED_PASSWORD 367
+#define NETWORK_DESC 368
+#define NETWORK_NAME 369
+#define NICK 370
+#define NO_OPER_FLOOD 371
+#define NO_TILDE 372
+#define NUMBER 373
+#define NUMBER_PER_CIDR 374
+#define NUMBER_PER_IP 375
+#define OPER_ONLY_UMODES 376
+#define OPER_UMODES 377
+#define OPERATOR 378
+#define OPERS_BYPASS_CALLERID 379
+#define PACE_WAIT 380
+#define PACE_WAIT_SIMPLE 381
+#define PASSWORD 382
+#define PATH 383
+#define PING_COOKIE 384
+#define PING_TIME 385
+#define PORT 386
+#define QSTRING 387
+#define RANDOM_IDLE 388
+#define REASON 389
+#define REDIRPORT 390
+#define REDIRSERV 391
+#define REHASH 392
+#define REMOTE 393
+#define REMOTEBAN 394
+#define RESV 395
+#define RESV_EXEMPT 396
+#define RSA_PRIVATE_KEY_FILE 397
+#define SECONDS 398
+#define MINUTES 399
+#define HOURS 400
+#define DAYS 401
+#define WEEKS 402
+#define MONTHS 403
+#define YEARS 404
+#define SEND_PASSWORD 405
+#define SENDQ 406
+#define SERVERHIDE 407
+#define SERVERINFO 408
+#define SHORT_MOTD 409
+#define SPOOF 410
+#define SPOOF_NOTICE 411
+#define SQUIT 412
+#define SSL_CERTIFICATE_FILE 413
+#define SSL_CERTIFICATE_FINGERPRINT 414
+#define SSL_CONNECTION_REQUIRED 415
+#define SSL_DH_ELLIPTIC_CURVE 416
+#define SSL_DH_PARAM_FILE 417
+#define SSL_MESSAGE_DIGEST_ALGORITHM 418
+#define STANDARD 419
+#define STATS_E_DISABLED 420
+#define STATS_I_OPER_ONLY 421
+#define STATS_K_OPER_ONLY 422
+#define STATS_M_OPER_ONLY 423
+#define STATS_O_OPER_ONLY 424
+#define STATS_P_OPER_ONLY 425
+#define STATS_U_OPER_ONLY 426
+#define T_ALL 427
+#define T_BOTS 428
+#define T_BSIZE 429
+#define T_CALLERID 430
+#define T_CCONN 431
+#define T_COMMAND 432
+#define T_CLUSTER 433
+#define T_DEAF 434
+#define T_DEBUG 435
+#define T_DLINE 436
+#define T_EXTERNAL 437
+#define T_FARCONNECT 438
+#define T_FILE 439
+#define T_FULL 440
+#define T_GLOBOPS 441
+#define T_INVISIBLE 442
+#define T_IPV4 443
+#define T_IPV6 444
+#define T_LOCOPS 445
+#define T_LOG 446
+#define T_NCHANGE 447
+#define T_NONONREG 448
+#define T_OPME 449
+#define T_PREPEND 450
+#define T_PSEUDO 451
+#define T_RECVQ 452
+#define T_REJ 453
+#define T_RESTART 454
+#define T_SERVER 455
+#define T_SERVICE 456
+#define T_SERVNOTICE 457
+#define T_SET 458
+#define T_SHARED 459
+#define T_SIZE 460
+#define T_SKILL 461
+#define T_SOFTCALLERID 462
+#define T_SPY 463
+#define T_SSL 464
+#define T_SSL_CIPHER_LIST 465
+#define T_TARGET 466
+#define T_UMODES 467
+#define T_UNAUTH 468
+#define T_UNDLINE 469
+#define T_UNLIMITED 470
+#define T_UNRESV 471
+#define T_UNXLINE 472
+#define T_WALLOP 473
+#define T_WALLOPS 474
+#define T_WEBIRC 475
+#define TBOOL 476
+#define THROTTLE_COUNT 477
+#define THROTTLE_TIME 478
+#define TKLINE_EXPIRE_NOTICES 479
+#define TMASKED 480
+#define TS_MAX_DELTA 481
+#define TS_WARN_DELTA 482
+#define TWODOTS 483
+#define TYPE 484
+#define UNKLINE 485
+#define USE_LOGGING 486
+#define USER 487
+#define VHOST 488
+#define VHOST6 489
+#define WARN_NO_CONNECT_BLOCK 490
+#define WHOIS 491
+#define WHOWAS_HISTORY_LENGTH 492
+#define XLINE 493
+#define XLINE_EXEMPT 494
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -525,9 +531,10 @@ union YYSTYPE
 #line 141 "conf_parser.y" /* yacc.c:1909  */
 
   int number;
+  uintmax_t size;
   char *string;
 
-#line 531 "conf_parser.h" /* yacc.c:1909  */
+#line 538 "conf_parser.h" /* yacc.c:1909  */
 };
 
 typedef union YYSTYPE YYSTYPE;
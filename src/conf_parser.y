@@ -140,6 +140,7 @@ reset_block_state(void)
 
 %union {
   int number;
+  uintmax_t size;
   char *string;
 }
 
@@ -160,6 +161,7 @@ reset_block_state(void)
 %token  CIDR_BITLEN_IPV6
 %token  CLASS
 %token  CLOSE
+%token  COMPRESSED
 %token  CONNECT
 %token  CONNECTFREQ
 %token  CYCLE_ON_HOST_CHANGE
@@ -238,6 +240,7 @@ reset_block_state(void)
 %token  MAX_TARGETS
 %token  MAX_TOPIC_LENGTH
 %token  MAX_WATCH
+%token  MEMORY_BUDGET
 %token  MEMORY_CACHE
 %token  MIN_IDLE
 %token  MIN_NONWILDCARD
@@ -304,6 +307,7 @@ reset_block_state(void)
 %token  STATS_U_OPER_ONLY
 %token  T_ALL
 %token  T_BOTS
+%token  T_BSIZE
 %token  T_CALLERID
 %token  T_CCONN
 %token  T_COMMAND
@@ -376,6 +380,8 @@ reset_block_state(void)
 %type  <number> timespec_
 %type  <number> sizespec
 %type  <number> sizespec_
+%type  <size>   sizespec_large
+%type  <size>   sizespec_large_
 
 %%
 conf:
@@ -427,6 +433,13 @@ sizespec:   NUMBER sizespec_ { $$ = $1 + $2; } |
             NUMBER MBYTES sizespec_ { $$ = $1 * 1024 * 1024 + $3; }
             ;
 
+sizespec_large_:  { $$ = 0; } | sizespec_large;
+sizespec_large:   NUMBER sizespec_large_ { $$ = (uintmax_t)$1 + $2; } |
+                  NUMBER BYTES sizespec_large_ { $$ = (uintmax_t)$1 + $3; } |
+                  NUMBER KBYTES sizespec_large_ { $$ = (uintmax_t)$1 * 1024 + $3; } |
+                  NUMBER MBYTES sizespec_large_ { $$ = (uintmax_t)$1 * 1024 * 1024 + $3; }
+                  ;
+
 
 /***************************************************************************
  * modules {} section
@@ -631,7 +644,7 @@ serverinfo_description: DESCRIPTION '=' QSTRING ';'
   {
     xfree(ConfigServerInfo.description);
     ConfigServerInfo.description = xstrdup(yylval.string);
-    strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+    client_set_info(&me, ConfigServerInfo.description);
   }
 };
 
@@ -2236,6 +2249,14 @@ connect_flags_item: AUTOCONN
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_ALLOW_AUTO_CONN;
+} | COMPRESSED
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_COMPRESSED;
+} | T_BSIZE
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_BSIZE;
 } | T_SSL
 {
   if (conf_parser_ctx.pass == 2)
@@ -2502,6 +2523,7 @@ general_item:       general_away_count |
                     general_kline_min_cidr6 |
                     general_stats_e_disabled |
                     general_max_watch |
+                    general_memory_budget |
                     general_cycle_on_host_change |
                     error;
 
@@ -2521,6 +2543,20 @@ general_max_watch: MAX_WATCH '=' NUMBER ';'
   ConfigGeneral.max_watch = $3;
 };
 
+general_memory_budget: MEMORY_BUDGET '=' sizespec_large ';'
+{
+  /* Kept in megabytes, rounded up */
+  const uintmax_t megabytes = $3 / (1024 * 1024) + ($3 % (1024 * 1024) != 0);
+
+  if (conf_parser_ctx.pass != 2)
+    break;
+
+  if (megabytes > UINT_MAX || megabytes > SIZE_MAX / (1024 * 1024))
+    conf_error_report("Ignoring general::memory_budget -- too large");
+  else
+    ConfigGeneral.memory_budget = megabytes;
+};
+
 general_whowas_history_length: WHOWAS_HISTORY_LENGTH '=' NUMBER ';'
 {
   ConfigGeneral.whowas_history_length = $3;
@@ -0,0 +1,272 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file cursor.c
+ * \brief Replies that are sent in slices bounded by the sendq.
+ * \version $Id$
+ */
+
+/*
+ * A cursor remembers how far a long reply, such as LIST or the NAMES of
+ * a big channel, has got. The reply is sent item by item until the lane
+ * it goes to holds half of the client's sendq; the rest follows from
+ * io_loop() as the client reads. Cursors of a client that go to the same
+ * lane are run one after the other, in the order they were started.
+ *
+ * A cursor either walks a list through Cursor::pos, or a hash table
+ * through Cursor::index. Code that unlinks an item from a list walked
+ * by cursors calls cursor_unlink() first; hash tables are walked a whole
+ * bucket at a time, so no pointers into them are kept.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "conf_class.h"
+#include "cursor.h"
+#include "dbuf.h"
+#include "memory.h"
+#include "pressure.h"
+#include "send.h"
+
+
+dlink_list cursor_list;
+
+
+static void
+cursor_destroy(struct Cursor *cursor)
+{
+  if (cursor->type->free)
+    cursor->type->free(cursor);
+
+  xfree(cursor);
+}
+
+/*
+ * Whether this is the oldest cursor of its client that goes to its lane
+ */
+static int
+cursor_first(const struct Cursor *cursor)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, cursor->client_p->connection->cursors.head)
+  {
+    const struct Cursor *other = node->data;
+
+    if (other->type->bulk == cursor->type->bulk)
+      return other == cursor;
+  }
+
+  return 0;
+}
+
+/*
+ * Sendq limit is fairly conservative at 1/2, as it was for LIST
+ */
+static int
+cursor_blocked(const struct Cursor *cursor)
+{
+  const struct Connection *const conn = cursor->client_p->connection;
+  const struct dbuf_queue *const lane = cursor->type->bulk ? &conn->buf_bulkq : &conn->buf_sendq;
+
+  if (dbuf_length(lane) > get_sendq(&conn->confs) / 2)
+    return 1;
+
+  return pressure_defer();
+}
+
+/* cursor_run()
+ *
+ * inputs       - pointer to cursor
+ * output       - NONE
+ * side effects - the reply is sent until the sendq backs up. The
+ *                cursor is freed once the reply is complete.
+ */
+static void
+cursor_run(struct Cursor *cursor)
+{
+  struct Client *const client_p = cursor->client_p;
+  int more = 1;
+
+  if (IsDead(client_p) || !cursor_first(cursor))
+    return;
+
+  if (cursor->type->bulk)
+    sendto_bulk_begin(client_p);
+
+  while (more && !cursor_blocked(cursor))
+    more = cursor->type->step(client_p, cursor);
+
+  if (cursor->type->bulk)
+    sendto_bulk_end();
+
+  if (!more)
+    cursor_free(cursor);
+}
+
+/* cursor_start()
+ *
+ * inputs       - pointer to client the reply is for
+ *              - pointer to type of cursor
+ *              - first list item to be sent, if any
+ *              - state of the command, freed by the type's free function
+ * output       - NONE
+ * side effects - as much of the reply as the sendq allows is sent right
+ *                away. Remote clients are sent all of it; their server
+ *                link is paced as a whole.
+ */
+void
+cursor_start(struct Client *client_p, const struct CursorType *type, dlink_node *pos, void *data)
+{
+  struct Cursor *const cursor = xcalloc(sizeof(*cursor));
+
+  cursor->client_p = client_p;
+  cursor->type = type;
+  cursor->pos = pos;
+  cursor->data = data;
+
+  if (!MyConnect(client_p))
+  {
+    while (type->step(client_p, cursor))
+      ;
+
+    cursor_destroy(cursor);
+    return;
+  }
+
+  dlinkAddTail(cursor, &cursor->node, &cursor_list);
+  dlinkAddTail(cursor, &cursor->cnode, &client_p->connection->cursors);
+
+  cursor_run(cursor);
+}
+
+/* cursor_run_all()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - paused replies are continued; called from io_loop()
+ */
+void
+cursor_run_all(void)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, cursor_list.head)
+    cursor_run(node->data);
+}
+
+/* cursor_unlink()
+ *
+ * inputs       - list node that is about to be unlinked
+ * output       - NONE
+ * side effects - cursors that were about to send it move on to the next
+ */
+void
+cursor_unlink(const dlink_node *node)
+{
+  dlink_node *ptr;
+
+  DLINK_FOREACH(ptr, cursor_list.head)
+  {
+    struct Cursor *const cursor = ptr->data;
+
+    if (cursor->pos == node)
+      cursor->pos = node->next;
+  }
+}
+
+/* cursor_find()
+ *
+ * inputs       - pointer to client
+ *              - pointer to type of cursor
+ * output       - the client's most recent cursor of that type, or NULL
+ * side effects - NONE
+ */
+struct Cursor *
+cursor_find(const struct Client *client_p, const struct CursorType *type)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH_PREV(node, client_p->connection->cursors.tail)
+  {
+    struct Cursor *const cursor = node->data;
+
+    if (cursor->type == type)
+      return cursor;
+  }
+
+  return NULL;
+}
+
+void
+cursor_free(struct Cursor *cursor)
+{
+  dlinkDelete(&cursor->node, &cursor_list);
+  dlinkDelete(&cursor->cnode, &cursor->client_p->connection->cursors);
+
+  cursor_destroy(cursor);
+}
+
+void
+cursor_free_all(struct Client *client_p)
+{
+  while (client_p->connection->cursors.head)
+    cursor_free(client_p->connection->cursors.head->data);
+}
+
+/* cursor_free_type()
+ *
+ * inputs       - pointer to type of cursor
+ * output       - NONE
+ * side effects - replies of that type are abandoned; called by modules
+ *                that are unloaded
+ */
+void
+cursor_free_type(const struct CursorType *type)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, cursor_list.head)
+  {
+    struct Cursor *const cursor = node->data;
+
+    if (cursor->type == type)
+      cursor_free(cursor);
+  }
+}
+
+void
+cursor_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, cursor_list.head)
+  {
+    const struct Cursor *const cursor = node->data;
+
+    (*count)++;
+    (*bytes) += sizeof(*cursor);
+
+    if (cursor->type->memory)
+      (*bytes) += cursor->type->memory(cursor);
+  }
+}
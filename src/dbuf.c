@@ -36,7 +36,13 @@ static mp_pool_t *dbuf_pool;
 void
 dbuf_init(void)
 {
-  dbuf_pool = mp_pool_new(sizeof(struct dbuf_block), MP_CHUNK_SIZE_DBUF);
+  dbuf_pool = mp_pool_new("dbuf", sizeof(struct dbuf_block), MP_CHUNK_SIZE_DBUF);
+}
+
+size_t
+dbuf_memory(void)
+{
+  return dbuf_pool->n_items * sizeof(struct dbuf_block);
 }
 
 struct dbuf_block *
@@ -125,7 +131,8 @@ dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
   {
     struct dbuf_block *block = dbuf_length(queue) ? queue->blocks.tail->data : NULL;
 
-    if (block == NULL || sizeof(block->data) - block->size == 0)
+    /* Blocks shared with other queues must not be appended to */
+    if (block == NULL || block->refs > 1 || sizeof(block->data) - block->size == 0)
     {
       block = dbuf_alloc();
       dlinkAddTail(block, make_dlink_node(), &queue->blocks);
@@ -34,6 +34,8 @@
 #include "id.h"
 #include "rng_mt.h"
 #include "userhost.h"
+#include "intern.h"
+#include "cursor.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "numeric.h"
@@ -54,6 +56,9 @@ static struct Client *clientTable[HASHSIZE];
 static struct Channel *channelTable[HASHSIZE];
 static struct UserHost *userhostTable[HASHSIZE];
 
+/* Bumped whenever a client or a server is added to clientTable */
+static uintmax_t client_generation, server_generation;
+
 
 /* hash_init()
  *
@@ -122,6 +127,24 @@ hash_add_client(struct Client *client_p)
 
   client_p->hnext = clientTable[hashv];
   clientTable[hashv] = client_p;
+
+  ++client_generation;
+  if (IsServer(client_p) || IsMe(client_p))
+    ++server_generation;
+}
+
+/* hash_get_generation()
+ *
+ * inputs       - if set, only servers are accounted
+ * output       - number of names that have been added to the client
+ *                hash so far
+ * side effects - none. Used to tell whether something resolved from
+ *                the client hash could resolve differently by now.
+ */
+uintmax_t
+hash_get_generation(int servers)
+{
+  return servers ? server_generation : client_generation;
 }
 
 /* hash_add_channel()
@@ -395,17 +418,23 @@ struct Channel *
 hash_find_channel(const char *name)
 {
   const unsigned int hashv = strhash(name);
+  const size_t len = strlen(name);
   struct Channel *chptr = NULL;
 
+  /*
+   * The bucket index is all there is of the hash, so entries of a chain
+   * are told apart by the length of their name first, which shares a
+   * cache line with hnextch.
+   */
   if ((chptr = channelTable[hashv]))
   {
-    if (irccmp(name, chptr->name))
+    if (chptr->name_len != len || irccmp(name, chptr->name))
     {
       struct Channel *prev;
 
       while (prev = chptr, (chptr = chptr->hnextch))
       {
-        if (!irccmp(name, chptr->name))
+        if (chptr->name_len == len && !irccmp(name, chptr->name))
         {
           prev->hnextch = chptr->hnextch;
           chptr->hnextch = channelTable[hashv];
@@ -427,13 +456,13 @@ hash_find_userhost(const char *host)
 
   if ((userhost = userhostTable[hashv]))
   {
-    if (irccmp(host, userhost->host))
+    if (!intern_equal(host, userhost->host) && irccmp(host, userhost->host))
     {
       struct UserHost *prev;
 
       while (prev = userhost, (userhost = userhost->next))
       {
-        if (!irccmp(host, userhost->host))
+        if (intern_equal(host, userhost->host) || !irccmp(host, userhost->host))
         {
           prev->next = userhost->next;
           userhost->next = userhostTable[hashv];
@@ -497,33 +526,183 @@ hash_get_bucket(int type, unsigned int hashv)
  * if a hash isn't used in future, oops.
  *
  * - Dianora
+ *
+ * Filtered LISTs walk channel_size_list, biggest channels first, and
+ * only visit the size buckets their member count limits allow. While
+ * they do, channels stay in their buckets (see channel_size_hold()), so
+ * each channel is listed once. A LIST starting while channels wait to
+ * change buckets walks all buckets, as some may be in the wrong one. An
+ * unfiltered LIST, the most common one, is sent from a snapshot of all
+ * channels that aren't secret, sorted by member count. The snapshot is
+ * rendered once and shared by every LIST that starts within
+ * LIST_SNAPSHOT_TIME seconds of it.
  */
 
-/* exceeding_sendq()
+/*! \brief ListSnapshot structure */
+struct ListSnapshot
+{
+  unsigned int refs;    /**< Cursors sending it, plus one while it's current */
+  unsigned int count;   /**< Number of channels */
+  time_t created;       /**< When it was rendered */
+  size_t size;          /**< Length of data */
+  char *data;           /**< RPL_LIST bodies, NUL terminated one after the other */
+};
+
+struct ListEntry
+{
+  unsigned int members;
+  size_t offset;
+};
+
+static struct ListSnapshot *list_snapshot;
+
+
+static void
+list_snapshot_release(struct ListSnapshot *snapshot)
+{
+  if (--snapshot->refs)
+    return;
+
+  xfree(snapshot->data);
+  xfree(snapshot);
+}
+
+static int
+list_entry_cmp(const void *a_, const void *b_)
+{
+  const struct ListEntry *a = a_, *b = b_;
+
+  if (a->members != b->members)
+    return a->members < b->members ? 1 : -1;
+
+  return a->offset < b->offset ? -1 : a->offset > b->offset;
+}
+
+/* list_snapshot_render()
  *
- * inputs       - pointer to client to check
- * output	- 1 if client is in danger of blowing its sendq
- *		  0 if it is not.
- * side effects -
+ * inputs       - NONE
+ * output       - pointer to a new snapshot, with a reference held for
+ *                list_snapshot
+ * side effects - RPL_LIST bodies of all channels that aren't secret are
+ *                rendered and sorted by member count, biggest first
+ */
+static struct ListSnapshot *
+list_snapshot_render(void)
+{
+  struct ListSnapshot *snapshot = xcalloc(sizeof(*snapshot));
+  struct ListEntry *entry = xcalloc(sizeof(*entry) * (dlink_list_length(&channel_list) + 1));
+  size_t size = 0, alloc = 0;
+  char *data = NULL;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, channel_list.head)
+  {
+    struct Channel *chptr = node->data;
+    char modebuf[MODEBUFLEN] = "";
+    char parabuf[MODEBUFLEN] = "";
+    char buf[IRCD_BUFSIZE];
+    int len;
+
+    if (SecretChannel(chptr))
+      continue;
+
+    channel_modes(chptr, &me, modebuf, parabuf);
+    len = snprintf(buf, sizeof(buf), "%s %u :[%s]%s%s", chptr->name,
+                   dlink_list_length(&chptr->members), modebuf,
+                   ChannelTopic(chptr)[0] ? " " : "", ChannelTopic(chptr));
+    if (len >= (int)sizeof(buf))
+      len = sizeof(buf) - 1;
+
+    if (size + len + 1 > alloc)
+    {
+      alloc = (alloc + len + 1) * 2;
+      data = xrealloc(data, alloc);
+    }
+
+    entry[snapshot->count].members = dlink_list_length(&chptr->members);
+    entry[snapshot->count].offset = size;
+    ++snapshot->count;
+
+    memcpy(data + size, buf, len + 1);
+    size += len + 1;
+  }
+
+  qsort(entry, snapshot->count, sizeof(*entry), list_entry_cmp);
+
+  snapshot->data = xcalloc(size + 1);
+  snapshot->size = size;
+
+  size = 0;
+  for (unsigned int i = 0; i < snapshot->count; ++i)
+  {
+    const char *const body = data + entry[i].offset;
+    const size_t len = strlen(body) + 1;
+
+    memcpy(snapshot->data + size, body, len);
+    size += len;
+  }
+
+  xfree(entry);
+  xfree(data);
+
+  snapshot->refs = 1;
+  snapshot->created = CurrentTime;
+  return snapshot;
+}
+
+/* list_snapshot_get()
  *
- * Sendq limit is fairly conservative at 1/2 (In original anyway)
+ * inputs       - NONE
+ * output       - pointer to the current snapshot, with a reference held
+ *                for the caller
+ * side effects - the snapshot is rendered anew if it's too old
+ */
+static struct ListSnapshot *
+list_snapshot_get(void)
+{
+  if (list_snapshot && list_snapshot->created + LIST_SNAPSHOT_TIME <= CurrentTime)
+  {
+    list_snapshot_release(list_snapshot);
+    list_snapshot = NULL;
+  }
+
+  if (list_snapshot == NULL)
+    list_snapshot = list_snapshot_render();
+
+  ++list_snapshot->refs;
+  return list_snapshot;
+}
+
+/*
+ * Whether a LIST shows every channel, as far as it can see them
  */
 static int
-exceeding_sendq(const struct Client *to)
+list_unfiltered(const struct ListTask *lt)
 {
-  if (dbuf_length(&to->connection->buf_sendq) > (get_sendq(&to->connection->confs) / 2))
-    return 1;
-  else
-    return 0;
+  return lt->show_mask.head == NULL && lt->hide_mask.head == NULL &&
+         lt->users_min == 0 && lt->users_max == UINT_MAX &&
+         lt->created_min == 0 && lt->created_max == UINT_MAX &&
+         lt->topicts_min == 0 && lt->topicts_max == UINT_MAX &&
+         lt->topic[0] == '\0';
+}
+
+void
+list_snapshot_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  if (list_snapshot == NULL)
+    return;
+
+  *count = list_snapshot->count;
+  *bytes = sizeof(*list_snapshot) + list_snapshot->size;
 }
 
 void
-free_list_task(struct Client *source_p)
+free_list_task(struct ListTask *lt)
 {
-  struct ListTask *const lt = source_p->connection->list_task;
   dlink_node *node, *node_next;
 
-  dlinkDelete(&lt->node, &listing_client_list);
+  if (lt->snapshot)
+    list_snapshot_release(lt->snapshot);
 
   DLINK_FOREACH_SAFE(node, node_next, lt->show_mask.head)
   {
@@ -538,7 +717,6 @@ free_list_task(struct Client *source_p)
   }
 
   xfree(lt);
-  source_p->connection->list_task = NULL;
 }
 
 /* list_allow_channel()
@@ -574,9 +752,9 @@ list_allow_channel(const char *name, const struct ListTask *lt)
  * side effects -
  */
 static void
-list_one_channel(struct Client *source_p, struct Channel *chptr)
+list_one_channel(struct Client *source_p, struct Channel *chptr,
+                 const struct ListTask *lt)
 {
-  const struct ListTask *const lt = source_p->connection->list_task;
   char listbuf[MODEBUFLEN] = "";
   char modebuf[MODEBUFLEN] = "";
   char parabuf[MODEBUFLEN] = "";
@@ -595,7 +773,7 @@ list_one_channel(struct Client *source_p, struct Channel *chptr)
       lt->topicts_max)
     return;
 
-  if (lt->topic[0] && match(lt->topic, chptr->topic))
+  if (lt->topic[0] && match(lt->topic, ChannelTopic(chptr)))
     return;
 
   if (!list_allow_channel(chptr->name, lt))
@@ -603,56 +781,143 @@ list_one_channel(struct Client *source_p, struct Channel *chptr)
 
   channel_modes(chptr, source_p, modebuf, parabuf);
 
-  if (chptr->topic[0])
+  if (ChannelTopic(chptr)[0])
     snprintf(listbuf, sizeof(listbuf), "[%s] ", modebuf);
   else
     snprintf(listbuf, sizeof(listbuf), "[%s]",  modebuf);
 
   sendto_one_numeric(source_p, &me, RPL_LIST, chptr->name,
                      dlink_list_length(&chptr->members),
-                     listbuf, chptr->topic);
+                     listbuf, ChannelTopic(chptr));
 }
 
-/* safe_list_channels()
+/* safe_list_step()
  *
  * inputs	- pointer to client requesting list
- * output	- 0/1
- * side effects	- safely list all channels to source_p
+ *		- pointer to its list cursor
+ * output	- 0 once the list is complete, 1 otherwise
+ * side effects	- lists the next channel
  *
- * Walk the channel buckets, ensure all pointers in a bucket are
- * traversed before blocking on a sendq. This means, no locking is needed.
- *
- * - Dianora
+ * Snapshot entries are sent by offset into the snapshot, the size
+ * index is walked by Cursor::pos, which channel_free() moves on when
+ * a channel goes away.
  */
-void
-safe_list_channels(struct Client *source_p, int only_unmasked_channels)
+static int
+safe_list_step(struct Client *source_p, struct Cursor *cursor)
 {
-  struct ListTask *const lt = source_p->connection->list_task;
+  struct ListTask *const lt = cursor->data;
   struct Channel *chptr = NULL;
+  dlink_node *node;
 
-  if (!only_unmasked_channels)
+  if (lt->only_unmasked)
+  {
+    DLINK_FOREACH(node, lt->show_mask.head)
+      if ((chptr = hash_find_channel(node->data)))
+        list_one_channel(source_p, chptr, lt);
+  }
+  else if (lt->snapshot)
   {
-    for (unsigned int i = lt->hash_index; i < HASHSIZE; ++i)
+    if (cursor->index < lt->snapshot->size)
     {
-      if (exceeding_sendq(source_p))
-      {
-        lt->hash_index = i;
-        return;  /* Still more to do */
-      }
+      const char *const body = lt->snapshot->data + cursor->index;
+
+      sendto_one_numeric(source_p, &me, RPL_LIST | SND_EXPLICIT, "%s", body);
+      cursor->index += strlen(body) + 1;
+      return 1;
+    }
+
+    /* The snapshot has no secret channels; list the ones we're on */
+    DLINK_FOREACH(node, source_p->channel.head)
+    {
+      const struct Membership *const member = node->data;
 
-      for (chptr = channelTable[i]; chptr; chptr = chptr->hnextch)
-        list_one_channel(source_p, chptr);
+      if (SecretChannel(member->chptr))
+        list_one_channel(source_p, member->chptr, lt);
     }
   }
-  else
+  else if (cursor->pos)
   {
-    dlink_node *node;
+    chptr = cursor->pos->data;
+    cursor->pos = cursor->pos->next;
 
-    DLINK_FOREACH(node, lt->show_mask.head)
-      if ((chptr = hash_find_channel(node->data)))
-        list_one_channel(source_p, chptr);
+    list_one_channel(source_p, chptr, lt);
+    return 1;
+  }
+  else if (lt->bucket > lt->bucket_min)
+  {
+    cursor->pos = channel_size_list[--lt->bucket].head;
+    return 1;
   }
 
-  free_list_task(source_p);
   sendto_one_numeric(source_p, &me, RPL_LISTEND);
+  return 0;
+}
+
+static void
+safe_list_free(struct Cursor *cursor)
+{
+  struct ListTask *const lt = cursor->data;
+
+  if (lt->only_unmasked == 0 && lt->snapshot == NULL)
+    channel_size_release();
+
+  free_list_task(lt);
+}
+
+static size_t
+safe_list_memory(const struct Cursor *cursor)
+{
+  const struct ListTask *const lt = cursor->data;
+  size_t bytes = sizeof(*lt);
+  dlink_node *node;
+
+  DLINK_FOREACH(node, lt->show_mask.head)
+    bytes += strlen(node->data);
+
+  DLINK_FOREACH(node, lt->hide_mask.head)
+    bytes += strlen(node->data);
+
+  return bytes;
+}
+
+const struct CursorType list_cursor_type =
+{
+  .bulk = 1,
+  .step = safe_list_step,
+  .free = safe_list_free,
+  .memory = safe_list_memory
+};
+
+/* safe_list_channels()
+ *
+ * inputs	- pointer to client requesting list
+ *		- pointer to list task, taken over by the cursor
+ * output	- none
+ * side effects	- safely list all channels to source_p
+ */
+void
+safe_list_channels(struct Client *source_p, struct ListTask *lt)
+{
+  if (lt->only_unmasked == 0)
+  {
+    if (list_unfiltered(lt) && !HasUMode(source_p, UMODE_ADMIN))
+      lt->snapshot = list_snapshot_get();
+    else
+    {
+      if (channel_size_stale())
+      {
+        lt->bucket_min = 0;
+        lt->bucket = CHANNEL_SIZE_BUCKETS;
+      }
+      else
+      {
+        lt->bucket_min = channel_size_bucket(lt->users_min);
+        lt->bucket = channel_size_bucket(lt->users_max) + 1;
+      }
+
+      channel_size_hold();
+    }
+  }
+
+  cursor_start(source_p, &list_cursor_type, NULL, lt);
 }
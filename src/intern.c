@@ -0,0 +1,193 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file intern.c
+ * \brief Shared, reference counted strings.
+ * \version $Id$
+ */
+
+/*
+ * Strings that are stored many times over, such as the hostnames and
+ * realnames of clients, are kept once in a hash table and shared by
+ * everyone who uses them. intern_get() returns the shared copy of a
+ * string, taking a reference; intern_release() drops it again. Shared
+ * strings are read-only. The empty string is not counted; intern_get()
+ * returns a static "" for it, which intern_release() ignores.
+ */
+
+#include "stdinc.h"
+#include "memory.h"
+#include "intern.h"
+
+enum { INTERN_HASHSIZE = 262144 };
+
+struct InternString
+{
+  struct InternString *hnext;  /**< Next string in the hash bucket */
+  unsigned int hashv;          /**< Hash value of the string */
+  unsigned int refcount;       /**< Number of users of the string */
+  char data[];
+};
+
+static struct InternString *intern_table[INTERN_HASHSIZE];
+static const char intern_empty[] = "";
+
+
+/* FNV-1a, case sensitive unlike strhash() */
+static unsigned int
+intern_hash(const char *str)
+{
+  unsigned int hashv = 2166136261U;
+
+  while (*str)
+  {
+    hashv ^= (unsigned char)*str++;
+    hashv *= 16777619U;
+  }
+
+  return hashv;
+}
+
+/* intern_get()
+ *
+ * inputs       - string to share
+ * output       - pointer to the shared copy of the string
+ * side effects - a reference to the shared copy is taken, which must be
+ *                dropped with intern_release()
+ */
+const char *
+intern_get(const char *str)
+{
+  struct InternString *intern;
+  unsigned int hashv;
+  size_t len;
+
+  if (*str == '\0')
+    return intern_empty;
+
+  hashv = intern_hash(str);
+
+  for (intern = intern_table[hashv % INTERN_HASHSIZE]; intern; intern = intern->hnext)
+  {
+    if (intern->hashv == hashv && strcmp(intern->data, str) == 0)
+    {
+      ++intern->refcount;
+      return intern->data;
+    }
+  }
+
+  len = strlen(str);
+  intern = xcalloc(sizeof(*intern) + len + 1);
+  intern->hashv = hashv;
+  intern->refcount = 1;
+  memcpy(intern->data, str, len);
+
+  intern->hnext = intern_table[hashv % INTERN_HASHSIZE];
+  intern_table[hashv % INTERN_HASHSIZE] = intern;
+  return intern->data;
+}
+
+/* intern_ref()
+ *
+ * inputs       - pointer to a string as returned by intern_get()
+ * output       - the same pointer
+ * side effects - another reference to the shared string is taken
+ */
+const char *
+intern_ref(const char *str)
+{
+  struct InternString *intern;
+
+  if (str == intern_empty)
+    return str;
+
+  intern = (struct InternString *)(str - offsetof(struct InternString, data));
+  assert(intern->refcount);
+
+  ++intern->refcount;
+  return str;
+}
+
+/* intern_release()
+ *
+ * inputs       - pointer to a string as returned by intern_get(), or NULL
+ * output       - NONE
+ * side effects - the reference is dropped; the string is freed along
+ *                with the last one
+ */
+void
+intern_release(const char *str)
+{
+  struct InternString *intern, **prev;
+
+  if (str == NULL || str == intern_empty)
+    return;
+
+  intern = (struct InternString *)(str - offsetof(struct InternString, data));
+  assert(intern->refcount);
+
+  if (--intern->refcount)
+    return;
+
+  for (prev = &intern_table[intern->hashv % INTERN_HASHSIZE]; *prev; prev = &(*prev)->hnext)
+  {
+    if (*prev == intern)
+    {
+      *prev = intern->hnext;
+      break;
+    }
+  }
+
+  xfree(intern);
+}
+
+/* intern_count_memory()
+ *
+ * inputs       - pointer to where the number of strings should go
+ *              - pointer to where the number of references should go
+ *              - pointer to where the memory used should go
+ *              - pointer to where the memory the references would use
+ *                with a copy each should go
+ * output       - NONE
+ * side effects - NONE
+ */
+void
+intern_count_memory(unsigned int *const count, unsigned int *const refs,
+                    size_t *const bytes, size_t *const unshared)
+{
+  *count = *refs = 0;
+  *bytes = *unshared = 0;
+
+  for (unsigned int i = 0; i < INTERN_HASHSIZE; ++i)
+  {
+    for (const struct InternString *intern = intern_table[i]; intern; intern = intern->hnext)
+    {
+      const size_t len = strlen(intern->data) + 1;
+
+      ++(*count);
+      *refs += intern->refcount;
+      *bytes += sizeof(*intern) + len;
+      *unshared += intern->refcount * len;
+    }
+  }
+
+  *bytes += sizeof(intern_table);
+}
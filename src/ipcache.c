@@ -27,14 +27,16 @@
 #include "stdinc.h"
 #include "list.h"
 #include "ipcache.h"
-#include "event.h"
 #include "mempool.h"
 #include "conf.h"
 #include "ircd.h"
+#include "misc.h"
 
 
 static dlink_list ip_hash_table[IP_HASH_SIZE];
 static mp_pool_t *ip_entry_pool;
+static struct ip_throttle ip_throttle_table[IP_THROTTLE_SIZE];
+static unsigned int ip_throttle_rejected[IP_THROTTLE_LEVELS];
 
 
 /* ipcache_hash_address()
@@ -153,41 +155,194 @@ ipcache_remove_address(const struct irc_ssaddr *addr)
 
     assert(iptr->count > 0);
 
-    if (--iptr->count == 0 &&
-        (CurrentTime - iptr->last_attempt) >= ConfigGeneral.throttle_time)
+    if (--iptr->count == 0)
     {
       dlinkDelete(&iptr->node, &ip_hash_table[hash_index]);
       mp_pool_release(iptr);
-      return;
     }
+
+    return;
   }
 }
 
-/* ipcache_remove_expired_entries()
+/* ipcache_mix()
  *
- * input        - NONE
- * output       - NONE
- * side effects - free up all ip entries with no connections
+ * splitmix64 finalizer, so neighbouring prefixes spread over a table
  */
-static void
-ipcache_remove_expired_entries(void *unused)
+static uint64_t
+ipcache_mix(uint64_t key)
 {
-  dlink_node *node = NULL, *node_next = NULL;
+  key ^= key >> 30;
+  key *= UINT64_C(0xBF58476D1CE4E5B9);
+  key ^= key >> 27;
+  key *= UINT64_C(0x94D049BB133111EB);
+  key ^= key >> 31;
+  return key;
+}
 
-  for (unsigned int i = 0; i < IP_HASH_SIZE; ++i)
+/* ipcache_prefix_key()
+ *
+ * inputs       - pointer to struct irc_ssaddr
+ *              - prefix length in bits to use for IPv4
+ *              - prefix length in bits to use for IPv6
+ * output       - non-zero 64 bit key identifying the masked prefix
+ * side effects - none
+ */
+uint64_t
+ipcache_prefix_key(const struct irc_ssaddr *addr, unsigned int bits_v4, unsigned int bits_v6)
+{
+  uint64_t key;
+
+  if (addr->ss.ss_family == AF_INET)
   {
-    DLINK_FOREACH_SAFE(node, node_next, ip_hash_table[i].head)
+    const struct sockaddr_in *const v4 = (const struct sockaddr_in *)addr;
+
+    key = ntohl(v4->sin_addr.s_addr) & (uint32_t)(UINT64_C(0xFFFFFFFF) << (32 - bits_v4));
+    key |= (uint64_t)bits_v4 << 32;
+  }
+  else
+  {
+    const struct sockaddr_in6 *const v6 = (const struct sockaddr_in6 *)addr;
+    const uint8_t *const ip = v6->sin6_addr.s6_addr;
+    uint64_t hi = 0, lo = 0;
+
+    for (unsigned int i = 0; i < 8; ++i)
     {
-      struct ip_entry *iptr = node->data;
-
-      if (iptr->count == 0 &&
-          (CurrentTime - iptr->last_attempt) >= ConfigGeneral.throttle_time)
-      {
-        dlinkDelete(&iptr->node, &ip_hash_table[i]);
-        mp_pool_release(iptr);
-      }
+      hi = (hi << 8) | ip[i];
+      lo = (lo << 8) | ip[i + 8];
     }
+
+    if (bits_v6 <= 64)
+    {
+      hi &= bits_v6 ? ~UINT64_C(0) << (64 - bits_v6) : 0;
+      lo = 0;
+    }
+    else if (bits_v6 < 128)
+      lo &= ~UINT64_C(0) << (128 - bits_v6);
+
+    key = hi ^ ipcache_mix(lo ^ (uint64_t)(bits_v6 + 128) * UINT64_C(0x9E3779B97F4A7C15));
   }
+
+  key = ipcache_mix(key);
+  return key ? key : 1;
+}
+
+/* ipcache_throttle_find()
+ *
+ * inputs       - key as returned by ipcache_prefix_key()
+ *              - current time in milliseconds
+ *              - whether to claim a slot if the key isn't present
+ * output       - pointer to the slot holding the key, NULL if not
+ *                found and not asked to claim one
+ * side effects - a claimed slot is reset to a full bucket
+ *
+ * A slot whose bucket has refilled completely is equivalent to an unused
+ * one, so there is no need to ever sweep the table. If every slot in the
+ * probe window is busy, the one closest to refilling is sacrificed.
+ */
+static struct ip_throttle *
+ipcache_throttle_find(uint64_t key, uint64_t now, int claim)
+{
+  struct ip_throttle *victim = NULL;
+
+  for (unsigned int i = 0; i < IP_THROTTLE_PROBE; ++i)
+  {
+    struct ip_throttle *const slot = &ip_throttle_table[(key + i) & (IP_THROTTLE_SIZE - 1)];
+
+    if (slot->key == key)
+      return slot;
+
+    if (slot->tat <= now)
+    {
+      if (victim == NULL || victim->tat > now)
+        victim = slot;
+    }
+    else if (victim == NULL || (victim->tat > now && slot->tat < victim->tat))
+      victim = slot;
+  }
+
+  if (!claim)
+    return NULL;
+
+  victim->key = key;
+  victim->tat = 0;
+  return victim;
+}
+
+/* ipcache_throttle_check()
+ *
+ * inputs       - pointer to struct irc_ssaddr
+ * output       - 0 if the connect conforms to the throttle, non-zero
+ *                if it has to be refused
+ * side effects - a token is taken from the bucket of every aggregation
+ *                level the address belongs to, unless one of them is
+ *                exhausted
+ *
+ * Each level is a token bucket holding throttle_count tokens (times
+ * THROTTLE_NETWORK_FACTOR for network prefixes) that refills completely
+ * within throttle_time. Refilling is computed lazily on access.
+ */
+int
+ipcache_throttle_check(const struct irc_ssaddr *addr)
+{
+  uint64_t key[IP_THROTTLE_LEVELS], interval[IP_THROTTLE_LEVELS];
+  const uint64_t now = CurrentTime * 1000 + SystemTime.tv_usec / 1000;
+  const uint64_t period = (uint64_t)ConfigGeneral.throttle_time * 1000;
+
+  if (period == 0 || ConfigGeneral.throttle_count == 0)
+    return 0;
+
+  for (unsigned int level = 0; level < IP_THROTTLE_LEVELS; ++level)
+  {
+    const uint64_t burst = level == IP_THROTTLE_HOST ? ConfigGeneral.throttle_count :
+                           ConfigGeneral.throttle_count * THROTTLE_NETWORK_FACTOR;
+    const struct ip_throttle *slot;
+
+    if (level == IP_THROTTLE_HOST)
+      key[level] = ipcache_prefix_key(addr, 32, THROTTLE_HOST_IPV6);
+    else
+      key[level] = ipcache_prefix_key(addr, THROTTLE_NETWORK_IPV4, THROTTLE_NETWORK_IPV6);
+    interval[level] = IRCD_MAX(period / burst, 1);
+
+    slot = ipcache_throttle_find(key[level], now, 0);
+    if (slot && slot->tat > now && slot->tat - now > period - interval[level])
+    {
+      ++ip_throttle_rejected[level];
+      return 1;
+    }
+  }
+
+  for (unsigned int level = 0; level < IP_THROTTLE_LEVELS; ++level)
+  {
+    struct ip_throttle *const slot = ipcache_throttle_find(key[level], now, 1);
+    slot->tat = IRCD_MAX(slot->tat, now) + interval[level];
+  }
+
+  return 0;
+}
+
+/* ipcache_throttle_get_stats()
+ *
+ * inputs        - pointer to counter of active throttle slots
+ *               - pointer to memory used by the throttle table
+ *               - array of IP_THROTTLE_LEVELS rejection counters
+ * output        - returned via pointers input
+ * side effects  - NONE
+ */
+void
+ipcache_throttle_get_stats(unsigned int *const active, size_t *const memory,
+                           unsigned int *const rejected)
+{
+  const uint64_t now = CurrentTime * 1000 + SystemTime.tv_usec / 1000;
+
+  for (unsigned int i = 0; i < IP_THROTTLE_SIZE; ++i)
+    if (ip_throttle_table[i].key && ip_throttle_table[i].tat > now)
+      ++*active;
+
+  *memory = sizeof(ip_throttle_table);
+
+  for (unsigned int level = 0; level < IP_THROTTLE_LEVELS; ++level)
+    rejected[level] = ip_throttle_rejected[level];
 }
 
 /* ipcache_get_stats()
@@ -211,13 +366,5 @@ ipcache_get_stats(unsigned int *const number_ips_stored, size_t *const mem_ips_s
 void
 ipcache_init(void)
 {
-  static struct event event_expire_ipcache =
-  {
-    .name = "ipcache_remove_expired_entries",
-    .handler = ipcache_remove_expired_entries,
-    .when = 123
-  };
-
-  event_add(&event_expire_ipcache, NULL);
-  ip_entry_pool = mp_pool_new(sizeof(struct ip_entry), MP_CHUNK_SIZE_IP_ENTRY);
+  ip_entry_pool = mp_pool_new("ip_entry", sizeof(struct ip_entry), MP_CHUNK_SIZE_IP_ENTRY);
 }
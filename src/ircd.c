@@ -52,6 +52,8 @@
 #include "modules.h"
 #include "memory.h"
 #include "mempool.h"
+#include "pressure.h"
+#include "cursor.h"
 #include "ircd_getopt.h"
 #include "watch.h"
 #include "conf_db.h"
@@ -59,6 +61,7 @@
 #include "ipcache.h"
 #include "isupport.h"
 #include "userhost.h"
+#include "zip.h"
 
 
 #ifdef HAVE_LIBGEOIP
@@ -101,6 +104,8 @@ static struct lgetopt myopts[] =
    STRING, "File to use for process ID" },
   { "foreground", &server_state.foreground,
    YESNO, "Run in foreground (don't detach)" },
+  { "hugepages",  &mp_pool_hugepages,
+   YESNO, "Map large memory pools as transparent huge pages" },
   { "version",    &printVersion,
    YESNO, "Print version and exit" },
   { "help", NULL, USAGE, "Print this text" },
@@ -175,19 +180,31 @@ io_loop(void)
 {
   while (1)
   {
-    if (listing_client_list.head)
+    pressure_check();
+
+    if (cursor_list.head)
+      cursor_run_all();
+
+    if (bursting_server_list.head)
     {
       dlink_node *node = NULL, *node_next = NULL;
-      DLINK_FOREACH_SAFE(node, node_next, listing_client_list.head)
-        safe_list_channels(node->data, 0);
+      DLINK_FOREACH_SAFE(node, node_next, bursting_server_list.head)
+        server_burst_continue(node->data);
     }
 
     /* Run pending events */
     event_run();
 
+    /* Flush the compressed streams of server links before we block */
+    zip_flush_all();
+
     comm_select();
     exit_aborted_clients();
     free_exited_clients();
+    free_split_clients();
+
+    /* Send out the DNS queries queued up during this iteration */
+    resolver_flush();
 
     /* Check to see whether we have to rehash the configuration. */
     if (dorehash)
@@ -224,6 +241,7 @@ initialize_global_set_options(void)
   GlobalSetOptions.joinfloodcount = ConfigChannel.default_join_flood_count;
   GlobalSetOptions.joinfloodtime = ConfigChannel.default_join_flood_time;
   GlobalSetOptions.ident_timeout = IDENT_TIMEOUT;
+  GlobalSetOptions.dns_cache_size = DNS_CACHE_SIZE;
 }
 
 /* write_pidfile()
@@ -420,7 +438,6 @@ main(int argc, char *argv[])
   ipcache_init();
   client_init();
   class_init();
-  whowas_init();
   watch_init();
   auth_init();          /* Initialise the auth code */
   resolver_init();      /* Needs to be setup before the io loop */
@@ -448,7 +465,7 @@ main(int argc, char *argv[])
     exit(EXIT_FAILURE);
   }
 
-  strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
+  client_set_info(&me, ConfigServerInfo.description);
 
   if (EmptyString(ConfigServerInfo.sid))
   {
@@ -462,6 +479,9 @@ main(int argc, char *argv[])
 
   me.from = &me;
   me.servptr = &me;
+  client_set_host(&me, "");
+  client_set_away(&me, "");
+  client_set_sockhost(&me, "");
   me.connection->lasttime = CurrentTime;
   me.connection->since = CurrentTime;
   me.connection->firsttime = CurrentTime;
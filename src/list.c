@@ -41,7 +41,7 @@ static mp_pool_t *dnode_pool;
 void
 init_dlink_nodes(void)
 {
-  dnode_pool = mp_pool_new(sizeof(dlink_node), MP_CHUNK_SIZE_DNODE);
+  dnode_pool = mp_pool_new("dlink_node", sizeof(dlink_node), MP_CHUNK_SIZE_DNODE);
 }
 
 /* make_dlink_node()
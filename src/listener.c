@@ -36,10 +36,13 @@
 #include "conf.h"
 #include "send.h"
 #include "memory.h"
+#include "pressure.h"
 
 #define TOOFAST_WARNING "ERROR :Your host is trying to (re)connect too fast -- throttled.\r\n"
 #define DLINE_WARNING "ERROR :You have been D-lined.\r\n"
 #define ALLINUSE_WARNING "ERROR :All connections in use\r\n"
+#define PRESSURE_WARNING "ERROR :Server under memory pressure\r\n"
+#define PRESSURE_NOTICE "NOTICE * :*** Server under memory pressure, replies may be delayed\r\n"
 
 static dlink_list listener_list;
 
@@ -127,6 +130,17 @@ listener_accept_connection(fde_t *pfd, void *data)
       break;    /* jump out and re-register a new io request */
     }
 
+    if (!pressure_accept())
+    {
+      ++ServerStats.is_ref;
+
+      if (!(listener->flags & LISTENER_SSL))
+        send(fd, PRESSURE_WARNING, sizeof(PRESSURE_WARNING) - 1, 0);
+
+      close(fd);
+      continue;    /* drop the one and keep on clearing the queue */
+    }
+
     /*
      * Do an initial check we aren't connecting too fast or with too many
      * from this IP...
@@ -152,6 +166,9 @@ listener_accept_connection(fde_t *pfd, void *data)
       continue;    /* drop the one and keep on clearing the queue */
     }
 
+    if (!(listener->flags & LISTENER_SSL) && pressure_warn())
+      send(fd, PRESSURE_NOTICE, sizeof(PRESSURE_NOTICE) - 1, 0);
+
     ++ServerStats.is_ac;
     add_connection(listener, &addr, fd);
   }
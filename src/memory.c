@@ -44,6 +44,22 @@ xcalloc(size_t size)
   return ret;
 }
 
+/*
+ * xcalloc_aligned - allocate memory on an alignment boundary, which must
+ * be a power of two multiple of sizeof(void *); free with xfree()
+ */
+void *
+xcalloc_aligned(size_t alignment, size_t size)
+{
+  void *ret = NULL;
+
+  if (posix_memalign(&ret, alignment, size))
+    outofmemory();
+
+  memset(ret, 0, size);
+  return ret;
+}
+
 /*
  * xrealloc - reallocate memory, call outofmemory on failure
  */
@@ -42,6 +42,8 @@
 #include "log.h"
 #include "mempool.h"
 
+#include <sys/mman.h>
+
 
 /** Returns floor(log2(u64)).  If u64 is 0, (incorrectly) returns 0. */
 static int
@@ -172,6 +174,14 @@ round_to_power_of_2(uint64_t u64)
 #define MAX_CHUNK (8 *(1L << 20))
 /** Smallest memory chunk size that we should allocate. */
 #define MIN_CHUNK 4096
+/** Size and alignment of chunks mapped as transparent huge pages. */
+#define HUGEPAGE_CHUNK (2 * (1L << 20))
+/** Smallest chunk size that is rounded up to HUGEPAGE_CHUNK if
+ * mp_pool_hugepages is set; smaller pools would waste too much. */
+#define HUGEPAGE_MIN_CHUNK (HUGEPAGE_CHUNK / 4)
+/** Largest number of empty chunks freed per pool by one garbage
+ * collection run. */
+#define GC_MAX_CHUNKS 16
 
 typedef struct mp_allocated_t mp_allocated_t;
 typedef struct mp_chunk_t mp_chunk_t;
@@ -223,6 +233,10 @@ struct mp_chunk_t
 
 static mp_pool_t *mp_allocated_pools;
 
+/** If set, chunks of pools created from now on that are at least
+ * HUGEPAGE_MIN_CHUNK bytes are mapped as transparent huge pages. */
+int mp_pool_hugepages;
+
 /** Number of extra bytes needed beyond mem_size to allocate a chunk. */
 #define CHUNK_OVERHEAD offsetof(mp_chunk_t, mem[0])
 
@@ -246,17 +260,65 @@ mp_pool_init(void)
   event_add(&event_mp_gc, NULL);
 }
 
+/** Helper: Return zeroed memory for a chunk of <b>pool</b>. Huge page
+ * chunks are mapped on a HUGEPAGE_CHUNK boundary so the kernel can back
+ * them with huge pages. */
+static void *
+mp_chunk_alloc(const mp_pool_t *pool)
+{
+#ifdef MADV_HUGEPAGE
+  if (pool->hugepages)
+  {
+    const size_t size = pool->chunk_alloc_size;
+    char *map = mmap(NULL, size + HUGEPAGE_CHUNK, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    char *mem;
+
+    if (map == MAP_FAILED)
+      outofmemory();
+
+    /* Trim the mapping to an aligned region of the chunk size */
+    mem = (char *)(((uintptr_t)map + HUGEPAGE_CHUNK - 1) & ~(uintptr_t)(HUGEPAGE_CHUNK - 1));
+    if (mem > map)
+      munmap(map, mem - map);
+    if (mem < map + HUGEPAGE_CHUNK)
+      munmap(mem + size, map + HUGEPAGE_CHUNK - mem);
+
+    madvise(mem, size, MADV_HUGEPAGE);
+    return mem;
+  }
+#endif
+
+  return xcalloc(pool->chunk_alloc_size);
+}
+
+/** Helper: Return the memory of a chunk of <b>pool</b>. */
+static void
+mp_chunk_free(const mp_pool_t *pool, mp_chunk_t *chunk)
+{
+  chunk->magic = 0xdeadbeef;
+
+#ifdef MADV_HUGEPAGE
+  if (pool->hugepages)
+  {
+    munmap(chunk, pool->chunk_alloc_size);
+    return;
+  }
+#endif
+
+  xfree(chunk);
+}
+
 /** Helper: Allocate and return a new memory chunk for <b>pool</b>.  Does not
  * link the chunk into any list. */
 static mp_chunk_t *
 mp_chunk_new(mp_pool_t *pool)
 {
   size_t sz = pool->new_chunk_capacity * pool->item_alloc_size;
-  mp_chunk_t *chunk = xcalloc(CHUNK_OVERHEAD + sz);
+  mp_chunk_t *chunk = mp_chunk_alloc(pool);
 
-#ifdef MEMPOOL_STATS
+  ++pool->n_chunks;
   ++pool->total_chunks_allocated;
-#endif
   chunk->magic = MP_CHUNK_MAGIC;
   chunk->capacity = pool->new_chunk_capacity;
   chunk->mem_size = sz;
@@ -351,9 +413,10 @@ mp_pool_get(mp_pool_t *pool)
   }
 
   ++chunk->n_allocated;
-#ifdef MEMPOOL_STATS
   ++pool->total_items_allocated;
-#endif
+
+  if (++pool->n_items > pool->max_items)
+    pool->max_items = pool->n_items;
 
   if (chunk->n_allocated == chunk->capacity)
   {
@@ -393,6 +456,7 @@ mp_pool_release(void *item)
 
   allocated->u.next_free = chunk->first_free;
   chunk->first_free = allocated;
+  --chunk->pool->n_items;
 
   if (chunk->n_allocated == chunk->capacity)
   {
@@ -448,7 +512,7 @@ mp_pool_release(void *item)
 /** Allocate a new memory pool to hold items of size <b>item_size</b>. We'll
  * try to fit about <b>chunk_capacity</b> bytes in each chunk. */
 mp_pool_t *
-mp_pool_new(size_t item_size, size_t chunk_capacity)
+mp_pool_new(const char *name, size_t item_size, size_t chunk_capacity)
 {
   mp_pool_t *pool;
   size_t alloc_size, new_chunk_cap;
@@ -497,13 +561,27 @@ mp_pool_new(size_t item_size, size_t chunk_capacity)
   if (chunk_capacity < MIN_CHUNK)
     chunk_capacity = MIN_CHUNK;
 
+#ifdef MADV_HUGEPAGE
+  if (mp_pool_hugepages && chunk_capacity >= HUGEPAGE_MIN_CHUNK)
+  {
+    chunk_capacity = (chunk_capacity + HUGEPAGE_CHUNK - 1) & ~(size_t)(HUGEPAGE_CHUNK - 1);
+    pool->hugepages = 1;
+  }
+#endif
+
   new_chunk_cap = (chunk_capacity-CHUNK_OVERHEAD) / alloc_size;
   assert(new_chunk_cap < INT_MAX);
   pool->new_chunk_capacity = (int)new_chunk_cap;
 
+  pool->name = name;
   pool->item_size = item_size;
   pool->item_alloc_size = alloc_size;
 
+  if (pool->hugepages)
+    pool->chunk_alloc_size = chunk_capacity;
+  else
+    pool->chunk_alloc_size = CHUNK_OVERHEAD + new_chunk_cap * alloc_size;
+
   pool->next = mp_allocated_pools;
   mp_allocated_pools = pool;
 
@@ -515,55 +593,68 @@ mp_pool_new(size_t item_size, size_t chunk_capacity)
   return pool;
 }
 
-/** Helper function for qsort: used to sort pointers to mp_chunk_t into
- * descending order of fullness. */
-static int
-mp_pool_sort_used_chunks_helper(const void *_a, const void *_b)
-{
-  mp_chunk_t *a = *(mp_chunk_t * const *)_a;
-  mp_chunk_t *b = *(mp_chunk_t * const *)_b;
-  return b->n_allocated - a->n_allocated;
-}
-
-/** Sort the used chunks in <b>pool</b> into descending order of fullness,
- * so that we preferentially fill up mostly full chunks before we make
- * nearly empty chunks less nearly empty. */
+/** Move the used chunks in <b>pool</b> towards descending order of
+ * fullness, so that we preferentially fill up mostly full chunks before we
+ * make nearly empty chunks less nearly empty. This makes one bubble sort
+ * pass from the tail, which brings the fullest chunk to the front; the
+ * list is sorted over repeated calls rather than all at once. */
 static void
 mp_pool_sort_used_chunks(mp_pool_t *pool)
 {
-  int i, n = 0, inverted = 0;
-  mp_chunk_t **chunks, *chunk;
+  mp_chunk_t *chunk = pool->used_chunks;
 
-  for (chunk = pool->used_chunks; chunk; chunk = chunk->next)
-  {
-    ++n;
-    if (chunk->next && chunk->next->n_allocated > chunk->n_allocated)
-      ++inverted;
-  }
-
-  if (!inverted)
+  if (chunk == NULL)
     return;
 
-  chunks = xcalloc(sizeof(mp_chunk_t *) * n);
+  while (chunk->next)
+    chunk = chunk->next;
 
-  for (i = 0, chunk = pool->used_chunks; chunk; chunk = chunk->next)
-    chunks[i++] = chunk;
+  while (chunk->prev)
+  {
+    mp_chunk_t *prev = chunk->prev;
 
-  qsort(chunks, n, sizeof(mp_chunk_t *), mp_pool_sort_used_chunks_helper);
-  pool->used_chunks = chunks[0];
-  chunks[0]->prev = NULL;
+    if (chunk->n_allocated <= prev->n_allocated)
+    {
+      chunk = prev;
+      continue;
+    }
 
-  for (i = 1; i < n; ++i)
-  {
-    chunks[i - 1]->next = chunks[i];
-    chunks[i]->prev = chunks[i - 1];
+    /* Swap chunk and prev, and keep carrying chunk towards the front */
+    if (prev->prev)
+      prev->prev->next = chunk;
+    else
+      pool->used_chunks = chunk;
+    if (chunk->next)
+      chunk->next->prev = prev;
+
+    chunk->prev = prev->prev;
+    prev->next = chunk->next;
+    chunk->next = prev;
+    prev->prev = chunk;
   }
 
-  chunks[n - 1]->next = NULL;
-  xfree(chunks);
   mp_pool_assert_ok(pool);
 }
 
+/** Make sure <b>pool</b> has empty chunks for at least <b>n</b> items, so
+ * that many allocations in a row don't have to go to the allocator one
+ * chunk at a time. The chunks count as recently used, so the next
+ * garbage collection run leaves them alone. */
+void
+mp_pool_reserve(mp_pool_t *pool, size_t n)
+{
+  while ((size_t)pool->n_empty_chunks * pool->new_chunk_capacity < n)
+  {
+    mp_chunk_t *chunk = mp_chunk_new(pool);
+
+    chunk->next = pool->empty_chunks;
+    if (chunk->next)
+      chunk->next->prev = chunk;
+    pool->empty_chunks = chunk;
+    ++pool->n_empty_chunks;
+  }
+}
+
 /** If there are more than <b>n</b> empty chunks in <b>pool</b>, free the
  * excess ones that have been empty for the longest. If
  * <b>keep_recently_used</b> is true, do not free chunks unless they have been
@@ -606,11 +697,9 @@ mp_pool_clean(mp_pool_t *pool, int n_to_keep, int keep_recently_used)
   while (chunk)
   {
     mp_chunk_t *next = chunk->next;
-    chunk->magic = 0xdeadbeef;
-    xfree(chunk);
-#ifdef MEMPOOL_STATS
+    mp_chunk_free(pool, chunk);
     ++pool->total_chunks_freed;
-#endif
+    --pool->n_chunks;
     --pool->n_empty_chunks;
     chunk = next;
   }
@@ -692,11 +781,24 @@ mp_pool_assert_ok(mp_pool_t *pool)
   assert(pool->n_empty_chunks == n_empty);
 }
 
+/** Free empty chunks that haven't been used since the last run, at most
+ * GC_MAX_CHUNKS per pool; the rest are left for the following runs. */
 void
 mp_pool_garbage_collect(void *unused)
 {
   for (mp_pool_t *pool = mp_allocated_pools; pool; pool = pool->next)
-    mp_pool_clean(pool, 0, 1);
+  {
+    int n_to_keep = pool->n_empty_chunks - GC_MAX_CHUNKS;
+
+    mp_pool_clean(pool, n_to_keep > 0 ? n_to_keep : 0, 1);
+  }
+}
+
+/** Return the first of all pools, which are linked by mp_pool_t::next. */
+const mp_pool_t *
+mp_pool_get_list(void)
+{
+  return mp_allocated_pools;
 }
 
 /** Dump information about <b>pool</b>'s memory usage to the Tor log at level
@@ -749,12 +851,10 @@ mp_pool_log_status(mp_pool_t *pool)
        "for cell pools are full.",
        bytes_used, bytes_allocated);
 
-#ifdef MEMPOOL_STATS
   ilog(LOG_TYPE_DEBUG, "%ju cell allocations ever; "
        "%ju chunk allocations ever; "
        "%ju chunk frees ever.",
        pool->total_items_allocated,
        pool->total_chunks_allocated,
        pool->total_chunks_freed);
-#endif
 }
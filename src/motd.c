@@ -38,6 +38,7 @@
 #include "motd.h"
 #include "hostmask.h"
 #include "misc.h"
+#include "cursor.h"
 
 
 /** Global list of messages of the day. */
@@ -169,8 +170,22 @@ motd_cache(struct Motd *motd)
   return motd->cache;
 }
 
+/*! \brief Free a MotdCache that is neither referenced nor being sent.
+ * \param cache MotdCache to free.
+ */
+static void
+motd_cache_free(struct MotdCache *cache)
+{
+  if (cache->ref || cache->sending)
+    return;
+
+  xfree(cache->path);  /* Free path info */
+  xfree(cache);  /* Very simple for a reason */
+}
+
 /*! \brief Clear and dereference the Motd::cache element of \a motd.
- * If the MotdCache::ref count goes to zero, free it.
+ * If the MotdCache::ref count goes to zero, unlink it; it is freed once
+ * no cursor is sending it anymore.
  * \param motd MOTD to uncache.
  */
 static void
@@ -188,8 +203,7 @@ motd_decache(struct Motd *motd)
   if (--cache->ref == 0)  /* Reduce reference count */
   {
     dlinkDelete(&cache->node, &MotdList.cachelist);
-    xfree(cache->path);  /* Free path info */
-    xfree(cache);  /* Very simple for a reason */
+    motd_cache_free(cache);
   }
 }
 
@@ -263,13 +277,54 @@ motd_lookup(const struct Client *client_p)
   return MotdList.local;  /* Ok, return the default motd */
 }
 
+/*! \brief Send the next line of a MOTD to a user.
+ * \param client_p Client to send MOTD to.
+ * \param cursor Its cursor; Cursor::index is the line to send next.
+ * \return 0 once the MOTD is complete, 1 otherwise
+ */
+static int
+motd_step(struct Client *client_p, struct Cursor *cursor)
+{
+  const struct MotdCache *const cache = cursor->data;
+
+  if (cursor->index == 0)
+    sendto_one_numeric(client_p, &me, RPL_MOTDSTART, me.name);
+  else if (cursor->index <= cache->count)
+    sendto_one_numeric(client_p, &me, RPL_MOTD, cache->motd[cursor->index - 1]);
+  else
+  {
+    sendto_one_numeric(client_p, &me, RPL_ENDOFMOTD);
+    return 0;
+  }
+
+  ++cursor->index;
+  return 1;
+}
+
+static void
+motd_step_free(struct Cursor *cursor)
+{
+  struct MotdCache *const cache = cursor->data;
+
+  --cache->sending;
+  motd_cache_free(cache);
+}
+
+static const struct CursorType motd_cursor_type =
+{
+  .step = motd_step,
+  .free = motd_step_free
+};
+
 /*! \brief Send the content of a MotdCache to a user.
  * If \a cache is NULL, simply send ERR_NOMOTD to the client.
+ * The body is sent through a cursor, which holds on to the cache
+ * should the MOTD be recached meanwhile.
  * \param client_p Client to send MOTD to.
  * \param cache MOTD body to send to client.
  */
 static void
-motd_forward(struct Client *client_p, const struct MotdCache *cache)
+motd_forward(struct Client *client_p, struct MotdCache *cache)
 {
   if (!cache)  /* No motd to send */
   {
@@ -277,13 +332,8 @@ motd_forward(struct Client *client_p, const struct MotdCache *cache)
     return;
   }
 
-  /* Send the motd */
-  sendto_one_numeric(client_p, &me, RPL_MOTDSTART, me.name);
-
-  for (unsigned int i = 0; i < cache->count; ++i)
-    sendto_one_numeric(client_p, &me, RPL_MOTD, cache->motd[i]);
-
-  sendto_one_numeric(client_p, &me, RPL_ENDOFMOTD);
+  ++cache->sending;
+  cursor_start(client_p, &motd_cursor_type, NULL, cache);
 }
 
 /*! \brief Find the MOTD for a client and send it.
@@ -306,7 +356,7 @@ motd_send(struct Client *client_p)
 void
 motd_signon(struct Client *client_p)
 {
-  const struct MotdCache *cache = motd_cache(motd_lookup(client_p));
+  struct MotdCache *cache = motd_cache(motd_lookup(client_p));
 
   if (!ConfigGeneral.short_motd || !cache)
     motd_forward(client_p, cache);
@@ -38,6 +38,7 @@
 #include "memory.h"
 #include "send.h"
 #include "misc.h"
+#include "zip.h"
 
 
 enum { READBUF_SIZE = 16384 };
@@ -77,6 +78,10 @@ client_dopacket(struct Client *client_p, char *buffer, unsigned int length)
  *              - pointer to buffer to copy data to
  * output       - length of <buffer>
  * side effects - one line is copied and removed from the dbuf
+ *
+ * The end of the line is located with memchr() and the line is copied
+ * with memcpy(), a block at a time. This is what server links spend
+ * most of their time on while receiving a burst.
  */
 static unsigned int
 extract_one_line(struct dbuf_queue *qptr, char *buffer)
@@ -87,29 +92,41 @@ extract_one_line(struct dbuf_queue *qptr, char *buffer)
   DLINK_FOREACH(node, qptr->blocks.head)
   {
     const struct dbuf_block *block = node->data;
-    unsigned int idx;
+    const char *p = block->data, *const end = block->data + block->size;
 
     if (node == qptr->blocks.head)
-      idx = qptr->pos;
-    else
-      idx = 0;
+      p += qptr->pos;
 
-    for (; idx < block->size; ++idx)
+    if (eol_bytes == 0)
     {
-      char c = block->data[idx];
+      const char *eol = memchr(p, '\n', end - p);
+      const char *cr = memchr(p, '\r', (eol ? eol : end) - p);
+
+      if (cr)
+        eol = cr;
+      if (eol == NULL)
+        eol = end;
 
-      if (IsEol(c))
+      if (line_bytes < IRCD_BUFSIZE - 2)
       {
-        ++eol_bytes;
+        size_t len = IRCD_MIN((size_t)(eol - p), IRCD_BUFSIZE - 2 - line_bytes);
 
-        /* Allow 2 eol bytes per message */
-        if (eol_bytes == 2)
-          goto out;
+        memcpy(buffer, p, len);
+        buffer += len;
       }
-      else if (eol_bytes)
+
+      line_bytes += eol - p;
+      p = eol;
+    }
+
+    for (; p < end; ++p)
+    {
+      if (!IsEol(*p))
+        goto out;
+
+      /* Allow 2 eol bytes per message */
+      if (++eol_bytes == 2)
         goto out;
-      else if (line_bytes++ < IRCD_BUFSIZE - 2)
-        *buffer++ = c;
     }
   }
 
@@ -324,7 +341,13 @@ read_packet(fde_t *fd, void *data)
       return;
     }
 
-    dbuf_put(&client_p->connection->buf_recvq, readBuf, length);
+    if (client_p->connection->zip == NULL)
+      dbuf_put(&client_p->connection->buf_recvq, readBuf, length);
+    else if (!zip_inflate(client_p, readBuf, length))
+    {
+      exit_client(client_p, "Compression error");
+      return;
+    }
 
     if (client_p->connection->lasttime < CurrentTime)
       client_p->connection->lasttime = CurrentTime;
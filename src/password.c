@@ -0,0 +1,557 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file password.c
+ * \brief Asynchronous verification of encrypted passwords.
+ * \version $Id$
+ */
+
+/*
+ * crypt() with bcrypt or SHA-512 hashes takes milliseconds per call, and
+ * find_conf_by_address() may call it once for every auth {} block a
+ * client matches. Rather than stalling the event loop, uncached checks
+ * are handed to a small pool of threads using crypt_r(). Completions are
+ * signalled through a pipe; the main loop then records the verdict in a
+ * per-connection cache and resumes registration or re-parses the command
+ * that was waiting for it. Worker threads never touch anything but their
+ * job, so nothing else in the ircd needs to be thread safe.
+ *
+ * A client has at most one job at a time, so a client repeating OPER
+ * can't keep more than one worker busy. Verdicts are keyed by a SipHash
+ * digest of the encrypted and the plaintext password, never by the
+ * plaintext itself, and are forgotten once registration or OPER is done.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "conf.h"
+#include "fdlist.h"
+#include "irc_string.h"
+#include "log.h"
+#include "memory.h"
+#include "parse.h"
+#include "password.h"
+#include "s_bsd.h"
+#include "user.h"
+#include "rng_mt.h"
+
+#ifdef HAVE_CRYPT_R
+#include <pthread.h>
+#endif
+
+
+struct password_job
+{
+  dlink_node node;        /**< Node in the work or completion queue */
+  struct Client *client;  /**< Client waiting for us; NULL once it went away */
+  char *hash;             /**< Encrypted password of the conf item */
+  char *password;         /**< Plaintext password to check */
+  char *resume;           /**< Command to re-parse when done, NULL resumes registration */
+  uint64_t digest;        /**< password_digest() of hash and password */
+  int match;              /**< Result, written by the worker */
+};
+
+static struct password_stats password_stats;
+static struct Client *password_context;
+static int password_collect;
+static uint64_t password_key[2];
+
+#ifdef HAVE_CRYPT_R
+static pthread_mutex_t password_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t password_cond = PTHREAD_COND_INITIALIZER;
+static dlink_list password_work;  /* protected by password_lock */
+static dlink_list password_done;  /* protected by password_lock */
+static int password_pipe[2] = { -1, -1 };
+static fde_t password_fd;
+static unsigned int password_workers;
+#endif
+
+
+static int
+password_crypt(const char *password, const char *hash)
+{
+  const char *encr = crypt(password, hash);
+
+  return encr && !strcmp(encr, hash);
+}
+
+#define ROTL64(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+#define SIPROUND(v) \
+  do { \
+    v[0] += v[1]; v[1] = ROTL64(v[1], 13); v[1] ^= v[0]; v[0] = ROTL64(v[0], 32); \
+    v[2] += v[3]; v[3] = ROTL64(v[3], 16); v[3] ^= v[2]; \
+    v[0] += v[3]; v[3] = ROTL64(v[3], 21); v[3] ^= v[0]; \
+    v[2] += v[1]; v[1] = ROTL64(v[1], 17); v[1] ^= v[2]; v[2] = ROTL64(v[2], 32); \
+  } while (0)
+
+struct password_sip
+{
+  uint64_t v[4];
+  uint64_t m;
+  uint64_t len;
+};
+
+static void
+password_sip_block(struct password_sip *sip)
+{
+  sip->v[3] ^= sip->m;
+  SIPROUND(sip->v);
+  SIPROUND(sip->v);
+  sip->v[0] ^= sip->m;
+  sip->m = 0;
+}
+
+static void
+password_sip_update(struct password_sip *sip, const char *data, size_t len)
+{
+  for (const unsigned char *p = (const unsigned char *)data; len--; ++p)
+  {
+    sip->m |= (uint64_t)*p << (8 * (sip->len % 8));
+
+    if (++sip->len % 8 == 0)
+      password_sip_block(sip);
+  }
+}
+
+/* password_digest()
+ *
+ * inputs       - pointer to plaintext password
+ *              - pointer to encrypted password
+ * output       - SipHash-2-4 of both, keyed with a random key
+ * side effects - the key is picked on first use
+ */
+static uint64_t
+password_digest(const char *password, const char *hash)
+{
+  struct password_sip sip = { .m = 0, .len = 0 };
+
+  while (password_key[0] == 0 && password_key[1] == 0)
+  {
+    password_key[0] = (uint64_t)genrand_int32() << 32 | genrand_int32();
+    password_key[1] = (uint64_t)genrand_int32() << 32 | genrand_int32();
+  }
+
+  sip.v[0] = password_key[0] ^ UINT64_C(0x736f6d6570736575);
+  sip.v[1] = password_key[1] ^ UINT64_C(0x646f72616e646f6d);
+  sip.v[2] = password_key[0] ^ UINT64_C(0x6c7967656e657261);
+  sip.v[3] = password_key[1] ^ UINT64_C(0x7465646279746573);
+
+  /* The hash can't contain a NUL, so this separates both unambiguously */
+  password_sip_update(&sip, hash, strlen(hash) + 1);
+  password_sip_update(&sip, password, strlen(password));
+
+  sip.m |= sip.len << 56;
+  password_sip_block(&sip);
+
+  sip.v[2] ^= 0xff;
+  for (unsigned int i = 0; i < 4; ++i)
+    SIPROUND(sip.v);
+
+  return sip.v[0] ^ sip.v[1] ^ sip.v[2] ^ sip.v[3];
+}
+
+static const struct password_verdict *
+password_find(const struct Client *client, uint64_t digest)
+{
+  for (unsigned int i = 0; i < client->connection->password_count; ++i)
+    if (client->connection->passwords[i].digest == digest)
+      return &client->connection->passwords[i];
+
+  return NULL;
+}
+
+static int
+password_add(struct Client *client, uint64_t digest, int match)
+{
+  struct Connection *connection = client->connection;
+
+  /* When full, the check is simply repeated the next time it's needed */
+  if (connection->password_count < PASSWORD_VERDICTS)
+  {
+    connection->passwords[connection->password_count].digest = digest;
+    connection->passwords[connection->password_count].match = match;
+    ++connection->password_count;
+  }
+
+  return match;
+}
+
+/* password_lookup()
+ *
+ * inputs       - pointer to client
+ *              - pointer to plaintext password
+ *              - pointer to encrypted password
+ * output       - verdict, or -1 if unknown
+ * side effects - none
+ */
+static int
+password_lookup(struct Client *client, const char *password, const char *hash)
+{
+  const struct password_verdict *verdict =
+    password_find(client, password_digest(password, hash));
+
+  if (verdict == NULL)
+    return -1;
+
+  ++password_stats.hits;
+  return verdict->match;
+}
+
+/* password_sync()
+ *
+ * inputs       - pointer to client
+ *              - pointer to plaintext password
+ *              - pointer to encrypted password
+ * output       - 1 or 0 if match
+ * side effects - crypt() is called on the main loop and the verdict is cached
+ */
+static int
+password_sync(struct Client *client, const char *password, const char *hash)
+{
+  ++password_stats.synchronous;
+  return password_add(client, password_digest(password, hash),
+                      password_crypt(password, hash));
+}
+
+#ifdef HAVE_CRYPT_R
+static void
+password_job_free(struct password_job *job)
+{
+  xfree(job->hash);
+  xfree(job->password);
+  xfree(job->resume);
+  xfree(job);
+}
+
+static void *
+password_worker(void *data)
+{
+  struct crypt_data *cdata = data;
+
+  while (1)
+  {
+    struct password_job *job;
+    const char *encr;
+
+    pthread_mutex_lock(&password_lock);
+
+    while (password_work.head == NULL)
+      pthread_cond_wait(&password_cond, &password_lock);
+
+    job = password_work.head->data;
+    dlinkDelete(&job->node, &password_work);
+    pthread_mutex_unlock(&password_lock);
+
+    encr = crypt_r(job->password, job->hash, cdata);
+    job->match = encr && !strcmp(encr, job->hash);
+
+    pthread_mutex_lock(&password_lock);
+    dlinkAddTail(job, &job->node, &password_done);
+    pthread_mutex_unlock(&password_lock);
+
+    if (write(password_pipe[1], "", 1) == -1)
+    {
+      /* A full pipe already has a wakeup pending */
+    }
+  }
+
+  return NULL;
+}
+
+static void
+password_complete(struct password_job *job)
+{
+  struct Client *client = job->client;
+
+  --password_stats.pending;
+
+  if (client == NULL)
+  {
+    password_job_free(job);
+    return;
+  }
+
+  client->connection->password_job = NULL;
+  password_add(client, job->digest, job->match);
+
+  if (job->resume)
+    parse(client, job->resume, job->resume + strlen(job->resume));
+  else if (IsUnknown(client) && !client->connection->registration)
+    register_local_user(client);
+
+  password_job_free(job);
+}
+
+static void
+password_read(fde_t *F, void *data)
+{
+  char buf[128];
+  dlink_list done;
+  dlink_node *node, *node_next;
+
+  while (read(F->fd, buf, sizeof(buf)) > 0)
+    ;
+
+  pthread_mutex_lock(&password_lock);
+  done = password_done;
+  memset(&password_done, 0, sizeof(password_done));
+  pthread_mutex_unlock(&password_lock);
+
+  DLINK_FOREACH_SAFE(node, node_next, done.head)
+  {
+    struct password_job *job = node->data;
+
+    dlinkDelete(&job->node, &done);
+    password_complete(job);
+  }
+
+  comm_setselect(F, COMM_SELECT_READ, password_read, NULL, 0);
+}
+
+/* password_start()
+ *
+ * inputs       - none
+ * output       - 1 if the worker threads are running
+ * side effects - completion pipe is opened and the workers are started
+ */
+static int
+password_start(void)
+{
+  sigset_t set, oldset;
+
+  if (password_workers)
+    return 1;
+
+  if (password_fd.flags.open)
+    return 0;  /* Failed before, don't keep trying */
+
+  if (pipe(password_pipe) == -1)
+  {
+    ilog(LOG_TYPE_IRCD, "Unable to create password completion pipe: %s",
+         strerror(errno));
+    return 0;
+  }
+
+  fcntl(password_pipe[0], F_SETFL, O_NONBLOCK);
+  fcntl(password_pipe[1], F_SETFL, O_NONBLOCK);
+  fd_open(&password_fd, password_pipe[0], 0, "Password completion pipe");
+  comm_setselect(&password_fd, COMM_SELECT_READ, password_read, NULL, 0);
+
+  /* Signals are for the main loop only */
+  sigfillset(&set);
+  pthread_sigmask(SIG_SETMASK, &set, &oldset);
+
+  for (unsigned int i = 0; i < PASSWORD_WORKERS; ++i)
+  {
+    pthread_t thread;
+    struct crypt_data *cdata = xcalloc(sizeof(*cdata));
+
+    if (pthread_create(&thread, NULL, password_worker, cdata))
+    {
+      xfree(cdata);
+      break;
+    }
+
+    pthread_detach(thread);
+    ++password_workers;
+  }
+
+  pthread_sigmask(SIG_SETMASK, &oldset, NULL);
+
+  if (password_workers == 0)
+    ilog(LOG_TYPE_IRCD, "Unable to start password worker threads, "
+         "checking passwords synchronously");
+  return password_workers != 0;
+}
+
+/* password_queue()
+ *
+ * inputs       - pointer to client
+ *              - pointer to plaintext password
+ *              - pointer to encrypted password
+ *              - command to re-parse once done, or NULL
+ * output       - 1 if the check was queued or has to wait for the client's
+ *                current one, 0 if it can't be queued
+ * side effects - a job is handed to the worker threads. While a client
+ *                has a job, registration waits for it and commands that
+ *                would need another one are dropped, including repeats.
+ */
+static int
+password_queue(struct Client *client, const char *password, const char *hash,
+               const char *resume)
+{
+  struct password_job *job;
+
+  if (client->connection->password_job)
+  {
+    ++password_stats.busy;
+    return 1;
+  }
+
+  /* No room to remember the verdict; check synchronously instead */
+  if (client->connection->password_count >= PASSWORD_VERDICTS)
+    return 0;
+
+  if (!password_start())
+    return 0;
+
+  job = xcalloc(sizeof(*job));
+  job->client = client;
+  job->hash = xstrdup(hash);
+  job->password = xstrdup(password);
+  job->digest = password_digest(password, hash);
+  if (resume)
+    job->resume = xstrdup(resume);
+
+  client->connection->password_job = job;
+
+  ++password_stats.queued;
+  ++password_stats.pending;
+
+  pthread_mutex_lock(&password_lock);
+  dlinkAddTail(job, &job->node, &password_work);
+  pthread_cond_signal(&password_cond);
+  pthread_mutex_unlock(&password_lock);
+
+  return 1;
+}
+#endif
+
+const struct password_stats *
+password_get_stats(void)
+{
+  return &password_stats;
+}
+
+/* password_set_context()
+ *
+ * inputs       - pointer to client whose verdicts password_check() uses,
+ *                or NULL
+ *              - if set, uncached checks are queued and fail for now
+ * output       - none
+ * side effects - none
+ */
+void
+password_set_context(struct Client *client, int collect)
+{
+  password_context = client;
+  password_collect = collect;
+}
+
+/* password_check()
+ *
+ * inputs       - pointer to plaintext password
+ *              - pointer to encrypted password
+ * output       - 1 or 0 if match
+ * side effects - see password_set_context()
+ */
+int
+password_check(const char *password, const char *hash)
+{
+  int match;
+
+  if (password_context == NULL)
+  {
+    ++password_stats.synchronous;
+    return password_crypt(password, hash);
+  }
+
+  if ((match = password_lookup(password_context, password, hash)) != -1)
+    return match;
+
+#ifdef HAVE_CRYPT_R
+  if (password_collect && password_queue(password_context, password, hash, NULL))
+    return 0;
+#endif
+
+  return password_sync(password_context, password, hash);
+}
+
+/* password_verify()
+ *
+ * inputs       - pointer to client
+ *              - pointer to plaintext password
+ *              - pointer to conf item
+ *              - command to re-parse once the verdict is known, or NULL
+ *                to check synchronously if it isn't cached yet
+ * output       - PASSWORD_MATCH, PASSWORD_MISMATCH or PASSWORD_PENDING
+ * side effects - see password_queue()
+ */
+enum password_result
+password_verify(struct Client *client, const char *password,
+                const struct MaskItem *conf, const char *resume)
+{
+  int match;
+
+  if (EmptyString(password) || EmptyString(conf->passwd))
+    return PASSWORD_MISMATCH;
+
+  if (!(conf->flags & CONF_FLAGS_ENCRYPTED))
+    return strcmp(password, conf->passwd) ? PASSWORD_MISMATCH : PASSWORD_MATCH;
+
+  if ((match = password_lookup(client, password, conf->passwd)) == -1)
+  {
+#ifdef HAVE_CRYPT_R
+    if (resume && password_queue(client, password, conf->passwd, resume))
+      return PASSWORD_PENDING;
+#endif
+    match = password_sync(client, password, conf->passwd);
+  }
+
+  return match ? PASSWORD_MATCH : PASSWORD_MISMATCH;
+}
+
+/* password_forget()
+ *
+ * inputs       - pointer to client
+ * output       - none
+ * side effects - cached verdicts are dropped, called once registration
+ *                or OPER has used them
+ */
+void
+password_forget(struct Client *client)
+{
+  memset(client->connection->passwords, 0, sizeof(client->connection->passwords));
+  client->connection->password_count = 0;
+}
+
+/* password_free()
+ *
+ * inputs       - pointer to exiting client
+ * output       - none
+ * side effects - an outstanding job is orphaned and the verdicts are dropped
+ */
+void
+password_free(struct Client *client)
+{
+#ifdef HAVE_CRYPT_R
+  struct password_job *job = client->connection->password_job;
+
+  if (job)
+  {
+    job->client = NULL;
+    client->connection->password_job = NULL;
+  }
+#endif
+
+  password_forget(client);
+}
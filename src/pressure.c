@@ -0,0 +1,244 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file pressure.c
+ * \brief Global budget for send and receive queue memory.
+ * \version $Id$
+ */
+
+/*
+ * Class limits keep a single connection from queueing too much, but many
+ * connections within their limits, such as the members of a busy channel
+ * on slow links, can together queue more than the machine has. The
+ * memory used by dbufs is therefore checked against general::memory_budget
+ * once every io_loop() pass. Above the soft watermark replies sent
+ * through cursors, such as LIST, are held back and new connections are
+ * warned. Above the hard watermark new connections are refused,
+ * unregistered ones are closed, and the non-oper clients with the
+ * largest sendqs are dropped until usage is back under the soft
+ * watermark.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "conf.h"
+#include "dbuf.h"
+#include "ircd.h"
+#include "pressure.h"
+#include "send.h"
+
+
+static struct pressure_stats pressure_stats;
+
+
+size_t
+pressure_budget(void)
+{
+  return (size_t)ConfigGeneral.memory_budget * 1024 * 1024;
+}
+
+size_t
+pressure_watermark(enum pressure_level level)
+{
+  switch (level)
+  {
+    case PRESSURE_SOFT:
+      return pressure_budget() / 100 * PRESSURE_SOFT_PERCENT;
+    case PRESSURE_HARD:
+      return pressure_budget() / 100 * PRESSURE_HARD_PERCENT;
+    default:
+      return 0;
+  }
+}
+
+/* pressure_shed_unknowns()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - all connections that haven't registered yet are closed
+ */
+static void
+pressure_shed_unknowns(void)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, unknown_list.head)
+  {
+    struct Client *client_p = node->data;
+
+    if (!IsUnknown(client_p) || IsDead(client_p))
+      continue;
+
+    ++pressure_stats.shed;
+    exit_client(client_p, "Server under memory pressure");
+  }
+}
+
+/* pressure_drop_clients()
+ *
+ * inputs       - dbuf memory to get down to
+ * output       - NONE
+ * side effects - up to PRESSURE_DROP_MAX non-oper clients with the
+ *                largest sendqs are dropped, largest first
+ */
+static void
+pressure_drop_clients(size_t target)
+{
+  struct Client *victim[PRESSURE_DROP_MAX];
+  size_t length[PRESSURE_DROP_MAX];
+  unsigned int count = 0;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, local_client_list.head)
+  {
+    struct Client *client_p = node->data;
+    size_t len;
+    unsigned int i;
+
+    if (IsDead(client_p) || HasUMode(client_p, UMODE_OPER))
+      continue;
+
+    if ((len = sendq_length(client_p->connection)) < PRESSURE_SENDQ_MIN)
+      continue;
+
+    if (count == PRESSURE_DROP_MAX && len <= length[count - 1])
+      continue;
+
+    /* Keep victim[] sorted by descending sendq length */
+    if (count < PRESSURE_DROP_MAX)
+      ++count;
+
+    for (i = count - 1; i > 0 && length[i - 1] < len; --i)
+    {
+      victim[i] = victim[i - 1];
+      length[i] = length[i - 1];
+    }
+
+    victim[i] = client_p;
+    length[i] = len;
+  }
+
+  for (unsigned int i = 0; i < count && dbuf_memory() > target; ++i)
+  {
+    ++pressure_stats.dropped;
+    pressure_stats.dropped_bytes += length[i];
+    exit_client(victim[i], "Server under memory pressure");
+  }
+}
+
+/* pressure_check()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - the pressure level is updated from the memory used by
+ *                dbufs, and load is shed above the hard watermark
+ */
+void
+pressure_check(void)
+{
+  static uintmax_t rate = 0;
+  enum pressure_level level = PRESSURE_NONE;
+
+  pressure_stats.memory = dbuf_memory();
+  if (pressure_stats.peak < pressure_stats.memory)
+    pressure_stats.peak = pressure_stats.memory;
+
+  if (pressure_budget())
+  {
+    if (pressure_stats.memory >= pressure_watermark(PRESSURE_HARD))
+      level = PRESSURE_HARD;
+    else if (pressure_stats.memory >= pressure_watermark(PRESSURE_SOFT))
+      level = PRESSURE_SOFT;
+  }
+
+  if (level >= PRESSURE_SOFT && pressure_stats.level < PRESSURE_SOFT)
+    ++pressure_stats.soft;
+
+  if (level == PRESSURE_HARD && pressure_stats.level < PRESSURE_HARD)
+  {
+    ++pressure_stats.hard;
+    sendto_realops_flags_ratelimited(&rate, "Queued data uses %zu of %zu bytes, shedding load",
+                                     pressure_stats.memory, pressure_budget());
+  }
+
+  pressure_stats.level = level;
+
+  if (level == PRESSURE_HARD)
+  {
+    pressure_shed_unknowns();
+    pressure_drop_clients(pressure_watermark(PRESSURE_SOFT));
+  }
+}
+
+/* pressure_defer()
+ *
+ * inputs       - NONE
+ * output       - 1 if cursors should wait, 0 otherwise
+ * side effects - NONE
+ */
+int
+pressure_defer(void)
+{
+  if (pressure_stats.level < PRESSURE_SOFT)
+    return 0;
+
+  ++pressure_stats.deferred;
+  return 1;
+}
+
+/* pressure_accept()
+ *
+ * inputs       - NONE
+ * output       - 1 if a new connection may be accepted, 0 otherwise
+ * side effects - NONE
+ */
+int
+pressure_accept(void)
+{
+  if (pressure_stats.level < PRESSURE_HARD)
+    return 1;
+
+  ++pressure_stats.refused;
+  return 0;
+}
+
+/* pressure_warn()
+ *
+ * inputs       - NONE
+ * output       - 1 if a new connection should be warned, 0 otherwise
+ * side effects - NONE
+ */
+int
+pressure_warn(void)
+{
+  if (pressure_stats.level < PRESSURE_SOFT)
+    return 0;
+
+  ++pressure_stats.warned;
+  return 1;
+}
+
+const struct pressure_stats *
+pressure_get_stats(void)
+{
+  return &pressure_stats;
+}
@@ -43,6 +43,8 @@
  * Apr 28, 2003 --cryogen and Dianora
  */
 
+#define _GNU_SOURCE  /* recvmmsg(), sendmmsg() */
+
 #include "stdinc.h"
 #include "list.h"
 #include "event.h"
@@ -64,6 +66,9 @@ static void res_readreply(fde_t *, void *);
 
 #define MAXPACKET      1024  /**< rfc says 512 but we expand names so ... */
 #define AR_TTL         600   /**< TTL in seconds for dns cache entries */
+#define AR_NEGATIVE_TTL 60   /**< TTL in seconds for failed lookups */
+
+enum { RES_HASH_SIZE = 0x1000 };
 
 /*
  * RFC 1104/1105 wasn't very helpful about what these fields
@@ -76,26 +81,212 @@ static void res_readreply(fde_t *, void *);
 #define RDLENGTH_SIZE     (size_t)2
 #define ANSWER_FIXED_SIZE (TYPE_SIZE + CLASS_SIZE + TTL_SIZE + RDLENGTH_SIZE)
 
+struct res_waiter
+{
+  dlink_node node;                           /**< Doubly linked list node. */
+  dns_callback_fnc callback;                 /**< Callback function on completion. */
+  void *callback_ctx;                        /**< Context pointer for callback. */
+};
+
 struct reslist
 {
   dlink_node node;                           /**< Doubly linked list node. */
+  dlink_node hnode;                          /**< Node in request_hash, for coalescing. */
+  unsigned int hashv;                        /**< Bucket in request_hash. */
   unsigned int id;                           /**< Request ID (from request header). */
   char type;                                 /**< Current request type. */
   char retries;                              /**< Retry counter */
   unsigned int sends;                        /**< Number of sends (>1 means resent). */
   uintmax_t sentat;                          /**< Timestamp we last sent this request. */
   uintmax_t timeout;                         /**< When this request times out. */
+  uintmax_t ttl;                             /**< Lowest TTL of the answer records. */
   struct irc_ssaddr addr;                    /**< Address for this request. */
   char name[RFC1035_MAX_DOMAIN_LENGTH + 1];  /**< Hostname for this request. */
   size_t namelength;                         /**< Actual hostname length. */
-  dns_callback_fnc callback;                 /**< Callback function on completion. */
-  void *callback_ctx;                        /**< Context pointer for callback. */
+  dlink_list waiters;                        /**< Callbacks waiting for the answer. */
 };
 
+/*
+ * A cached answer. PTR entries are looked up by addr and hold the name,
+ * A/AAAA entries are looked up by name and hold the addr. Negative
+ * entries remember that there was no answer at all.
+ */
+struct res_cache
+{
+  dlink_node node;                           /**< Node in cache_hash. */
+  dlink_node lru_node;                       /**< Node in cache_lru, most recently used first. */
+  unsigned int hashv;                        /**< Bucket in cache_hash. */
+  char type;                                 /**< T_PTR, T_A or T_AAAA. */
+  char negative;                             /**< Lookup failed. */
+  uintmax_t expires;                         /**< When this entry goes stale. */
+  struct irc_ssaddr addr;
+  char name[RFC1035_MAX_DOMAIN_LENGTH + 1];
+  size_t namelength;
+};
+
+#if defined(HAVE_RECVMMSG) || defined(HAVE_SENDMMSG)
+enum { RES_BATCH = 32 };  /**< Datagrams per recvmmsg()/sendmmsg() call */
+#endif
+
+#ifdef HAVE_SENDMMSG
+struct res_send_queue
+{
+  unsigned char buf[MAXPACKET];
+  unsigned int len;
+  unsigned int ns;  /**< Index into irc_nsaddr_list */
+};
+
+static struct res_send_queue send_queue[RES_BATCH];
+static unsigned int send_queue_length;
+#endif
+
 static fde_t ResolverFileDescriptor;
 static dlink_list request_list;
+static dlink_list request_hash[RES_HASH_SIZE];
+static struct reslist *request_id_table[0x10000];
+static dlink_list cache_hash[RES_HASH_SIZE];
+static dlink_list cache_lru;
 static mp_pool_t *dns_pool;
+static mp_pool_t *dns_waiter_pool;
+static mp_pool_t *dns_cache_pool;
+static unsigned int cache_hits, cache_misses, coalesced;
+
+
+/*
+ * res_hash - hash the key of a query; the address for PTR queries,
+ * the name otherwise.
+ */
+static unsigned int
+res_hash(int type, const struct irc_ssaddr *addr, const char *name)
+{
+  uint32_t hashv = 2166136261U ^ (unsigned int)type;
+
+  if (type == T_PTR)
+  {
+    const unsigned char *p;
+    size_t len;
+
+    if (addr->ss.ss_family == AF_INET6)
+    {
+      p = ((const struct sockaddr_in6 *)addr)->sin6_addr.s6_addr;
+      len = sizeof(struct in6_addr);
+    }
+    else
+    {
+      p = (const unsigned char *)&((const struct sockaddr_in *)addr)->sin_addr;
+      len = sizeof(struct in_addr);
+    }
+
+    while (len--)
+      hashv = (hashv ^ *p++) * 16777619U;
+  }
+  else
+    for (const char *p = name; *p; ++p)
+      hashv = (hashv ^ ToLower(*p)) * 16777619U;
+
+  return (hashv ^ (hashv >> 16)) & (RES_HASH_SIZE - 1);
+}
+
+/*
+ * res_key_match - compare the key of a query against a request or cache
+ * entry of the given type.
+ */
+static int
+res_key_match(int type, const struct irc_ssaddr *addr, const char *name,
+              int etype, const struct irc_ssaddr *eaddr, const char *ename)
+{
+  if (type != etype)
+    return 0;
+
+  if (type != T_PTR)
+    return !irccmp(name, ename);
 
+  if (addr->ss.ss_family != eaddr->ss.ss_family)
+    return 0;
+
+  if (addr->ss.ss_family == AF_INET6)
+    return !memcmp(&((const struct sockaddr_in6 *)addr)->sin6_addr,
+                   &((const struct sockaddr_in6 *)eaddr)->sin6_addr, sizeof(struct in6_addr));
+  return ((const struct sockaddr_in *)addr)->sin_addr.s_addr ==
+         ((const struct sockaddr_in *)eaddr)->sin_addr.s_addr;
+}
+
+/*
+ * cache_remove - drop an entry from the answer cache
+ */
+static void
+cache_remove(struct res_cache *entry)
+{
+  dlinkDelete(&entry->node, &cache_hash[entry->hashv]);
+  dlinkDelete(&entry->lru_node, &cache_lru);
+  mp_pool_release(entry);
+}
+
+/*
+ * cache_trim - evict least recently used entries above the configured size
+ */
+static void
+cache_trim(void)
+{
+  while (dlink_list_length(&cache_lru) > GlobalSetOptions.dns_cache_size)
+    cache_remove(cache_lru.tail->data);
+}
+
+/*
+ * cache_find - look up a fresh answer for a query
+ */
+static struct res_cache *
+cache_find(int type, const struct irc_ssaddr *addr, const char *name)
+{
+  dlink_node *node, *node_next;
+  const unsigned int hashv = res_hash(type, addr, name);
+
+  DLINK_FOREACH_SAFE(node, node_next, cache_hash[hashv].head)
+  {
+    struct res_cache *entry = node->data;
+
+    if (entry->expires <= CurrentTime)
+    {
+      cache_remove(entry);
+      continue;
+    }
+
+    if (res_key_match(type, addr, name, entry->type, &entry->addr, entry->name))
+    {
+      dlink_move_node(&entry->lru_node, &cache_lru, &cache_lru);
+      ++cache_hits;
+      return entry;
+    }
+  }
+
+  ++cache_misses;
+  return NULL;
+}
+
+/*
+ * cache_add - remember the answer (or the lack of one) to a request
+ */
+static void
+cache_add(const struct reslist *request, int negative)
+{
+  struct res_cache *entry;
+  uintmax_t ttl = negative ? AR_NEGATIVE_TTL : IRCD_MIN(request->ttl, AR_TTL);
+
+  if (GlobalSetOptions.dns_cache_size == 0 || ttl == 0)
+    return;
+
+  entry = mp_pool_get(dns_cache_pool);
+  entry->hashv = request->hashv;
+  entry->type = request->type;
+  entry->negative = negative;
+  entry->expires = CurrentTime + ttl;
+  memcpy(&entry->addr, &request->addr, sizeof(entry->addr));
+  entry->namelength = strlcpy(entry->name, request->name, sizeof(entry->name));
+
+  dlinkAdd(entry, &entry->node, &cache_hash[entry->hashv]);
+  dlinkAdd(entry, &entry->lru_node, &cache_lru);
+  cache_trim();
+}
 
 /*
  * rem_request - remove a request from the list.
@@ -105,10 +296,56 @@ static mp_pool_t *dns_pool;
 static void
 rem_request(struct reslist *request)
 {
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, request->waiters.head)
+  {
+    dlinkDelete(node, &request->waiters);
+    mp_pool_release(node->data);
+  }
+
+  if (request_id_table[request->id] == request)
+    request_id_table[request->id] = NULL;
+  if (request->hashv < RES_HASH_SIZE)
+    dlinkDelete(&request->hnode, &request_hash[request->hashv]);
+
   dlinkDelete(&request->node, &request_list);
   mp_pool_release(request);
 }
 
+/*
+ * add_waiter - register a callback interested in the answer to a request
+ */
+static void
+add_waiter(struct reslist *request, dns_callback_fnc callback, void *ctx)
+{
+  struct res_waiter *waiter = mp_pool_get(dns_waiter_pool);
+
+  waiter->callback = callback;
+  waiter->callback_ctx = ctx;
+  dlinkAddTail(waiter, &waiter->node, &request->waiters);
+}
+
+/*
+ * find_request - find an outstanding request for the same query, so
+ * concurrent lookups share one query.
+ */
+static struct reslist *
+find_request(int type, const struct irc_ssaddr *addr, const char *name)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, request_hash[res_hash(type, addr, name)].head)
+  {
+    struct reslist *request = node->data;
+
+    if (res_key_match(type, addr, name, request->type, &request->addr, request->name))
+      return request;
+  }
+
+  return NULL;
+}
+
 /*
  * make_request - Create a DNS request record for the server.
  */
@@ -120,13 +357,56 @@ make_request(dns_callback_fnc callback, void *ctx)
   request->sentat = CurrentTime;
   request->retries = 2;
   request->timeout = 4;  /* Start at 4 and exponential inc. */
-  request->callback = callback;
-  request->callback_ctx = ctx;
+  request->hashv = RES_HASH_SIZE;  /* Not hashed yet */
+  add_waiter(request, callback, ctx);
 
   dlinkAdd(request, &request->node, &request_list);
   return request;
 }
 
+/*
+ * hash_request - make a request available for coalescing; type and
+ * key must have been filled in
+ */
+static void
+hash_request(struct reslist *request)
+{
+  request->hashv = res_hash(request->type, &request->addr, request->name);
+  dlinkAdd(request, &request->hnode, &request_hash[request->hashv]);
+}
+
+/*
+ * finish_request - hand the result to everyone waiting for it and
+ * remove the request.
+ */
+static void
+finish_request(struct reslist *request, const struct irc_ssaddr *addr, const char *name, size_t namelength)
+{
+  dlink_node *node;
+
+  /* Later lookups for the same key go to the cache from now on */
+  if (request->hashv < RES_HASH_SIZE)
+  {
+    dlinkDelete(&request->hnode, &request_hash[request->hashv]);
+    request->hashv = RES_HASH_SIZE;
+  }
+
+  /*
+   * A callback may cancel other waiters through delete_resolver_queries(),
+   * so always restart from the head of the list.
+   */
+  while ((node = request->waiters.head))
+  {
+    struct res_waiter *waiter = node->data;
+
+    dlinkDelete(node, &request->waiters);
+    (*waiter->callback)(waiter->callback_ctx, addr, name, namelength);
+    mp_pool_release(waiter);
+  }
+
+  rem_request(request);
+}
+
 /*
  * int
  * res_ourserver(inp)
@@ -203,6 +483,7 @@ start_resolver(void)
 void
 restart_resolver(void)
 {
+  resolver_flush();
   fd_close(&ResolverFileDescriptor);
   start_resolver();
 }
@@ -219,9 +500,22 @@ delete_resolver_queries(const void *vptr)
   DLINK_FOREACH_SAFE(node, node_next, request_list.head)
   {
     struct reslist *request = node->data;
+    dlink_node *wnode, *wnode_next;
+
+    /*
+     * The query itself stays outstanding even if nobody waits for
+     * it anymore, so the answer still ends up in the cache.
+     */
+    DLINK_FOREACH_SAFE(wnode, wnode_next, request->waiters.head)
+    {
+      struct res_waiter *waiter = wnode->data;
 
-    if (request->callback_ctx == vptr)
-      rem_request(request);
+      if (waiter->callback_ctx == vptr)
+      {
+        dlinkDelete(wnode, &request->waiters);
+        mp_pool_release(waiter);
+      }
+    }
   }
 }
 
@@ -244,27 +538,74 @@ send_res_msg(const unsigned char *msg, int len, unsigned int rcount)
     max_queries = 1;
 
   for (unsigned int i = 0; i < max_queries; ++i)
+  {
+#ifdef HAVE_SENDMMSG
+    /* Queued up and sent by resolver_flush() at the end of the loop iteration */
+    if (send_queue_length == RES_BATCH)
+      resolver_flush();
+
+    memcpy(send_queue[send_queue_length].buf, msg, len);
+    send_queue[send_queue_length].len = len;
+    send_queue[send_queue_length].ns = i;
+    ++send_queue_length;
+#else
     sendto(ResolverFileDescriptor.fd, msg, len, 0,
            (struct sockaddr *)&irc_nsaddr_list[i], irc_nsaddr_list[i].ss_len);
+#endif
+  }
 }
 
 /*
- * find_id - find a dns request id (id is determined by dn_mkquery)
+ * resolver_flush - send all queries queued by send_res_msg() with as
+ * few system calls as possible.
  */
-static struct reslist *
-find_id(unsigned int id)
+void
+resolver_flush(void)
 {
-  dlink_node *node;
+#ifdef HAVE_SENDMMSG
+  struct iovec iov[RES_BATCH];
+  struct mmsghdr msg[RES_BATCH];
+  unsigned int sent = 0;
+
+  if (send_queue_length == 0)
+    return;
 
-  DLINK_FOREACH(node, request_list.head)
+  memset(msg, 0, sizeof(msg));
+
+  for (unsigned int i = 0; i < send_queue_length; ++i)
   {
-    struct reslist *request = node->data;
+    iov[i].iov_base = send_queue[i].buf;
+    iov[i].iov_len = send_queue[i].len;
+    msg[i].msg_hdr.msg_iov = &iov[i];
+    msg[i].msg_hdr.msg_iovlen = 1;
+    msg[i].msg_hdr.msg_name = &irc_nsaddr_list[send_queue[i].ns];
+    msg[i].msg_hdr.msg_namelen = irc_nsaddr_list[send_queue[i].ns].ss_len;
+  }
 
-    if (request->id == id)
-      return request;
+  /*
+   * Like with sendto(), a query that can't be sent is simply lost and
+   * will be retried by timeout_query_list().
+   */
+  while (sent < send_queue_length)
+  {
+    int rc = sendmmsg(ResolverFileDescriptor.fd, msg + sent, send_queue_length - sent, 0);
+
+    if (rc <= 0)
+      break;
+    sent += rc;
   }
 
-  return NULL;
+  send_queue_length = 0;
+#endif
+}
+
+/*
+ * find_id - find a dns request id (id is determined by dn_mkquery)
+ */
+static struct reslist *
+find_id(unsigned int id)
+{
+  return request_id_table[id & 0xFFFF];
 }
 
 /*
@@ -292,7 +633,11 @@ query_name(const char *name, int query_class, int type, struct reslist *request)
       header->id = (header->id + genrand_int32()) & 0xFFFF;
     while (find_id(header->id));
 
+    if (request_id_table[request->id] == request)
+      request_id_table[request->id] = NULL;
+
     request->id = header->id;
+    request_id_table[request->id] = request;
     ++request->sends;
 
     send_res_msg(buf, request_len, request->sends);
@@ -312,9 +657,17 @@ do_query_name(dns_callback_fnc callback, void *ctx, const char *name,
 
   if (!request)
   {
+    if ((request = find_request(type, NULL, host_name)))
+    {
+      ++coalesced;
+      add_waiter(request, callback, ctx);
+      return;
+    }
+
     request = make_request(callback, ctx);
     request->type = type;
     request->namelength = strlcpy(request->name, host_name, sizeof(request->name));
+    hash_request(request);
   }
 
   request->type = type;
@@ -368,9 +721,17 @@ do_query_number(dns_callback_fnc callback, void *ctx,
 
   if (!request)
   {
+    if ((request = find_request(T_PTR, addr, NULL)))
+    {
+      ++coalesced;
+      add_waiter(request, callback, ctx);
+      return;
+    }
+
     request = make_request(callback, ctx);
     request->type = T_PTR;
     memcpy(&request->addr, addr, sizeof(struct irc_ssaddr));
+    hash_request(request);
   }
 
   query_name(ipbuf, C_IN, T_PTR, request);
@@ -379,23 +740,75 @@ do_query_number(dns_callback_fnc callback, void *ctx,
 /*
  * gethost_byname_type - get host address from name
  *
+ * If the answer is cached, the callback is called before returning.
  */
 void
 gethost_byname_type(dns_callback_fnc callback, void *ctx, const char *name, int type)
 {
+  const struct res_cache *entry;
+
   assert(name);
+
+  if ((entry = cache_find(type, NULL, name)))
+  {
+    if (entry->negative)
+      (*callback)(ctx, NULL, NULL, 0);
+    else
+      (*callback)(ctx, &entry->addr, entry->name, entry->namelength);
+    return;
+  }
+
   do_query_name(callback, ctx, name, NULL, type);
 }
 
 /*
  * gethost_byaddr - get host name from address
+ *
+ * If the answer is cached, the forward lookup is started right away,
+ * which may in turn call the callback before returning.
  */
 void
 gethost_byaddr(dns_callback_fnc callback, void *ctx, const struct irc_ssaddr *addr)
 {
+  const struct res_cache *entry;
+
+  if ((entry = cache_find(T_PTR, addr, NULL)))
+  {
+    if (entry->negative)
+      (*callback)(ctx, NULL, NULL, 0);
+    else
+      gethost_byname_type(callback, ctx, entry->name,
+                          addr->ss.ss_family == AF_INET6 ? T_AAAA : T_A);
+    return;
+  }
+
   do_query_number(callback, ctx, addr, NULL);
 }
 
+/*
+ * resolver_count_memory - report answer cache usage
+ */
+void
+resolver_count_memory(unsigned int *const count, size_t *const memory,
+                      unsigned int *const hits, unsigned int *const misses,
+                      unsigned int *const shared)
+{
+  *count = dlink_list_length(&cache_lru);
+  *memory = *count * sizeof(struct res_cache);
+  *hits = cache_hits;
+  *misses = cache_misses;
+  *shared = coalesced;
+}
+
+/*
+ * resolver_cache_trim - apply a changed cache size
+ */
+void
+resolver_cache_trim(void)
+{
+  cache_trim();
+}
+
 static void
 resend_query(struct reslist *request)
 {
@@ -427,6 +840,8 @@ proc_answer(struct reslist *request, HEADER *header, unsigned char *buf, unsigne
   struct sockaddr_in *v4;      /* conversion */
   struct sockaddr_in6 *v6;
 
+  request->ttl = AR_TTL;
+
   for (; header->qdcount > 0; --header->qdcount)
   {
     if ((n = irc_dn_skipname(current, eob)) < 0)
@@ -462,6 +877,7 @@ proc_answer(struct reslist *request, HEADER *header, unsigned char *buf, unsigne
     type = irc_ns_get16(current);
     current += TYPE_SIZE;
     current += CLASS_SIZE;
+    request->ttl = IRCD_MIN(request->ttl, irc_ns_get32(current));
     current += TTL_SIZE;
     rd_length = irc_ns_get16(current);
     current += RDLENGTH_SIZE;
@@ -524,101 +940,151 @@ proc_answer(struct reslist *request, HEADER *header, unsigned char *buf, unsigne
 }
 
 /*
- * res_readreply - read a dns reply from the nameserver and process it.
+ * res_process_reply - process a single datagram received on the
+ * resolver socket.
  */
 static void
-res_readreply(fde_t *fd, void *data)
+res_process_reply(unsigned char *buf, size_t len, const struct irc_ssaddr *lsin)
 {
-  unsigned char buf[sizeof(HEADER) + MAXPACKET];
   struct reslist *request = NULL;
-  ssize_t rc = 0;
-  socklen_t len = sizeof(struct irc_ssaddr);
-  struct irc_ssaddr lsin;
 
-  while ((rc = recvfrom(fd->fd, buf, sizeof(buf), 0, (struct sockaddr *)&lsin, &len)) != -1)
-  {
-    if (rc <= (ssize_t)sizeof(HEADER))
-      continue;
+  if (len <= sizeof(HEADER))
+    return;
 
-    /*
-     * Check against possibly fake replies
-     */
-    if (!res_ourserver(&lsin))
-      continue;
+  /*
+   * Check against possibly fake replies
+   */
+  if (!res_ourserver(lsin))
+    return;
 
-    /*
-     * Convert DNS reply reader from Network byte order to CPU byte order.
-     */
-    HEADER *header = (HEADER *)buf;
-    header->ancount = ntohs(header->ancount);
-    header->qdcount = ntohs(header->qdcount);
-    header->nscount = ntohs(header->nscount);
-    header->arcount = ntohs(header->arcount);
+  /*
+   * Convert DNS reply reader from Network byte order to CPU byte order.
+   */
+  HEADER *header = (HEADER *)buf;
+  header->ancount = ntohs(header->ancount);
+  header->qdcount = ntohs(header->qdcount);
+  header->nscount = ntohs(header->nscount);
+  header->arcount = ntohs(header->arcount);
 
+  /*
+   * Response for an id which we have already received an answer for
+   * just ignore this response.
+   */
+  if ((request = find_id(header->id)) == NULL)
+    return;
+
+  if (header->rcode != NO_ERRORS || header->ancount == 0)
+  {
     /*
-     * Response for an id which we have already received an answer for
-     * just ignore this response.
+     * If a bad error was returned, stop here and don't send
+     * any more (no retries granted).
      */
-    if ((request = find_id(header->id)) == NULL)
-      continue;
+    if (header->rcode == NXDOMAIN || header->rcode == NO_ERRORS)
+      cache_add(request, 1);
+
+    finish_request(request, NULL, NULL, 0);
+    return;
+  }
 
-    if (header->rcode != NO_ERRORS || header->ancount == 0)
+  /*
+   * If this fails there was an error decoding the received packet.
+   * We only give it one shot. If it fails, just leave the client
+   * unresolved.
+   */
+  if (!proc_answer(request, header, buf, buf + len))
+  {
+    finish_request(request, NULL, NULL, 0);
+    return;
+  }
+
+  if (request->type == T_PTR)
+  {
+    dlink_node *node;
+
+    if (request->namelength == 0)
     {
       /*
-       * If a bad error was returned, stop here and don't send
-       * any more (no retries granted).
+       * Got a PTR response with no name, something bogus is happening
+       * don't bother trying again, the client address doesn't resolve
        */
-      (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-      rem_request(request);
-      continue;
+      finish_request(request, NULL, NULL, 0);
+      return;
     }
 
+    cache_add(request, 0);
+
     /*
-     * If this fails there was an error decoding the received packet.
-     * We only give it one shot. If it fails, just leave the client
-     * unresolved.
+     * Lookup the 'authoritative' name that we were given for the ip#.
+     * All waiters share the same forward query.
      */
-    if (!proc_answer(request, header, buf, buf + rc))
+    while ((node = request->waiters.head))
     {
-      (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-      rem_request(request);
-      continue;
-    }
+      struct res_waiter *waiter = node->data;
 
-    if (request->type == T_PTR)
-    {
-      if (request->namelength == 0)
-      {
-        /*
-         * Got a PTR response with no name, something bogus is happening
-         * don't bother trying again, the client address doesn't resolve
-         */
-        (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-        rem_request(request);
-        continue;
-      }
+      dlinkDelete(node, &request->waiters);
 
-      /*
-       * Lookup the 'authoritative' name that we were given for the ip#.
-       */
       if (request->addr.ss.ss_family == AF_INET6)
-        gethost_byname_type(request->callback, request->callback_ctx, request->name, T_AAAA);
+        gethost_byname_type(waiter->callback, waiter->callback_ctx, request->name, T_AAAA);
       else
-        gethost_byname_type(request->callback, request->callback_ctx, request->name, T_A);
+        gethost_byname_type(waiter->callback, waiter->callback_ctx, request->name, T_A);
 
-      rem_request(request);
+      mp_pool_release(waiter);
     }
-    else
+
+    rem_request(request);
+  }
+  else
+  {
+    /*
+     * Got a name and address response, client resolved
+     */
+    cache_add(request, 0);
+    finish_request(request, &request->addr, request->name, request->namelength);
+  }
+}
+
+/*
+ * res_readreply - read dns replies from the nameserver and process them.
+ */
+static void
+res_readreply(fde_t *fd, void *data)
+{
+#ifdef HAVE_RECVMMSG
+  static unsigned char buf[RES_BATCH][sizeof(HEADER) + MAXPACKET];
+  struct irc_ssaddr lsin[RES_BATCH];
+  struct iovec iov[RES_BATCH];
+  struct mmsghdr msg[RES_BATCH];
+  int count;
+
+  do
+  {
+    memset(msg, 0, sizeof(msg));
+
+    for (unsigned int i = 0; i < RES_BATCH; ++i)
     {
-      /*
-       * Got a name and address response, client resolved
-       */
-      (*request->callback)(request->callback_ctx, &request->addr, request->name, request->namelength);
-      rem_request(request);
+      iov[i].iov_base = buf[i];
+      iov[i].iov_len = sizeof(buf[i]);
+      msg[i].msg_hdr.msg_iov = &iov[i];
+      msg[i].msg_hdr.msg_iovlen = 1;
+      msg[i].msg_hdr.msg_name = &lsin[i];
+      msg[i].msg_hdr.msg_namelen = sizeof(lsin[i]);
     }
 
-    continue;
-  }
+    if ((count = recvmmsg(fd->fd, msg, RES_BATCH, 0, NULL)) == -1)
+      break;
+
+    for (int i = 0; i < count; ++i)
+      res_process_reply(buf[i], msg[i].msg_len, &lsin[i]);
+  } while (count == RES_BATCH);
+#else
+  unsigned char buf[sizeof(HEADER) + MAXPACKET];
+  ssize_t rc = 0;
+  socklen_t len = sizeof(struct irc_ssaddr);
+  struct irc_ssaddr lsin;
+
+  while ((rc = recvfrom(fd->fd, buf, sizeof(buf), 0, (struct sockaddr *)&lsin, &len)) != -1)
+    res_process_reply(buf, rc, &lsin);
+#endif
 
   comm_setselect(fd, COMM_SELECT_READ, res_readreply, NULL, 0);
 }
@@ -642,8 +1108,7 @@ timeout_query_list(void)
     {
       if (--request->retries <= 0)
       {
-        (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-        rem_request(request);
+        finish_request(request, NULL, NULL, 0);
         continue;
       }
       else
@@ -683,7 +1148,9 @@ resolver_init(void)
     .when = 1
   };
 
-  dns_pool = mp_pool_new(sizeof(struct reslist), MP_CHUNK_SIZE_DNS);
+  dns_pool = mp_pool_new("dns", sizeof(struct reslist), MP_CHUNK_SIZE_DNS);
+  dns_waiter_pool = mp_pool_new("dns waiter", sizeof(struct res_waiter), MP_CHUNK_SIZE_DNS);
+  dns_cache_pool = mp_pool_new("dns cache", sizeof(struct res_cache), MP_CHUNK_SIZE_DNS);
 
   start_resolver();
   event_add(&event_timeout_resolver, NULL);
@@ -48,6 +48,7 @@
 #include "send.h"
 #include "memory.h"
 #include "user.h"
+#include "zip.h"
 
 
 static const char *const comm_err_str[] =
@@ -157,6 +158,9 @@ close_connection(struct Client *client_p)
      * before COMM_SELECT_WRITE). Let's try, nothing to lose.. -adx
      */
     DelFlag(client_p, FLAGS_BLOCKED);
+
+    if (client_p->connection->zip)
+      zip_deflate(client_p, 1);
     send_queued_write(client_p);
   }
 
@@ -170,6 +174,7 @@ close_connection(struct Client *client_p)
   else if (IsServer(client_p))
   {
     dlink_node *node = NULL;
+    const int relink = server_relink(client_p);
 
     ++ServerStats.is_sv;
     ServerStats.is_sbs += client_p->connection->send.bytes;
@@ -187,7 +192,7 @@ close_connection(struct Client *client_p)
        * Reset next-connect cycle of all connect{} blocks that match
        * this servername.
        */
-      conf->until = CurrentTime + conf->class->con_freq;
+      conf->until = CurrentTime + (relink ? RELINK_DELAY : conf->class->con_freq);
     }
   }
   else
@@ -199,8 +204,9 @@ close_connection(struct Client *client_p)
   if (client_p->connection->fd.flags.open)
     fd_close(&client_p->connection->fd);
 
-  dbuf_clear(&client_p->connection->buf_sendq);
+  sendq_clear(client_p->connection);
   dbuf_clear(&client_p->connection->buf_recvq);
+  zip_free(client_p);
 
   xfree(client_p->connection->password);
   client_p->connection->password = NULL;
@@ -262,6 +268,7 @@ void
 add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
 {
   struct Client *client_p = make_client(NULL);
+  char sockhost[HOSTIPLEN + 2] = "0";
 
   fd_open(&client_p->connection->fd, fd, 1,
           (listener->flags & LISTENER_SSL) ?
@@ -274,8 +281,8 @@ add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
   memcpy(&client_p->connection->ip, irn, sizeof(struct irc_ssaddr));
 
   getnameinfo((const struct sockaddr *)&client_p->connection->ip,
-              client_p->connection->ip.ss_len, client_p->sockhost,
-              sizeof(client_p->sockhost), NULL, 0, NI_NUMERICHOST);
+              client_p->connection->ip.ss_len, sockhost + 1,
+              sizeof(sockhost) - 1, NULL, 0, NI_NUMERICHOST);
   client_p->connection->aftype = client_p->connection->ip.ss.ss_family;
 
 #ifdef HAVE_LIBGEOIP
@@ -293,15 +300,9 @@ add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
   }
 #endif
 
-  if (client_p->sockhost[0] == ':' && client_p->sockhost[1] == ':')
-  {
-    strlcpy(client_p->host, "0", sizeof(client_p->host));
-    strlcpy(client_p->host + 1, client_p->sockhost, sizeof(client_p->host) - 1);
-    memmove(client_p->sockhost + 1, client_p->sockhost, sizeof(client_p->sockhost) - 1);
-    client_p->sockhost[0] = '0';
-  }
-  else
-    strlcpy(client_p->host, client_p->sockhost, sizeof(client_p->host));
+  /* Addresses starting with "::" get the "0" that's already in place */
+  client_set_sockhost(client_p, (sockhost[1] == ':' && sockhost[2] == ':') ? sockhost : sockhost + 1);
+  client_set_host(client_p, client_p->sockhost);
 
   client_p->connection->listener = listener;
   ++listener->ref_count;
@@ -36,10 +36,27 @@
 #include "server.h"
 #include "conf_class.h"
 #include "log.h"
+#include "zip.h"
 
 
 static uintmax_t current_serial;
 
+/** Output to local clients held back while a batch is open */
+static struct
+{
+  unsigned int depth;     /**< Nesting of sendto_batch_begin() */
+  unsigned int framed;    /**< Whether it is an IRCv3 BATCH */
+  uintmax_t serial;       /**< Batch reference */
+  dlink_list clients;     /**< Clients with output held back */
+  char start[IRCD_BUFSIZE];
+  size_t start_len;
+  char tag[32];           /**< Message tag for clients with CAP_BATCH */
+  size_t tag_len;
+} batch;
+
+/** Client whose output goes to its bulk lane, see sendto_bulk_begin() */
+static struct Client *bulk_client;
+
 
 /* send_format()
  *
@@ -74,6 +91,55 @@ send_format(struct dbuf_block *buffer, const char *pattern, va_list args)
   buffer->data[buffer->size++] = '\n';
 }
 
+/*
+ ** send_render
+ **      Renders a message into a buffer of its own.
+ */
+static struct dbuf_block *
+send_render(const char *pattern, ...)
+{
+  va_list args;
+  struct dbuf_block *buffer = dbuf_alloc();
+
+  va_start(args, pattern);
+  send_format(buffer, pattern, args);
+  va_end(args);
+
+  return buffer;
+}
+
+/*
+ ** send_message_batch
+ **      Queues a buffer for a client while a batch is open.
+ */
+static void
+send_message_batch(struct Client *to, struct dbuf_block *buf)
+{
+  struct dbuf_queue *const sendq = &to->connection->buf_sendq;
+  const int framed = batch.framed && HasCap(to, CAP_BATCH);
+
+  if (!HasFlag(to, FLAGS_BATCH))
+  {
+    AddFlag(to, FLAGS_BATCH);
+    dlinkAdd(to, make_dlink_node(), &batch.clients);
+
+    if (framed)
+      dbuf_put(sendq, batch.start, batch.start_len);
+  }
+
+  if (framed)
+  {
+    dbuf_put(sendq, batch.tag, batch.tag_len);
+    dbuf_put(sendq, buf->data, buf->size);
+  }
+  else
+    dbuf_add(sendq, buf);
+
+  /* Don't let a long batch run the client into its sendq limit */
+  if (dbuf_length(sendq) > get_sendq(&to->connection->confs) / 2)
+    send_queued_write(to);
+}
+
 /*
  ** send_message
  **      Internal utility which appends given buffer to the sockets
@@ -86,13 +152,36 @@ send_message(struct Client *to, struct dbuf_block *buf)
   assert(to != &me);
   assert(MyConnect(to));
 
-  if (dbuf_length(&to->connection->buf_sendq) + buf->size > get_sendq(&to->connection->confs))
+  struct Connection *const conn = to->connection;
+  struct BurstTask *const bt = conn->burst_task;
+  struct dbuf_queue *queue = &conn->buf_sendq;
+  size_t sendq = zip_queued(to);
+
+  /*
+   * Bulk output goes to the bulk lane. On server links, anything queued
+   * behind the bulk lane stays there, as the peer needs it in order.
+   */
+  if (bt && bt->stage == BURST_CLIENTS)
+  {
+    /*
+     * It may come from or mention a client we haven't sent yet, so it
+     * waits until all of them are out
+     */
+    queue = &bt->held;
+    sendq += dbuf_length(&conn->buf_bulkq);
+  }
+  else if (bt || to == bulk_client || (IsServer(to) && dbuf_length(&conn->buf_bulkq)))
+    queue = &conn->buf_bulkq;
+
+  sendq += dbuf_length(queue);
+
+  if (sendq + buf->size > get_sendq(&conn->confs))
   {
     if (IsServer(to))
       sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
                            "Max SendQ limit exceeded for %s: %zu > %u",
                            get_client_name(to, HIDE_IP),
-                           (dbuf_length(&to->connection->buf_sendq) + buf->size),
+                           (sendq + buf->size),
                            get_sendq(&to->connection->confs));
 
     if (IsClient(to))
@@ -102,7 +191,10 @@ send_message(struct Client *to, struct dbuf_block *buf)
     return;
   }
 
-  dbuf_add(&to->connection->buf_sendq, buf);
+  if (queue == &conn->buf_sendq && batch.depth && IsClient(to))
+    send_message_batch(to, buf);
+  else
+    dbuf_add(queue, buf);
 
   /*
    * Update statistics. The following is slightly incorrect because
@@ -112,7 +204,131 @@ send_message(struct Client *to, struct dbuf_block *buf)
   ++to->connection->send.messages;
   ++me.connection->send.messages;
 
-  send_queued_write(to);
+  if (bt == NULL && !HasFlag(to, FLAGS_BATCH))
+    send_queued_write(to);
+}
+
+/* send_message_control()
+ *
+ * inputs       - pointer to client to send to
+ *              - pointer to buffer
+ * output       - NONE
+ * side effects - the buffer is queued in the control lane, which is
+ *                written ahead of everything else
+ */
+static void
+send_message_control(struct Client *to, struct dbuf_block *buf)
+{
+  struct dbuf_queue *const ctlq = &to->connection->buf_ctlq;
+
+  assert(MyConnect(to));
+
+  if (dbuf_length(ctlq) + buf->size > SENDQ_CONTROL_MAX)
+  {
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "Max SendQ limit exceeded for %s: %zu > %u",
+                         get_client_name(to, HIDE_IP),
+                         dbuf_length(ctlq) + buf->size, SENDQ_CONTROL_MAX);
+
+    dead_link_on_write(to, 0);
+    return;
+  }
+
+  dbuf_add(ctlq, buf);
+
+  ++to->connection->send.messages;
+  ++me.connection->send.messages;
+
+  if (!HasFlag(to, FLAGS_BATCH))
+    send_queued_write(to);
+}
+
+/* sendto_bulk_begin()
+ *
+ * inputs       - pointer to client
+ * output       - NONE
+ * side effects - until sendto_bulk_end(), what is sent to the client is
+ *                queued in its bulk lane, which yields to its other
+ *                traffic
+ */
+void
+sendto_bulk_begin(struct Client *to)
+{
+  assert(bulk_client == NULL);
+  assert(MyConnect(to));
+
+  bulk_client = to;
+}
+
+void
+sendto_bulk_end(void)
+{
+  bulk_client = NULL;
+}
+
+/* sendto_batch_begin()
+ *
+ * inputs       - batch type, or NULL
+ *              - batch parameters
+ * output       - NONE
+ * side effects - until sendto_batch_end(), what is sent to local clients
+ *                is queued, but not written. If a type is given, clients
+ *                that negotiated the batch capability get it wrapped
+ *                into a BATCH of that type.
+ */
+void
+sendto_batch_begin(const char *type, const char *params)
+{
+  if (batch.depth++)
+    return;
+
+  batch.framed = type != NULL;
+  if (!batch.framed)
+    return;
+
+  ++batch.serial;
+
+  batch.tag_len = snprintf(batch.tag, sizeof(batch.tag), "@batch=%ju ", batch.serial);
+  batch.start_len = snprintf(batch.start, sizeof(batch.start), ":%s BATCH +%ju %s %s\r\n",
+                             me.name, batch.serial, type, params);
+  if (batch.start_len >= sizeof(batch.start))
+    batch.start_len = sizeof(batch.start) - 1;
+}
+
+/* sendto_batch_end()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - closes the batch and writes out what was held back
+ */
+void
+sendto_batch_end(void)
+{
+  dlink_node *node, *node_next;
+  char end[IRCD_BUFSIZE];
+  int len;
+
+  assert(batch.depth);
+
+  if (--batch.depth)
+    return;
+
+  len = snprintf(end, sizeof(end), ":%s BATCH -%ju\r\n", me.name, batch.serial);
+
+  DLINK_FOREACH_SAFE(node, node_next, batch.clients.head)
+  {
+    struct Client *target_p = node->data;
+
+    DelFlag(target_p, FLAGS_BATCH);
+
+    if (batch.framed && HasCap(target_p, CAP_BATCH) && !IsDead(target_p))
+      dbuf_put(&target_p->connection->buf_sendq, end, len);
+
+    send_queued_write(target_p);
+
+    dlinkDelete(node, &batch.clients);
+    free_dlink_node(node);
+  }
 }
 
 /* send_message_remote()
@@ -158,6 +374,89 @@ sendq_unblocked(fde_t *fd, void *data)
   send_queued_write(client_p);
 }
 
+/* sendq_next()
+ *
+ * inputs       - pointer to connection
+ * output       - pointer to the lane to write from next, or NULL if
+ *                there's nothing to write
+ * side effects - the control lane goes first. The interactive lane gets
+ *                SENDQ_INTERACTIVE_WEIGHT blocks for every block of the
+ *                bulk lane while both have data. A line that was started
+ *                is always finished first.
+ */
+struct dbuf_queue *
+sendq_next(struct Connection *conn)
+{
+  if (conn->sendq_partial)
+    return conn->sendq_partial;
+
+  if (dbuf_length(&conn->buf_ctlq))
+    return &conn->buf_ctlq;
+
+  if (dbuf_length(&conn->buf_bulkq) == 0)
+    return dbuf_length(&conn->buf_sendq) ? &conn->buf_sendq : NULL;
+
+  if (dbuf_length(&conn->buf_sendq) && conn->sendq_turn < SENDQ_INTERACTIVE_WEIGHT)
+  {
+    ++conn->sendq_turn;
+    return &conn->buf_sendq;
+  }
+
+  conn->sendq_turn = 0;
+  return &conn->buf_bulkq;
+}
+
+/* sendq_consume()
+ *
+ * inputs       - pointer to connection
+ *              - pointer to lane returned by sendq_next()
+ *              - number of bytes taken from its first block
+ * output       - NONE
+ * side effects - the bytes are removed from the lane. If they ended in
+ *                the middle of a line, the lane is kept until the line
+ *                is complete.
+ */
+void
+sendq_consume(struct Connection *conn, struct dbuf_queue *queue, size_t len)
+{
+  const struct dbuf_block *first = queue->blocks.head->data;
+
+  if (first->data[queue->pos + len - 1] == '\n')
+    conn->sendq_partial = NULL;
+  else
+    conn->sendq_partial = queue;
+
+  dbuf_delete(queue, len);
+}
+
+/* sendq_length()
+ *
+ * inputs       - pointer to connection
+ * output       - number of bytes queued in all lanes
+ * side effects - none
+ */
+size_t
+sendq_length(const struct Connection *conn)
+{
+  return dbuf_length(&conn->buf_ctlq) + dbuf_length(&conn->buf_sendq) +
+         dbuf_length(&conn->buf_bulkq);
+}
+
+/* sendq_clear()
+ *
+ * inputs       - pointer to connection
+ * output       - NONE
+ * side effects - all lanes are emptied
+ */
+void
+sendq_clear(struct Connection *conn)
+{
+  dbuf_clear(&conn->buf_ctlq);
+  dbuf_clear(&conn->buf_sendq);
+  dbuf_clear(&conn->buf_bulkq);
+  conn->sendq_partial = NULL;
+}
+
 /*
  ** send_queued_write
  **      This is called when there is a chance that some output would
@@ -169,6 +468,7 @@ send_queued_write(struct Client *to)
 {
   int retlen = 0;
   int want_read = 0;
+  struct dbuf_queue *queue = NULL;
 
   /*
    ** Once socket is marked dead, we cannot start writing to it,
@@ -177,34 +477,52 @@ send_queued_write(struct Client *to)
   if (IsDead(to) || HasFlag(to, FLAGS_BLOCKED))
     return;  /* no use calling send() now */
 
+  /*
+   * Compressed links write what the compressor produced, others pick
+   * the lane to write from block by block.
+   */
+  if (to->connection->zip)
+    queue = zip_deflate(to, 0);
+  else
+    queue = sendq_next(to->connection);
+
   /* Next, lets try to write some data */
-  if (dbuf_length(&to->connection->buf_sendq))
+  if (queue && dbuf_length(queue))
   {
     do
     {
-      const struct dbuf_block *first = to->connection->buf_sendq.blocks.head->data;
+      const struct dbuf_block *first = queue->blocks.head->data;
 
       if (tls_isusing(&to->connection->fd.ssl))
       {
-        retlen = tls_write(&to->connection->fd.ssl, first->data + to->connection->buf_sendq.pos,
-                                                    first->size - to->connection->buf_sendq.pos, &want_read);
+        retlen = tls_write(&to->connection->fd.ssl, first->data + queue->pos,
+                                                    first->size - queue->pos, &want_read);
 
         if (want_read)
           return;  /* Retry later, don't register for write events */
       }
       else
-        retlen = send(to->connection->fd.fd, first->data + to->connection->buf_sendq.pos,
-                                             first->size - to->connection->buf_sendq.pos, 0);
+        retlen = send(to->connection->fd.fd, first->data + queue->pos,
+                                             first->size - queue->pos, 0);
 
       if (retlen <= 0)
         break;
 
-      dbuf_delete(&to->connection->buf_sendq, retlen);
-
       /* We have some data written .. update counters */
       to->connection->send.bytes += retlen;
       me.connection->send.bytes += retlen;
-    } while (dbuf_length(&to->connection->buf_sendq));
+
+      if (to->connection->zip)
+      {
+        dbuf_delete(queue, retlen);
+        queue = zip_deflate(to, 0);
+      }
+      else
+      {
+        sendq_consume(to->connection, queue, retlen);
+        queue = sendq_next(to->connection);
+      }
+    } while (queue && dbuf_length(queue));
 
     if (retlen < 0 && ignoreErrno(errno))
     {
@@ -279,6 +597,72 @@ sendto_one(struct Client *to, const char *pattern, ...)
   dbuf_ref_free(buffer);
 }
 
+/* sendto_one_control()
+ *
+ * inputs       - pointer to destination client
+ *              - var args message
+ * output       - NONE
+ * side effects - like sendto_one(), but on server links the message
+ *                overtakes anything else queued. Meant for PING and PONG;
+ *                clients get them in order, as they time replies by them.
+ */
+void
+sendto_one_control(struct Client *to, const char *pattern, ...)
+{
+  va_list args;
+  struct dbuf_block *buffer = NULL;
+
+  if (IsDead(to->from))
+    return;  /* This socket has already been marked as dead */
+
+  buffer = dbuf_alloc();
+
+  va_start(args, pattern);
+  send_format(buffer, pattern, args);
+  va_end(args);
+
+  if (IsServer(to->from))
+    send_message_control(to->from, buffer);
+  else
+    send_message(to->from, buffer);
+
+  dbuf_ref_free(buffer);
+}
+
+/* sendto_burst()
+ *
+ * inputs       - pointer to server being bursted to
+ *              - var args message
+ * output       - NONE
+ * side effects - the line is packed into the bulk lane behind the
+ *                previous one; it is up to the burst to write it out
+ */
+void
+sendto_burst(struct Client *to, const char *pattern, ...)
+{
+  char buf[IRCD_BUFSIZE];
+  va_list args;
+  int len;
+
+  if (IsDead(to))
+    return;  /* This socket has already been marked as dead */
+
+  va_start(args, pattern);
+  len = vsnprintf(buf, sizeof(buf), pattern, args);
+  va_end(args);
+
+  if (len > IRCD_BUFSIZE - 2)
+    len = IRCD_BUFSIZE - 2;
+
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  dbuf_put(&to->connection->buf_bulkq, buf, len);
+
+  ++to->connection->send.messages;
+  ++me.connection->send.messages;
+}
+
 void
 sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numerics numeric, ...)
 {
@@ -569,6 +953,67 @@ sendto_channel_local(const struct Client *one, struct Channel *chptr, unsigned i
   dbuf_ref_free(buffer);
 }
 
+/*! \brief Send the JOINs of remote users just added to a channel to its
+ *         local members. Every JOIN is rendered once per capability
+ *         variant, and the members are walked once for a chunk of users.
+ * \param chptr   Channel the users joined
+ * \param joined  Users that joined
+ * \param count   Number of users in joined
+ */
+void
+sendto_channel_local_joins(struct Channel *chptr, struct Client *const joined[], unsigned int count)
+{
+  enum { JOIN_CHUNK = 64 };
+  struct dbuf_block *ext[JOIN_CHUNK], *plain[JOIN_CHUNK], *away[JOIN_CHUNK];
+  dlink_node *node = NULL;
+
+  for (unsigned int start = 0; start < count; start += JOIN_CHUNK)
+  {
+    const unsigned int n = count - start < JOIN_CHUNK ? count - start : JOIN_CHUNK;
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      const struct Client *const source_p = joined[start + i];
+
+      ext[i] = send_render(":%s!%s@%s JOIN %s %s :%s",
+                           source_p->name, source_p->username, source_p->host,
+                           chptr->name, source_p->account, source_p->info);
+      plain[i] = send_render(":%s!%s@%s JOIN :%s",
+                             source_p->name, source_p->username, source_p->host,
+                             chptr->name);
+      away[i] = NULL;
+
+      if (source_p->away[0])
+        away[i] = send_render(":%s!%s@%s AWAY :%s",
+                              source_p->name, source_p->username, source_p->host,
+                              source_p->away);
+    }
+
+    DLINK_FOREACH(node, chptr->locmembers.head)
+    {
+      struct Membership *member = node->data;
+      struct Client *target_p = member->client_p;
+
+      for (unsigned int i = 0; i < n && !IsDefunct(target_p); ++i)
+      {
+        send_message(target_p, HasCap(target_p, CAP_EXTENDED_JOIN) ? ext[i] : plain[i]);
+
+        if (away[i] && HasCap(target_p, CAP_AWAY_NOTIFY))
+          send_message(target_p, away[i]);
+      }
+    }
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      dbuf_ref_free(ext[i]);
+      dbuf_ref_free(plain[i]);
+
+      if (away[i])
+        dbuf_ref_free(away[i]);
+    }
+  }
+}
+
 /*
  ** match_it() and sendto_match_butone() ARE only used
  ** to send a msg to all ppl on servers/hosts that match a specified mask
@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "channel.h"
 #include "event.h"
 #include "hash.h"
 #include "irc_string.h"
@@ -40,12 +41,39 @@
 #include "send.h"
 #include "memory.h"
 #include "parse.h"
+#include "user.h"
+#include "zip.h"
 
 
 dlink_list flatten_links;
 static dlink_list server_capabilities_list;
 static void serv_connect_callback(fde_t *, int, void *);
 
+/*
+ * Wildcard targets of hunt_server() are resolved once per direction and
+ * cached. A match is looked up by its ID again and checked before it is
+ * used. A server match stays good as long as it still matches. A client
+ * match only stays good until a server is added, since servers are
+ * preferred. No match stays good until any name is added.
+ */
+enum { HUNT_CACHE_SIZE = 256 };
+
+static struct HuntCache
+{
+  char mask[HOSTLEN + 1];
+  const struct Client *from;  /**< Link the request came in from */
+  char id[IDLEN + 1];         /**< ID of the match; empty if nothing matched */
+  uintmax_t generation;       /**< hash_get_generation() at the time */
+} hunt_cache[HUNT_CACHE_SIZE];
+
+static struct event event_relink =
+{
+  .name = "relink",
+  .handler = try_connections,
+  .when = RELINK_DELAY,
+  .oneshot = 1
+};
+
 
 /*
  * write_links_file
@@ -139,6 +167,104 @@ read_links_file(void)
   fclose(file);
 }
 
+/* hunt_server_match()
+ *
+ * inputs       - pointer to source of the request
+ *              - wildcard mask
+ * output       - pointer to the first server, or else client, that
+ *                matches the mask and isn't in the direction the
+ *                request came from, or NULL
+ * side effects - none
+ */
+static struct Client *
+hunt_server_match(const struct Client *source_p, const char *mask)
+{
+  dlink_node *node = NULL;
+
+  DLINK_FOREACH(node, global_server_list.head)
+  {
+    struct Client *tmp = node->data;
+
+    assert(IsMe(tmp) || IsServer(tmp));
+    if (!match(mask, tmp->name))
+    {
+      if (tmp->from == source_p->from && !MyConnect(tmp))
+        continue;
+
+      return tmp;
+    }
+  }
+
+  DLINK_FOREACH(node, global_client_list.head)
+  {
+    struct Client *tmp = node->data;
+
+    assert(IsMe(tmp) || IsServer(tmp) || IsClient(tmp));
+    if (!match(mask, tmp->name))
+    {
+      if (tmp->from == source_p->from && !MyConnect(tmp))
+        continue;
+
+      return tmp;
+    }
+  }
+
+  return NULL;
+}
+
+/* hunt_server_glob()
+ *
+ * inputs       - pointer to source of the request
+ *              - wildcard mask
+ * output       - same as hunt_server_match()
+ * side effects - the result is taken from, or put into, hunt_cache
+ */
+static struct Client *
+hunt_server_glob(const struct Client *source_p, const char *mask)
+{
+  struct HuntCache *entry;
+  struct Client *target_p;
+
+  if (strlen(mask) > HOSTLEN)
+    return hunt_server_match(source_p, mask);
+
+  entry = &hunt_cache[(strhash(mask) ^ ((uintptr_t)source_p->from >> 4)) % HUNT_CACHE_SIZE];
+
+  if (entry->from == source_p->from && !irccmp(entry->mask, mask))
+  {
+    if (entry->id[0] == '\0')
+    {
+      if (entry->generation == hash_get_generation(0))
+        return NULL;
+    }
+    else if ((target_p = hash_find_id(entry->id)) && !match(mask, target_p->name) &&
+             !(target_p->from == source_p->from && !MyConnect(target_p)))
+    {
+      if (IsServer(target_p) || IsMe(target_p) ||
+          entry->generation == hash_get_generation(1))
+        return target_p;
+    }
+  }
+
+  target_p = hunt_server_match(source_p, mask);
+
+  strlcpy(entry->mask, mask, sizeof(entry->mask));
+  entry->from = source_p->from;
+
+  if (target_p)
+  {
+    strlcpy(entry->id, target_p->id, sizeof(entry->id));
+    entry->generation = hash_get_generation(1);
+  }
+  else
+  {
+    entry->id[0] = '\0';
+    entry->generation = hash_get_generation(0);
+  }
+
+  return target_p;
+}
+
 /* hunt_server()
  *      Do the basic thing in delivering the message (command)
  *      across the relays to the specific server (server) for
@@ -163,7 +289,6 @@ hunt_server(struct Client *source_p, const char *command,
             const int server, const int parc, char *parv[])
 {
   struct Client *target_p = NULL;
-  dlink_node *node = NULL;
 
   /* Assume it's me, if no server */
   if (parc <= server || EmptyString(parv[server]))
@@ -182,40 +307,7 @@ hunt_server(struct Client *source_p, const char *command,
       target_p = NULL;
 
   if (!target_p && has_wildcards(parv[server]))
-  {
-    DLINK_FOREACH(node, global_server_list.head)
-    {
-      struct Client *tmp = node->data;
-
-      assert(IsMe(tmp) || IsServer(tmp));
-      if (!match(parv[server], tmp->name))
-      {
-        if (tmp->from == source_p->from && !MyConnect(tmp))
-          continue;
-
-        target_p = node->data;
-        break;
-      }
-    }
-
-    if (!target_p)
-    {
-      DLINK_FOREACH(node, global_client_list.head)
-      {
-        struct Client *tmp = node->data;
-
-        assert(IsMe(tmp) || IsServer(tmp) || IsClient(tmp));
-        if (!match(parv[server], tmp->name))
-        {
-          if (tmp->from == source_p->from && !MyConnect(tmp))
-            continue;
-
-          target_p = node->data;
-          break;
-        }
-      }
-    }
-  }
+    target_p = hunt_server_glob(source_p, parv[server]);
 
   if (target_p)
   {
@@ -320,6 +412,29 @@ try_connections(void *unused)
   }
 }
 
+/* server_relink()
+ *
+ * inputs       - pointer to server link being closed
+ * output       - 1 if it is going to be retried after RELINK_DELAY
+ *                0 otherwise
+ * side effects - a link that has been up for RELINK_MIN_UPTIME and
+ *                wasn't squit on purpose is retried right away, instead
+ *                of after the connect frequency of its class. This is
+ *                done once; if that attempt fails, the class applies.
+ */
+int
+server_relink(const struct Client *client_p)
+{
+  if (HasFlag(client_p, FLAGS_SQUIT))
+    return 0;
+
+  if (CurrentTime - client_p->connection->firsttime < RELINK_MIN_UPTIME)
+    return 0;
+
+  event_add(&event_relink, NULL);
+  return 1;
+}
+
 int
 valid_servname(const char *name)
 {
@@ -415,6 +530,9 @@ server_capab_init(void)
   add_capability("SVS", CAPAB_SVS);
   add_capability("CHW", CAPAB_CHW);
   add_capability("HOPS", CAPAB_HOPS);
+
+  if (zip_available())
+    add_capability("ZIP", CAPAB_ZIP);
 }
 
 /* add_capability()
@@ -514,6 +632,40 @@ get_capabilities(const struct Client *client_p)
   return buf;
 }
 
+/* send_capabilities()
+ *
+ * inputs       - pointer to server we are linking with
+ *              - pointer to its connect {} block
+ * output       - none
+ * side effects - sends our CAPAB. Compression and BSIZE are only
+ *                offered to servers they have been enabled for.
+ */
+void
+send_capabilities(struct Client *client_p, const struct MaskItem *conf)
+{
+  char buf[IRCD_BUFSIZE] = "";
+  dlink_node *node;
+
+  DLINK_FOREACH(node, server_capabilities_list.head)
+  {
+    const struct Capability *cap = node->data;
+
+    if (cap->cap == CAPAB_ZIP && !IsConfCompressed(conf))
+      continue;
+    if (cap->cap == CAPAB_BSIZE && !IsConfBsize(conf))
+      continue;
+
+    if (buf[0])
+      strlcat(buf, " ", sizeof(buf));
+    strlcat(buf, cap->name, sizeof(buf));
+  }
+
+  if (IsConfCompressed(conf) && zip_available())
+    AddFlag(client_p, FLAGS_ZIP);
+
+  sendto_one(client_p, "CAPAB :%s", buf);
+}
+
 /* make_server()
  *
  * inputs       - pointer to client struct
@@ -608,10 +760,10 @@ serv_connect(struct MaskItem *conf, struct Client *by)
 
   /* Copy in the server, hostname, fd */
   strlcpy(client_p->name, conf->name, sizeof(client_p->name));
-  strlcpy(client_p->host, conf->host, sizeof(client_p->host));
+  client_set_host(client_p, conf->host);
 
   /* We already converted the ip once, so lets use it - stu */
-  strlcpy(client_p->sockhost, buf, sizeof(client_p->sockhost));
+  client_set_sockhost(client_p, buf);
 
   /* Create a socket for the server connection */
   if (comm_open(&client_p->connection->fd, conf->addr.ss.ss_family, SOCK_STREAM, 0, NULL) < 0)
@@ -759,7 +911,7 @@ finish_ssl_server_handshake(struct Client *client_p)
 
   sendto_one(client_p, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-  sendto_one(client_p, "CAPAB :%s", get_capabilities(NULL));
+  send_capabilities(client_p, conf);
 
   sendto_one(client_p, "SERVER %s 1 :%s%s",
              me.name, ConfigServerHide.hidden ? "(H) " : "",
@@ -909,7 +1061,7 @@ serv_connect_callback(fde_t *fd, int status, void *data)
 
   sendto_one(client_p, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-  sendto_one(client_p, "CAPAB :%s", get_capabilities(NULL));
+  send_capabilities(client_p, conf);
 
   sendto_one(client_p, "SERVER %s 1 :%s%s", me.name,
              ConfigServerHide.hidden ? "(H) " : "", me.info);
@@ -948,3 +1100,300 @@ find_servconn_in_progress(const char *name)
 
   return NULL;
 }
+
+/*
+ * server_send_tburst
+ *
+ * inputs       - pointer to Client
+ *              - pointer to channel
+ * output       - NONE
+ * side effects - Called on a server burst when
+ *                server is CAPAB_TBURST capable
+ */
+static void
+server_send_tburst(struct Client *client_p, const struct Channel *chptr)
+{
+  /*
+   * We may also send an empty topic here, but only if topic_time isn't 0,
+   * i.e. if we had a topic that got unset.  This is required for syncing
+   * topics properly.
+   *
+   * Imagine the following scenario: Our downlink introduces a channel
+   * to us with a TS that is equal to ours, but the channel topic on
+   * their side got unset while the servers were in splitmode, which means
+   * their 'topic' is newer.  They simply wanted to unset it, so we have to
+   * deal with it in a more sophisticated fashion instead of just resetting
+   * it to their old topic they had before.  Read m_tburst.c:ms_tburst
+   * for further information   -Michael
+   */
+  if (chptr->topic_time)
+    sendto_burst(client_p, ":%s TBURST %ju %s %ju %s :%s", me.id,
+                 chptr->creationtime, chptr->name,
+                 chptr->topic_time,
+                 ChannelTopicInfo(chptr),
+                 ChannelTopic(chptr));
+}
+
+/* server_send_client()
+ *
+ * inputs       - client (server) to send nick towards
+ *              - client to send nick for
+ * output       - NONE
+ * side effects - UID message is sent towards given client_p
+ */
+static void
+server_send_client(struct Client *client_p, struct Client *target_p)
+{
+  dlink_node *node = NULL;
+  char ubuf[IRCD_BUFSIZE] = "";
+
+  if (!IsClient(target_p))
+    return;
+
+  send_umode(target_p, 0, 0, ubuf);
+
+  if (ubuf[0] == '\0')
+  {
+    ubuf[0] = '+';
+    ubuf[1] = '\0';
+  }
+
+  sendto_burst(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
+               target_p->servptr->id,
+               target_p->name, target_p->hopcount + 1,
+               target_p->tsinfo,
+               ubuf, target_p->username, target_p->host,
+               target_p->sockhost, target_p->id,
+               target_p->account, target_p->info);
+
+  if (!EmptyString(target_p->certfp))
+    sendto_burst(client_p, ":%s CERTFP %s", target_p->id, target_p->certfp);
+
+  if (target_p->away[0])
+    sendto_burst(client_p, ":%s AWAY :%s", target_p->id, target_p->away);
+
+
+  DLINK_FOREACH(node, target_p->svstags.head)
+  {
+    const struct ServicesTag *svstag = node->data;
+    char *m = ubuf;
+
+    for (const struct user_modes *tab = umode_tab; tab->c; ++tab)
+      if (svstag->umodes & tab->flag)
+        *m++ = tab->c;
+    *m = '\0';
+
+    sendto_burst(client_p, ":%s SVSTAG %s %ju %u +%s :%s", me.id, target_p->id,
+                 target_p->tsinfo, svstag->numeric, ubuf, svstag->tag);
+  }
+}
+
+/* server_send_bsize()
+ *
+ * inputs       - pointer to server about to be bursted to
+ * output       - NONE
+ * side effects - the number of users, channels and channel members
+ *                about to be sent is announced, so the peer can
+ *                allocate for them in one go
+ */
+static void
+server_send_bsize(struct Client *client_p)
+{
+  unsigned int members = 0;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, channel_list.head)
+  {
+    const struct Channel *chptr = node->data;
+
+    members += dlink_list_length(&chptr->members);
+  }
+
+  sendto_burst(client_p, ":%s BSIZE %u %u %u", me.id, Count.total,
+               dlink_list_length(&channel_list), members);
+}
+
+/* server_burst_one()
+ *
+ * inputs       - pointer to server being bursted to
+ *              - pointer to its burst task
+ * output       - 0 if there is nothing left to send
+ * side effects - the next client or channel is queued
+ */
+static int
+server_burst_one(struct Client *client_p, struct BurstTask *bt)
+{
+  dlink_node *node = bt->cursor;
+
+  if (bt->stage == BURST_CLIENTS)
+  {
+    if (node == NULL)
+    {
+      /*
+       * Clients created since the burst started were put at the head of
+       * global_client_list, so we didn't visit them. They are introduced
+       * by the traffic held back so far, which has to go out before any
+       * SJOIN that lists them as a member.
+       */
+      DLINK_FOREACH(node, bt->held.blocks.head)
+        dbuf_add(&client_p->connection->buf_bulkq, node->data);
+      dbuf_clear(&bt->held);
+
+      bt->stage = BURST_CHANNELS;
+      bt->cursor = bt->channels;
+      return 1;
+    }
+
+    struct Client *target_p = node->data;
+
+    bt->cursor = node->next;
+
+    if (target_p->from != client_p)
+      server_send_client(client_p, target_p);
+    return 1;
+  }
+
+  if (node == NULL)
+    return 0;
+
+  struct Channel *chptr = node->data;
+
+  bt->cursor = node->next;
+
+  if (dlink_list_length(&chptr->members))
+  {
+    channel_send_modes(client_p, chptr);
+
+    if (IsCapable(client_p, CAPAB_TBURST))
+      server_send_tburst(client_p, chptr);
+  }
+
+  return 1;
+}
+
+/* server_burst_finish()
+ *
+ * inputs       - pointer to server we are done bursting to
+ * output       - NONE
+ * side effects - EOB is sent and the burst task is freed
+ */
+static void
+server_burst_finish(struct Client *client_p)
+{
+  dlink_node *node;
+
+  /* Always send a PING after connect burst is done */
+  sendto_burst(client_p, "PING :%s", me.id);
+
+  if (IsCapable(client_p, CAPAB_EOB))
+  {
+    DLINK_FOREACH_PREV(node, global_server_list.tail)
+    {
+      const struct Client *target_p = node->data;
+
+      if (target_p->from == client_p)
+        continue;
+
+      if (IsMe(target_p) || HasFlag(target_p, FLAGS_EOB))
+        sendto_burst(client_p, ":%s EOB", target_p->id);
+    }
+  }
+
+  free_burst_task(client_p);
+  send_queued_write(client_p);
+}
+
+/* server_burst()
+ *
+ * inputs       - pointer to server to send burst to
+ * output       - NONE
+ * side effects - burst of clients and channels is started. Clients
+ *                and channels created from here on are not part of it.
+ *                While clients are sent, other traffic for the link is
+ *                held back; it is released ahead of the channels, and
+ *                from then on traffic is queued behind the burst as it
+ *                happens.
+ */
+void
+server_burst(struct Client *client_p)
+{
+  struct BurstTask *const bt = xcalloc(sizeof(*bt));
+
+  if (IsCapable(client_p, CAPAB_BSIZE))
+    server_send_bsize(client_p);
+
+  bt->cursor = global_client_list.head;
+  bt->channels = channel_list.head;
+
+  client_p->connection->burst_task = bt;
+  dlinkAdd(client_p, &bt->node, &bursting_server_list);
+
+  server_burst_continue(client_p);
+}
+
+/* server_burst_continue()
+ *
+ * inputs       - pointer to server being bursted to
+ * output       - NONE
+ * side effects - the burst is queued and written out until the sendq
+ *                stays above BURST_WATERMARK, which means the link is
+ *                backed up. We're called again from io_loop() then.
+ */
+void
+server_burst_continue(struct Client *client_p)
+{
+  struct BurstTask *const bt = client_p->connection->burst_task;
+  const struct dbuf_queue *const sendq = &client_p->connection->buf_bulkq;
+
+  while (!IsDead(client_p))
+  {
+    if (dbuf_length(sendq) + zip_queued(client_p) >= BURST_WATERMARK)
+      return;  /* Still more to do */
+
+    while (dbuf_length(sendq) < BURST_WATERMARK)
+    {
+      if (server_burst_one(client_p, bt) == 0)
+      {
+        server_burst_finish(client_p);
+        return;
+      }
+    }
+
+    send_queued_write(client_p);
+  }
+}
+
+/* server_burst_unlink()
+ *
+ * inputs       - node of a client or channel about to be unlinked from
+ *                global_client_list or channel_list
+ * output       - NONE
+ * side effects - bursts that were about to send it move on to the next
+ */
+void
+server_burst_unlink(const dlink_node *node)
+{
+  dlink_node *ptr;
+
+  DLINK_FOREACH(ptr, bursting_server_list.head)
+  {
+    struct BurstTask *const bt = ((struct Client *)ptr->data)->connection->burst_task;
+
+    if (bt->cursor == node)
+      bt->cursor = node->next;
+    if (bt->channels == node)
+      bt->channels = node->next;
+  }
+}
+
+void
+free_burst_task(struct Client *client_p)
+{
+  struct BurstTask *const bt = client_p->connection->burst_task;
+
+  dlinkDelete(&bt->node, &bursting_server_list);
+  dbuf_clear(&bt->held);
+
+  xfree(bt);
+  client_p->connection->burst_task = NULL;
+}
@@ -51,6 +51,7 @@
 #include "watch.h"
 #include "isupport.h"
 #include "tls.h"
+#include "password.h"
 
 static char umode_buffer[IRCD_BUFSIZE];
 
@@ -339,6 +340,10 @@ register_local_user(struct Client *client_p)
   /* Straight up the maximum rate of flooding... */
   client_p->connection->allow_read = MAX_FLOOD_BURST;
 
+  /* Parked until the password workers are done, they will call us again */
+  if (conf_password_pending(client_p))
+    return;
+
   if (!check_client(client_p))
     return;
 
@@ -346,7 +351,7 @@ register_local_user(struct Client *client_p)
   {
     sendto_one_notice(client_p, &me, ":*** Notice -- You have an illegal "
                       "character in your hostname");
-    strlcpy(client_p->host, client_p->sockhost, sizeof(client_p->host));
+    client_set_host(client_p, client_p->sockhost);
   }
 
   conf = client_p->connection->confs.head->data;
@@ -379,7 +384,7 @@ register_local_user(struct Client *client_p)
   /* Password check */
   if (!EmptyString(conf->passwd))
   {
-    if (!match_conf_password(client_p->connection->password, conf))
+    if (password_verify(client_p, client_p->connection->password, conf, NULL) != PASSWORD_MATCH)
     {
       ++ServerStats.is_ref;
 
@@ -389,6 +394,8 @@ register_local_user(struct Client *client_p)
     }
   }
 
+  password_forget(client_p);
+
   /*
    * Don't free client_p->connection->password here - it can be required
    * by masked /stats I if there are auth {} blocks with need_password = no;
@@ -735,7 +742,7 @@ user_set_hostmask(struct Client *client_p, const char *hostname, const int what)
                                client_p->name, client_p->username,
                                client_p->host, client_p->username, hostname);
 
-  strlcpy(client_p->host, hostname, sizeof(client_p->host));
+  client_set_host(client_p, hostname);
 
   if (MyConnect(client_p))
   {
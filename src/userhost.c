@@ -24,12 +24,14 @@
  * \version $Id$
  */
 
+#include "stdinc.h"
 #include "list.h"
 #include "hash.h"
 #include "client.h"
 #include "userhost.h"
 #include "mempool.h"
 #include "irc_string.h"
+#include "intern.h"
 
 
 static mp_pool_t *userhost_pool;
@@ -38,7 +40,7 @@ static mp_pool_t *userhost_pool;
 void
 userhost_init(void)
 {
-  userhost_pool = mp_pool_new(sizeof(struct UserHost), MP_CHUNK_SIZE_USERHOST);
+  userhost_pool = mp_pool_new("userhost", sizeof(struct UserHost), MP_CHUNK_SIZE_USERHOST);
 }
 
 /* userhost_count()
@@ -82,7 +84,7 @@ userhost_find_or_add(const char *host)
 
   userhost = mp_pool_get(userhost_pool);
 
-  strlcpy(userhost->host, host, sizeof(userhost->host));
+  userhost->host = intern_get(host);
   hash_add_userhost(userhost);
 
   return userhost;
@@ -136,6 +138,7 @@ userhost_del(const char *host, int global)
   if (userhost->gcount == 0 && userhost->lcount == 0)
   {
     hash_del_userhost(userhost);
+    intern_release(userhost->host);
     mp_pool_release(userhost);
   }
 }
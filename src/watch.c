@@ -45,7 +45,7 @@ static dlink_list watchTable[HASHSIZE];
 void
 watch_init(void)
 {
-  watch_pool = mp_pool_new(sizeof(struct Watch), MP_CHUNK_SIZE_WATCH);
+  watch_pool = mp_pool_new("watch", sizeof(struct Watch), MP_CHUNK_SIZE_WATCH);
 }
 
 /*
@@ -24,31 +24,42 @@
  * \version $Id$
  */
 
+
+/*
+ * Records are appended to an arena of WHOWAS_BLOCK_SIZE byte blocks and
+ * always expire oldest first, so the arena is used as a ring: each block
+ * keeps the offset of its oldest live record and of its free space, new
+ * records go to the end of the newest block, and a block is freed once
+ * its last record has expired. Records are found through whowas_hash.
+ */
+
 #include "stdinc.h"
 #include "list.h"
-#include "mempool.h"
+#include "memory.h"
 #include "whowas.h"
 #include "client.h"
 #include "hash.h"
+#include "intern.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "conf.h"
+#include "cursor.h"
 
+enum { WHOWAS_BLOCK_SIZE = 64 * 1024 };
 
-static mp_pool_t *whowas_pool;
+struct WhowasBlock
+{
+  dlink_node node;  /**< List node; linked into whowas_blocks */
+  size_t head;  /**< Offset of the oldest record */
+  size_t tail;  /**< Offset of the free space */
+  char data[] __attribute__((aligned(sizeof(uintmax_t))));
+};
 
-static dlink_list whowas_list;  /*! Chain of struct Whowas pointers */
+static dlink_list whowas_blocks;  /*! Chain of struct WhowasBlock pointers, oldest first */
 static dlink_list whowas_hash[HASHSIZE];
+static unsigned int whowas_count;
 
 
-/*! \brief Initializes the whowas memory pool.
- */
-void
-whowas_init(void)
-{
-  whowas_pool = mp_pool_new(sizeof(struct Whowas), MP_CHUNK_SIZE_WHOWAS);
-}
-
 /*! \brief Returns a slot of the whowas_hash by the hash value associated with it.
  * \param hashv Hash value.
  */
@@ -61,60 +72,74 @@ whowas_get_hash(unsigned int hashv)
   return &whowas_hash[hashv];
 }
 
-/*! \brief Unlinks a Whowas struct from its associated lists.
- * \param whowas Pointer to Whowas struct to be unlinked.
+/*! \brief Unlinks the oldest Whowas record from its associated lists
+ *         and returns its space to the arena.
  */
-static struct Whowas *
-whowas_unlink(struct Whowas *whowas)
+static void
+whowas_free_oldest(void)
 {
+  struct WhowasBlock *block = whowas_blocks.head->data;
+  struct Whowas *whowas = (struct Whowas *)(block->data + block->head);
+
   if (whowas->online)
-    dlinkDelete(&whowas->cnode, &whowas->online->whowas_list);
+  {
+    dlinkDelete(whowas->cnode, &whowas->online->whowas_list);
+    free_dlink_node(whowas->cnode);
+  }
 
+  cursor_unlink(&whowas->hnode);
   dlinkDelete(&whowas->hnode, &whowas_hash[whowas->hashv]);
-  dlinkDelete(&whowas->lnode, &whowas_list);
 
-  return whowas;
-}
+  intern_release(whowas->hostname);
+  intern_release(whowas->realname);
+  intern_release(whowas->servername);
 
-/*! \brief Unlinks a Whowas struct from its associated lists
- *         and returns memory back to the pooling allocator.
- * \param whowas Pointer to Whowas struct to be unlinked and freed.
- */
-static void
-whowas_free(struct Whowas *whowas)
-{
-  whowas_unlink(whowas);
-  mp_pool_release(whowas);
+  block->head += whowas->size;
+  --whowas_count;
+
+  if (block->head < block->tail)
+    return;
+
+  if (block->node.next == NULL)
+    block->head = block->tail = 0;  /* Newest block; keep it */
+  else
+  {
+    dlinkDelete(&block->node, &whowas_blocks);
+    xfree(block);
+  }
 }
 
-/*! \brief Returns a Whowas struct for further use. Either allocates
- *         a new one, or returns the oldest entry from the whowas_list
- *         if it ran over ConfigGeneral.whowas_history_length
+/*! \brief Returns space for a Whowas record of the given size
+ *         from the newest block of the arena.
+ * \param size Size of the record, a multiple of sizeof(uintmax_t).
  */
 static struct Whowas *
-whowas_make(void)
+whowas_alloc(size_t size)
 {
+  struct WhowasBlock *block = whowas_blocks.tail ? whowas_blocks.tail->data : NULL;
   struct Whowas *whowas;
 
-  if (dlink_list_length(&whowas_list) &&
-      dlink_list_length(&whowas_list) >= ConfigGeneral.whowas_history_length)
-    whowas = whowas_unlink(whowas_list.tail->data);  /* Re-use oldest item */
-  else
-    whowas = mp_pool_get(whowas_pool);
+  if (block == NULL || block->tail + size > WHOWAS_BLOCK_SIZE - sizeof(*block))
+  {
+    block = xcalloc(WHOWAS_BLOCK_SIZE);
+    dlinkAddTail(block, &block->node, &whowas_blocks);
+  }
+
+  whowas = (struct Whowas *)(block->data + block->tail);
+  block->tail += size;
 
   return whowas;
 }
 
-/*! \brief Trims the whowas_list if necessary until there are no
+/*! \brief Trims the whowas history if necessary until there are no
  *         more than ConfigGeneral.whowas_history_length Whowas
- *         struct items.
+ *         records.
  */
 void
 whowas_trim(void)
 {
-  while (dlink_list_length(&whowas_list) &&
-         dlink_list_length(&whowas_list) >= ConfigGeneral.whowas_history_length)
-    whowas_free(whowas_list.tail->data);
+  while (whowas_count && whowas_count >= ConfigGeneral.whowas_history_length)
+    whowas_free_oldest();
 }
 
 /*! \brief Adds the currently defined name of the client to history.
@@ -126,32 +151,51 @@ whowas_trim(void)
 void
 whowas_add_history(struct Client *client_p, const int online)
 {
-  struct Whowas *whowas = whowas_make();
+  struct Whowas *whowas;
+  size_t namelen = strlen(client_p->name) + 1;
+  size_t userlen = strlen(client_p->username) + 1;
+  size_t socklen = strlen(client_p->sockhost) + 1;
+  size_t acctlen = strlen(client_p->account) + 1;
+  size_t size = sizeof(*whowas) + namelen + userlen + socklen + acctlen;
 
   assert(IsClient(client_p));
 
+  whowas_trim();
+
+  size = (size + sizeof(uintmax_t) - 1) & ~(sizeof(uintmax_t) - 1);
+  whowas = whowas_alloc(size);
+
+  whowas->size = size;
   whowas->hashv = strhash(client_p->name);
   whowas->shide = IsHidden(client_p->servptr) != 0;
   whowas->logoff = CurrentTime;
+  whowas->hostname = intern_ref(client_p->host);
+  whowas->realname = intern_ref(client_p->info);
+  whowas->servername = intern_get(client_p->servptr->name);
 
-  strlcpy(whowas->account, client_p->account, sizeof(whowas->account));
-  strlcpy(whowas->name, client_p->name, sizeof(whowas->name));
-  strlcpy(whowas->username, client_p->username, sizeof(whowas->username));
-  strlcpy(whowas->hostname, client_p->host, sizeof(whowas->hostname));
-  strlcpy(whowas->sockhost, client_p->sockhost, sizeof(whowas->sockhost));
-  strlcpy(whowas->realname, client_p->info, sizeof(whowas->realname));
-  strlcpy(whowas->servername, client_p->servptr->name, sizeof(whowas->servername));
+  whowas->username = namelen;
+  whowas->sockhost = whowas->username + userlen;
+  whowas->account = whowas->sockhost + socklen;
+
+  memcpy(whowas->name, client_p->name, namelen);
+  memcpy(WhowasUser(whowas), client_p->username, userlen);
+  memcpy(WhowasSockhost(whowas), client_p->sockhost, socklen);
+  memcpy(WhowasAccount(whowas), client_p->account, acctlen);
 
   if (online)
   {
     whowas->online = client_p;
-    dlinkAdd(whowas, &whowas->cnode, &client_p->whowas_list);
+    whowas->cnode = make_dlink_node();
+    dlinkAdd(whowas, whowas->cnode, &client_p->whowas_list);
   }
   else
+  {
     whowas->online = NULL;
+    whowas->cnode = NULL;
+  }
 
   dlinkAdd(whowas, &whowas->hnode, &whowas_hash[whowas->hashv]);
-  dlinkAdd(whowas, &whowas->lnode, &whowas_list);
+  ++whowas_count;
 }
 
 /*! \brief This must be called when the client structure is about to
@@ -166,8 +210,11 @@ whowas_off_history(struct Client *client_p)
   {
     struct Whowas *whowas = client_p->whowas_list.head->data;
 
+    dlinkDelete(whowas->cnode, &client_p->whowas_list);
+    free_dlink_node(whowas->cnode);
+
     whowas->online = NULL;
-    dlinkDelete(&whowas->cnode, &client_p->whowas_list);
+    whowas->cnode = NULL;
   }
 }
 
@@ -198,11 +245,11 @@ whowas_get_history(const char *name, uintmax_t timelimit)
   return NULL;
 }
 
-/*! \brief For debugging. Counts allocated structures stored in whowas_list
+/*! \brief For debugging. Counts Whowas records and the memory of the arena
  */
 void
 whowas_count_memory(unsigned int *const count, size_t *const bytes)
 {
-  (*count) = dlink_list_length(&whowas_list);
-  (*bytes) = dlink_list_length(&whowas_list) * sizeof(struct Whowas);
+  (*count) = whowas_count;
+  (*bytes) = dlink_list_length(&whowas_blocks) * WHOWAS_BLOCK_SIZE;
 }
@@ -0,0 +1,414 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file zip.c
+ * \brief Stream compression of server links.
+ * \version $Id$
+ */
+
+/*
+ * Compression is offered with the ZIP capability and used when both
+ * sides offered it. Each side compresses everything it sends after its
+ * SVINFO, which is the first line sent once the peer has been accepted.
+ * Anything sent before that, such as numerics in reply to the peer's
+ * early notices, goes out as is; likewise we only start inflating once
+ * the peer's SVINFO has been parsed.
+ *
+ * Outgoing data is deflated from the sendq into a queue of compressed
+ * data that send_queued_write() writes to the socket or TLS layer. Lines
+ * are fed to zlib as they're written, and the stream is flushed once at
+ * the end of every io_loop() iteration. The lanes of the sendq are fed
+ * in the order they'd be written; only the control lane is fed while
+ * ZIP_BACKLOG bytes of compressed data wait for the link, so it doesn't
+ * queue up behind a whole burst.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "memory.h"
+#include "send.h"
+#include "server.h"
+#include "zip.h"
+
+#if defined(HAVE_LIBZ) && defined(HAVE_ZLIB_H)
+#include <zlib.h>
+
+enum { ZIP_BUFSIZE = 16384, ZIP_BACKLOG = ZIP_BUFSIZE * 4 };
+
+struct zip_link
+{
+  z_stream in;                 /**< Inflates what the peer sends */
+  z_stream out;                /**< Deflates what we send */
+  struct dbuf_queue buf_zipq;  /**< Compressed data not yet written */
+  struct zip_stats stats;
+  unsigned int dirty;          /**< Data deflated since the last flush */
+  unsigned int inflating;      /**< Peer's SVINFO has been seen */
+};
+
+
+static uintmax_t
+zip_clock(void)
+{
+  struct timespec ts;
+
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+    return 0;
+
+  return (uintmax_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+zip_deflate_run(struct zip_link *zip, int mode)
+{
+  char buf[ZIP_BUFSIZE];
+
+  do
+  {
+    zip->out.next_out = (Bytef *)buf;
+    zip->out.avail_out = sizeof(buf);
+
+    deflate(&zip->out, mode);
+
+    size_t len = sizeof(buf) - zip->out.avail_out;
+    if (len)
+    {
+      dbuf_put(&zip->buf_zipq, buf, len);
+      zip->stats.out_wire += len;
+    }
+  } while (zip->out.avail_out == 0);
+}
+
+/*
+ * Whether there's data in the sendq to be compressed now: a line that was
+ * started, the control lane, or anything if the link isn't backed up.
+ */
+static int
+zip_feedable(const struct Connection *conn)
+{
+  if (conn->sendq_partial || dbuf_length(&conn->buf_ctlq))
+    return 1;
+
+  return sendq_length(conn) && dbuf_length(&conn->zip->buf_zipq) < ZIP_BACKLOG;
+}
+
+int
+zip_available(void)
+{
+  return 1;
+}
+
+/* zip_start()
+ *
+ * inputs       - pointer to server we just sent our SVINFO to
+ * output       - none
+ * side effects - compression of what we send is switched on if both
+ *                sides offered it
+ */
+void
+zip_start(struct Client *client_p)
+{
+  struct zip_link *zip;
+  struct dbuf_queue *queue;
+
+  if (!IsCapable(client_p, CAPAB_ZIP))
+    return;
+
+  if (!HasFlag(client_p, FLAGS_ZIP))
+  {
+    /* They offered, we didn't */
+    ClearCap(client_p, CAPAB_ZIP);
+    return;
+  }
+
+  zip = xcalloc(sizeof(*zip));
+
+  if (deflateInit(&zip->out, ZIP_LEVEL) != Z_OK)
+  {
+    xfree(zip);
+    exit_client(client_p, "Compression failure");
+    return;
+  }
+
+  if (inflateInit(&zip->in) != Z_OK)
+  {
+    deflateEnd(&zip->out);
+    xfree(zip);
+    exit_client(client_p, "Compression failure");
+    return;
+  }
+
+  client_p->connection->zip = zip;
+
+  /* Anything queued so far, up to and including our SVINFO, goes out as is */
+  while ((queue = sendq_next(client_p->connection)))
+  {
+    const struct dbuf_block *block = queue->blocks.head->data;
+    size_t len = block->size - queue->pos;
+
+    dbuf_put(&zip->buf_zipq, block->data + queue->pos, len);
+    sendq_consume(client_p->connection, queue, len);
+  }
+}
+
+/* zip_start_inflate()
+ *
+ * inputs       - pointer to server whose SVINFO was just parsed
+ * output       - none
+ * side effects - whatever follows in the recvq and from now on is
+ *                inflated, if compression was agreed on
+ */
+void
+zip_start_inflate(struct Client *client_p)
+{
+  struct zip_link *zip = client_p->connection->zip;
+  struct dbuf_queue *recvq = &client_p->connection->buf_recvq;
+  struct dbuf_queue queue;
+
+  if (zip == NULL || zip->inflating)
+    return;
+
+  zip->inflating = 1;
+
+  if (dbuf_length(recvq) == 0)
+    return;
+
+  queue = *recvq;
+  memset(recvq, 0, sizeof(*recvq));
+
+  while (dbuf_length(&queue))
+  {
+    const struct dbuf_block *block = queue.blocks.head->data;
+    size_t len = block->size - queue.pos;
+
+    if (!zip_inflate(client_p, block->data + queue.pos, len))
+    {
+      dbuf_clear(&queue);
+      exit_client(client_p, "Compression error");
+      return;
+    }
+
+    dbuf_delete(&queue, len);
+  }
+}
+
+/* zip_deflate()
+ *
+ * inputs       - pointer to compressed server link
+ *              - if set, the compressed stream is flushed
+ * output       - pointer to queue of compressed data to write
+ * side effects - sendq is fed to the compressor
+ */
+struct dbuf_queue *
+zip_deflate(struct Client *client_p, int flush)
+{
+  struct Connection *conn = client_p->connection;
+  struct zip_link *zip = conn->zip;
+  struct dbuf_queue *queue;
+  uintmax_t start;
+
+  if (!zip_feedable(conn) && !(flush && zip->dirty))
+    return &zip->buf_zipq;
+
+  start = zip_clock();
+
+  while (zip_feedable(conn) && (queue = sendq_next(conn)))
+  {
+    const struct dbuf_block *block = queue->blocks.head->data;
+    size_t len = block->size - queue->pos;
+
+    zip->out.next_in = (Bytef *)(block->data + queue->pos);
+    zip->out.avail_in = len;
+    zip_deflate_run(zip, Z_NO_FLUSH);
+
+    zip->stats.out += len;
+    zip->dirty = 1;
+    sendq_consume(conn, queue, len);
+  }
+
+  if (flush && zip->dirty)
+  {
+    zip->out.avail_in = 0;
+    zip_deflate_run(zip, Z_SYNC_FLUSH);
+    zip->dirty = 0;
+  }
+
+  zip->stats.cpu += zip_clock() - start;
+  return &zip->buf_zipq;
+}
+
+/* zip_inflate()
+ *
+ * inputs       - pointer to compressed server link
+ *              - pointer to data as read from the link
+ *              - length of data
+ * output       - 0 if the data couldn't be inflated
+ * side effects - inflated data is appended to the recvq. Data that
+ *                arrives before the peer's SVINFO is appended as is.
+ */
+int
+zip_inflate(struct Client *client_p, const char *data, size_t length)
+{
+  struct zip_link *zip = client_p->connection->zip;
+  char buf[ZIP_BUFSIZE];
+  uintmax_t start;
+  int ret;
+
+  if (!zip->inflating)
+  {
+    dbuf_put(&client_p->connection->buf_recvq, data, length);
+    return 1;
+  }
+
+  start = zip_clock();
+  zip->in.next_in = (Bytef *)data;
+  zip->in.avail_in = length;
+  zip->stats.in_wire += length;
+
+  do
+  {
+    zip->in.next_out = (Bytef *)buf;
+    zip->in.avail_out = sizeof(buf);
+
+    ret = inflate(&zip->in, Z_SYNC_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR)
+      break;
+
+    size_t len = sizeof(buf) - zip->in.avail_out;
+    dbuf_put(&client_p->connection->buf_recvq, buf, len);
+    zip->stats.in += len;
+  } while (zip->in.avail_in || zip->in.avail_out == 0);
+
+  zip->stats.cpu += zip_clock() - start;
+  return ret == Z_OK || ret == Z_BUF_ERROR;
+}
+
+size_t
+zip_queued(const struct Client *client_p)
+{
+  const struct zip_link *zip = client_p->connection->zip;
+
+  return zip ? dbuf_length(&zip->buf_zipq) : 0;
+}
+
+/* zip_flush_all()
+ *
+ * inputs       - none
+ * output       - none
+ * side effects - flushes the compressed stream of every server link
+ *                that had data written during this loop iteration
+ */
+void
+zip_flush_all(void)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, local_server_list.head)
+  {
+    struct Client *client_p = node->data;
+    struct zip_link *zip = client_p->connection->zip;
+
+    if (zip == NULL || IsDead(client_p))
+      continue;
+
+    if (zip->dirty || sendq_length(client_p->connection))
+    {
+      zip_deflate(client_p, 1);
+      send_queued_write(client_p);
+    }
+  }
+}
+
+void
+zip_free(struct Client *client_p)
+{
+  struct zip_link *zip = client_p->connection->zip;
+
+  if (zip == NULL)
+    return;
+
+  deflateEnd(&zip->out);
+  inflateEnd(&zip->in);
+  dbuf_clear(&zip->buf_zipq);
+  xfree(zip);
+
+  client_p->connection->zip = NULL;
+}
+
+const struct zip_stats *
+zip_get_stats(const struct Client *client_p)
+{
+  const struct zip_link *zip = client_p->connection->zip;
+
+  return zip ? &zip->stats : NULL;
+}
+#else
+int
+zip_available(void)
+{
+  return 0;
+}
+
+void
+zip_start(struct Client *client_p)
+{
+  ClearCap(client_p, CAPAB_ZIP);
+}
+
+void
+zip_start_inflate(struct Client *client_p)
+{
+}
+
+struct dbuf_queue *
+zip_deflate(struct Client *client_p, int flush)
+{
+  return &client_p->connection->buf_sendq;
+}
+
+int
+zip_inflate(struct Client *client_p, const char *data, size_t length)
+{
+  return 0;
+}
+
+size_t
+zip_queued(const struct Client *client_p)
+{
+  return 0;
+}
+
+void
+zip_flush_all(void)
+{
+}
+
+void
+zip_free(struct Client *client_p)
+{
+}
+
+const struct zip_stats *
+zip_get_stats(const struct Client *client_p)
+{
+  return NULL;
+}
+#endif
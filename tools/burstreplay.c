@@ -0,0 +1,639 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file burstreplay.c
+ * \brief Replays a captured server burst through the receive queue line
+ *        splitter, and checks it against the previous implementation.
+ * \version $Id$
+ */
+
+/*
+ * A server link spends most of its receive time during a burst in
+ * extract_one_line() (src/packet.c), which takes one line at a time out
+ * of the dbuf receive queue. This program carries two copies of it on a
+ * minimal dbuf queue:
+ *
+ *  - extract_memchr(), the current version, which finds the end of the
+ *    line with memchr() and copies it with memcpy(), a block at a time.
+ *  - extract_bytewise(), the version it replaced, which looked at and
+ *    copied one character at a time.
+ *
+ * Both must be kept the same as their originals; the queue follows
+ * struct dbuf_queue, dbuf_put() and dbuf_delete().
+ *
+ *  burstreplay -c      feeds both versions random data in random block
+ *                      layouts and stops at the first difference in the
+ *                      returned length, the line, or the queue left over.
+ *  burstreplay file    feeds a captured burst to both versions the way
+ *                      read_packet() does, READBUF_SIZE bytes at a time,
+ *                      and times the line splitting.
+ *  burstreplay -g N    writes a synthetic burst of N users, with their
+ *                      channels and bans, for when no capture is at hand.
+ *
+ * Results are written as one JSON object per line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+enum
+{
+  DBUF_BLOCK_SIZE = 1024,  /* include/dbuf.h */
+  READBUF_SIZE = 16384,    /* src/packet.c */
+  IRCD_BUFSIZE = 512       /* include/ircd_defs.h */
+};
+
+#define IsEol(c) ((c) == '\r' || (c) == '\n')
+#define IRCD_MIN(a, b) ((a) < (b) ? (a) : (b))
+
+struct dbuf_block
+{
+  struct dbuf_block *next;
+  size_t size;
+  char data[DBUF_BLOCK_SIZE];
+};
+
+struct dbuf_queue
+{
+  struct dbuf_block *head;
+  struct dbuf_block *tail;
+  size_t total_size;
+  size_t pos;
+};
+
+typedef unsigned int (*extract_fn)(struct dbuf_queue *, char *);
+
+
+static struct dbuf_block *free_blocks;
+static uint64_t rng_state = 88172645463325252ULL;
+
+
+static void
+fatal(const char *fmt, ...)
+{
+  va_list args;
+
+  va_start(args, fmt);
+  fprintf(stderr, "burstreplay: ");
+  vfprintf(stderr, fmt, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+
+  exit(EXIT_FAILURE);
+}
+
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static double
+ms(uint64_t ns)
+{
+  return ns / 1000000.0;
+}
+
+static uint32_t
+rng(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return rng_state >> 32;
+}
+
+static struct dbuf_block *
+dbuf_alloc(void)
+{
+  struct dbuf_block *block = free_blocks;
+
+  if (block)
+    free_blocks = block->next;
+  else if ((block = malloc(sizeof(*block))) == NULL)
+    fatal("out of memory");
+
+  block->next = NULL;
+  block->size = 0;
+  return block;
+}
+
+static void
+dbuf_append(struct dbuf_queue *queue, struct dbuf_block *block)
+{
+  if (queue->tail)
+    queue->tail->next = block;
+  else
+    queue->head = block;
+  queue->tail = block;
+}
+
+/*
+ * As dbuf_put(): fill up the last block, then append new ones
+ */
+static void
+dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
+{
+  while (sz > 0)
+  {
+    struct dbuf_block *block = queue->tail;
+
+    if (block == NULL || sizeof(block->data) - block->size == 0)
+    {
+      block = dbuf_alloc();
+      dbuf_append(queue, block);
+    }
+
+    size_t avail = IRCD_MIN(sizeof(block->data) - block->size, sz);
+
+    memcpy(&block->data[block->size], buf, avail);
+    block->size += avail;
+    queue->total_size += avail;
+
+    sz -= avail;
+    buf += avail;
+  }
+}
+
+/*
+ * Appends exactly <sz> bytes as a block of their own, so that the check
+ * can lay out lines across block boundaries at will
+ */
+static void
+dbuf_put_block(struct dbuf_queue *queue, const char *buf, size_t sz)
+{
+  struct dbuf_block *block = dbuf_alloc();
+
+  memcpy(block->data, buf, sz);
+  block->size = sz;
+  queue->total_size += sz;
+  dbuf_append(queue, block);
+}
+
+static void
+dbuf_delete(struct dbuf_queue *queue, size_t count)
+{
+  while (count > 0 && queue->total_size > 0)
+  {
+    struct dbuf_block *block = queue->head;
+    size_t avail = block->size - queue->pos;
+
+    if (count >= avail)
+    {
+      count -= avail;
+      queue->total_size -= avail;
+
+      if ((queue->head = block->next) == NULL)
+        queue->tail = NULL;
+      block->next = free_blocks;
+      free_blocks = block;
+
+      queue->pos = 0;
+    }
+    else
+    {
+      queue->pos += count;
+      queue->total_size -= count;
+      count = 0;
+    }
+  }
+}
+
+static void
+dbuf_clear(struct dbuf_queue *queue)
+{
+  dbuf_delete(queue, queue->total_size);
+}
+
+/*
+ * extract_one_line() as it is in src/packet.c
+ */
+static unsigned int
+extract_memchr(struct dbuf_queue *qptr, char *buffer)
+{
+  unsigned int line_bytes = 0, eol_bytes = 0;
+
+  for (const struct dbuf_block *block = qptr->head; block; block = block->next)
+  {
+    const char *p = block->data, *const end = block->data + block->size;
+
+    if (block == qptr->head)
+      p += qptr->pos;
+
+    if (eol_bytes == 0)
+    {
+      const char *eol = memchr(p, '\n', end - p);
+      const char *cr = memchr(p, '\r', (eol ? eol : end) - p);
+
+      if (cr)
+        eol = cr;
+      if (eol == NULL)
+        eol = end;
+
+      if (line_bytes < IRCD_BUFSIZE - 2)
+      {
+        size_t len = IRCD_MIN((size_t)(eol - p), IRCD_BUFSIZE - 2 - line_bytes);
+
+        memcpy(buffer, p, len);
+        buffer += len;
+      }
+
+      line_bytes += eol - p;
+      p = eol;
+    }
+
+    for (; p < end; ++p)
+    {
+      if (!IsEol(*p))
+        goto out;
+
+      /* Allow 2 eol bytes per message */
+      if (++eol_bytes == 2)
+        goto out;
+    }
+  }
+
+out:
+  if (eol_bytes)
+    *buffer = '\0';
+  else
+    line_bytes = 0;
+
+  dbuf_delete(qptr, line_bytes + eol_bytes);
+
+  return IRCD_MIN(line_bytes, IRCD_BUFSIZE - 2);
+}
+
+/*
+ * extract_one_line() as it was before it used memchr()
+ */
+static unsigned int
+extract_bytewise(struct dbuf_queue *qptr, char *buffer)
+{
+  unsigned int line_bytes = 0, eol_bytes = 0;
+
+  for (const struct dbuf_block *block = qptr->head; block; block = block->next)
+  {
+    unsigned int idx;
+
+    if (block == qptr->head)
+      idx = qptr->pos;
+    else
+      idx = 0;
+
+    for (; idx < block->size; ++idx)
+    {
+      char c = block->data[idx];
+
+      if (IsEol(c))
+      {
+        ++eol_bytes;
+
+        /* Allow 2 eol bytes per message */
+        if (eol_bytes == 2)
+          goto out;
+      }
+      else if (eol_bytes)
+        goto out;
+      else if (line_bytes++ < IRCD_BUFSIZE - 2)
+        *buffer++ = c;
+    }
+  }
+
+out:
+  if (eol_bytes)
+    *buffer = '\0';
+  else
+    line_bytes = 0;
+
+  dbuf_delete(qptr, line_bytes + eol_bytes);
+
+  return IRCD_MIN(line_bytes, IRCD_BUFSIZE - 2);
+}
+
+/*
+ * Random text in which line ends, CR LF pairs, empty lines and lines
+ * longer than IRCD_BUFSIZE all come up often
+ */
+static void
+random_text(char *buf, size_t len)
+{
+  for (size_t i = 0; i < len; )
+  {
+    const uint32_t r = rng() % 100;
+
+    if (r < 3)
+    {
+      /* A run long enough to be truncated */
+      size_t run = IRCD_BUFSIZE - 16 + rng() % 64;
+
+      run = IRCD_MIN(run, len - i);
+
+      memset(buf + i, 'x', run);
+      i += run;
+    }
+    else if (r < 10)
+      buf[i++] = '\r';
+    else if (r < 20)
+      buf[i++] = '\n';
+    else
+      buf[i++] = 'a' + rng() % 26;
+  }
+}
+
+static int
+check(unsigned int iterations)
+{
+  static char text[4 * DBUF_BLOCK_SIZE];
+  char line_old[IRCD_BUFSIZE + 1], line_new[IRCD_BUFSIZE + 1];
+  unsigned long lines = 0;
+
+  for (unsigned int i = 0; i < iterations; ++i)
+  {
+    struct dbuf_queue q_old = { 0 }, q_new = { 0 };
+    const size_t len = 1 + rng() % sizeof(text);
+    const size_t pos = rng() % IRCD_MIN(len, DBUF_BLOCK_SIZE);
+
+    random_text(text, len);
+
+    for (size_t done = 0; done < len; )
+    {
+      size_t sz = 1 + rng() % DBUF_BLOCK_SIZE;
+
+      sz = IRCD_MIN(sz, len - done);
+
+      if (done == 0 && sz <= pos)
+        sz = pos + 1;
+
+      dbuf_put_block(&q_old, text + done, sz);
+      dbuf_put_block(&q_new, text + done, sz);
+      done += sz;
+    }
+
+    dbuf_delete(&q_old, pos);
+    dbuf_delete(&q_new, pos);
+
+    while (1)
+    {
+      const size_t before = q_old.total_size;
+
+      memset(line_old, 0x55, sizeof(line_old));
+      memset(line_new, 0xaa, sizeof(line_new));
+
+      const unsigned int n_old = extract_bytewise(&q_old, line_old);
+      const unsigned int n_new = extract_memchr(&q_new, line_new);
+
+      if (n_old != n_new || q_old.total_size != q_new.total_size || q_old.pos != q_new.pos ||
+          (q_old.total_size != before && memcmp(line_old, line_new, n_old + 1)))
+      {
+        printf("{\"check\":\"extract_one_line\",\"iteration\":%u,\"offset\":%zu,"
+               "\"length\":[%u,%u],\"left\":[%zu,%zu],\"result\":\"mismatch\"}\n",
+               i, len - before, n_old, n_new, q_old.total_size, q_new.total_size);
+        return 0;
+      }
+
+      if (q_old.total_size == before)
+        break;
+      ++lines;
+    }
+
+    dbuf_clear(&q_old);
+    dbuf_clear(&q_new);
+  }
+
+  printf("{\"check\":\"extract_one_line\",\"iterations\":%u,\"lines\":%lu,\"result\":\"ok\"}\n",
+         iterations, lines);
+  return 1;
+}
+
+/*
+ * Splits <data> into lines as parse_client_queued() does for a server,
+ * after each read of READBUF_SIZE bytes. Returns the time spent in <fn>.
+ */
+static uint64_t
+replay(extract_fn fn, const char *data, size_t len, unsigned long *lines, uint32_t *sum)
+{
+  struct dbuf_queue queue = { 0 };
+  char line[IRCD_BUFSIZE + 1];
+  uint64_t spent = 0;
+
+  *lines = 0;
+  *sum = 0;
+
+  for (size_t done = 0; done < len; )
+  {
+    const size_t sz = IRCD_MIN((size_t)READBUF_SIZE, len - done);
+    unsigned int n;
+
+    dbuf_put(&queue, data + done, sz);
+    done += sz;
+
+    const uint64_t start = now_ns();
+
+    while ((n = fn(&queue, line)))
+    {
+      ++*lines;
+      *sum = *sum * 31 + n + (unsigned char)line[0] + (unsigned char)line[n - 1];
+    }
+
+    spent += now_ns() - start;
+  }
+
+  dbuf_clear(&queue);
+  return spent;
+}
+
+static void
+replay_file(const char *path, unsigned int rounds)
+{
+  FILE *file = fopen(path, "rb");
+  char *data = NULL;
+  size_t len = 0, alloc = 0;
+
+  if (file == NULL)
+    fatal("%s: %s", path, strerror(errno));
+
+  while (!feof(file))
+  {
+    if (alloc - len < READBUF_SIZE)
+      if ((data = realloc(data, alloc = alloc * 2 + READBUF_SIZE)) == NULL)
+        fatal("out of memory");
+
+    len += fread(data + len, 1, alloc - len, file);
+
+    if (ferror(file))
+      fatal("%s: %s", path, strerror(errno));
+  }
+
+  fclose(file);
+
+  static const struct
+  {
+    const char *name;
+    extract_fn fn;
+  } versions[] = {
+    { "bytewise", extract_bytewise },
+    { "memchr", extract_memchr }
+  };
+
+  unsigned long lines[2] = { 0 };
+  uint32_t sums[2] = { 0 };
+
+  for (unsigned int v = 0; v < 2; ++v)
+  {
+    uint64_t best = UINT64_MAX;
+
+    for (unsigned int r = 0; r < rounds; ++r)
+    {
+      const uint64_t spent = replay(versions[v].fn, data, len, &lines[v], &sums[v]);
+
+      if (spent < best)
+        best = spent;
+    }
+
+    printf("{\"replay\":\"%s\",\"bytes\":%zu,\"lines\":%lu,\"rounds\":%u,\"best_ms\":%.3f,\"mb_per_s\":%.1f}\n",
+           versions[v].name, len, lines[v], rounds, ms(best), len / (best / 1000.0));
+  }
+
+  free(data);
+
+  if (lines[0] != lines[1] || sums[0] != sums[1])
+    fatal("the two versions split %s differently", path);
+}
+
+/*
+ * A TS6 burst from server 0AA: UID for every user, then SJOIN and BMASK
+ * for one channel per ten users
+ */
+static void
+generate(unsigned int users)
+{
+  const time_t ts = time(NULL) - 86400;
+
+  printf("PASS burstreplay TS 6 :0AA\r\n");
+  printf("CAPAB :QS EX IE EOB TBURST\r\n");
+  printf("SERVER burst.test 1 :burstreplay\r\n");
+  printf("SVINFO 6 6 0 :%ld\r\n", (long)ts);
+
+  for (unsigned int i = 0; i < users; ++i)
+  {
+    char gecos[400];
+    size_t glen = rng() % 280;
+
+    memset(gecos, 'r', glen);
+    gecos[glen] = '\0';
+
+    printf(":0AA UID user%u 1 %ld +i ~u%u host-%u.%u.example.net 10.%u.%u.%u 0AA%06u * :%s\r\n",
+           i, (long)(ts + i), i, rng() % 60000, i % 97, (i >> 16) & 255, (i >> 8) & 255,
+           i & 255, i, gecos);
+  }
+
+  for (unsigned int c = 0; c * 10 < users; ++c)
+  {
+    char members[IRCD_BUFSIZE];
+    size_t mlen = 0;
+    const unsigned int count = 10 + rng() % 30;
+
+    for (unsigned int m = 0; m < count && mlen + 12 < sizeof(members) - 100; ++m)
+    {
+      unsigned int uid = (c * 10 + m * 7) % users;
+
+      mlen += snprintf(members + mlen, sizeof(members) - mlen, "%s%s0AA%06u",
+                       mlen ? " " : "", m == 0 ? "@" : "", uid);
+    }
+
+    printf(":0AA SJOIN %ld #channel%u +nt :%s\r\n", (long)ts, c, members);
+    printf(":0AA BMASK %ld #channel%u b :*!*@spam%u.example.net *!*@bot%u.example.org\r\n",
+           (long)ts, c, c, c);
+  }
+
+  printf(":0AA EOB\r\n");
+}
+
+static void
+usage(void)
+{
+  fprintf(stderr, "usage: burstreplay [-c] [-g users] [-i iterations] [-r rounds] [-s seed] [file]\n");
+  fprintf(stderr, "  -c  check extract_one_line() against the previous version\n");
+  fprintf(stderr, "  -g  write a synthetic burst with this many users to stdout\n");
+  fprintf(stderr, "  -i  iterations of the check (default 100000)\n");
+  fprintf(stderr, "  -r  rounds of the replay; the fastest counts (default 5)\n");
+  fprintf(stderr, "  -s  random seed\n");
+  fprintf(stderr, "  file  captured burst to replay\n");
+  exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+  unsigned int iterations = 100000, rounds = 5, users = 0;
+  int do_check = 0;
+
+  for (int c = 0; (c = getopt(argc, argv, "cg:i:r:s:h?")) != -1; )
+  {
+    switch (c)
+    {
+      case 'c':
+        do_check = 1;
+        break;
+      case 'g':
+        users = atoi(optarg);
+        break;
+      case 'i':
+        iterations = atoi(optarg);
+        break;
+      case 'r':
+        rounds = atoi(optarg);
+        break;
+      case 's':
+        rng_state = strtoull(optarg, NULL, 10) | 1;
+        break;
+      default:
+        usage();
+    }
+  }
+
+  if (rounds == 0 || (!do_check && users == 0 && optind >= argc))
+    usage();
+
+  if (users)
+  {
+    generate(users);
+    return 0;
+  }
+
+  if (do_check && !check(iterations))
+    return EXIT_FAILURE;
+
+  for (int i = optind; i < argc; ++i)
+    replay_file(argv[i], rounds);
+
+  return 0;
+}
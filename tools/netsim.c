@@ -0,0 +1,734 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file netsim.c
+ * \brief Loopback network of ircd instances for timing bursts and
+ *        message propagation.
+ * \version $Id$
+ */
+
+/*
+ * netsim starts a number of ircd instances on 127.0.0.1, each with a
+ * generated ircd.conf, and links them into a binary tree: server i has
+ * server (i - 1) / 2 as its uplink. Every server gets an oper and a
+ * population of clients that all join one channel. Then:
+ *
+ *  - the servers are linked one by one with CONNECT, which runs through
+ *    serv_connect(). The time from CONNECT until the new server sees
+ *    the EOB of its uplink is reported as the burst duration.
+ *  - clients on each server in turn send timestamped messages to the
+ *    channel. Each delivery is a sample for the number of server hops
+ *    between sender and receiver.
+ *  - the last server is split off with SQUIT and linked again; the time
+ *    until its users have quit, and then rejoined, as seen from the
+ *    first server is reported.
+ *
+ * Results are written as one JSON object per line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+enum
+{
+  SERVERS_MAX = 255,
+  CLIENTS_MAX = 400,
+  LINE_MAX_LEN = 512,
+  START_TIMEOUT = 10000,  /* ms an instance may take to listen */
+  STEP_TIMEOUT = 30000    /* ms any one step may take */
+};
+
+struct server
+{
+  pid_t pid;
+  int parent;
+  unsigned int depth;
+  unsigned int port;
+  char dir[256];
+  uint64_t eob;            /* When its oper saw the EOB of the uplink */
+};
+
+struct conn
+{
+  int fd;
+  unsigned int server;
+  unsigned int registered;
+  unsigned int joined;
+  char nick[16];
+  char buf[8192];
+  size_t len;
+};
+
+struct samples
+{
+  uint64_t *v;
+  size_t count;
+  size_t alloc;
+};
+
+
+static struct server servers[SERVERS_MAX];
+static struct conn *conns;
+static unsigned int server_count = 3;
+static unsigned int client_count = 50;
+static unsigned int message_count = 200;
+static unsigned int base_port = 16700;
+static unsigned int conn_count;
+static const char *workdir = "netsim.d";
+static const char *ircd_path = "ircd";
+
+/* The current message round */
+static unsigned int msg_seq;
+static unsigned int msg_received;
+static struct samples *hop_samples;
+static unsigned long msg_lost;
+
+/* What the observer on the first server saw of the split server */
+static unsigned int observed_quits;
+static unsigned int observed_joins;
+
+
+static void
+fatal(const char *fmt, ...)
+{
+  va_list args;
+
+  va_start(args, fmt);
+  fprintf(stderr, "netsim: ");
+  vfprintf(stderr, fmt, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+
+  for (unsigned int i = 0; i < server_count; ++i)
+    if (servers[i].pid > 0)
+      kill(servers[i].pid, SIGTERM);
+
+  exit(EXIT_FAILURE);
+}
+
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static double
+ms(uint64_t ns)
+{
+  return ns / 1000000.0;
+}
+
+/*
+ * Server hops between two servers of the tree
+ */
+static unsigned int
+hops(unsigned int a, unsigned int b)
+{
+  unsigned int count = 0;
+
+  while (a != b)
+  {
+    if (servers[a].depth >= servers[b].depth)
+      a = servers[a].parent;
+    else
+      b = servers[b].parent;
+    ++count;
+  }
+
+  return count;
+}
+
+static void
+write_conf(unsigned int i)
+{
+  char path[sizeof(servers[i].dir) + 16];
+  FILE *f;
+
+  snprintf(path, sizeof(path), "%s/ircd.conf", servers[i].dir);
+  if ((f = fopen(path, "w")) == NULL)
+    fatal("%s: %s", path, strerror(errno));
+
+  fprintf(f, "serverinfo { name = \"s%u.netsim\"; sid = \"%03u\"; description = \"netsim\";"
+             " network_name = \"netsim\"; network_desc = \"netsim\"; hub = yes; max_clients = 512; };\n",
+          i, i);
+  fprintf(f, "admin { name = \"netsim\"; description = \"netsim\"; email = \"netsim@localhost\"; };\n");
+  fprintf(f, "class { name = \"users\"; ping_time = 5 minutes; number_per_ip = 10000;"
+             " max_number = 10000; sendq = 1 megabyte; };\n");
+  fprintf(f, "class { name = \"server\"; ping_time = 5 minutes; connectfreq = 5 minutes;"
+             " max_number = 100; sendq = 20 megabytes; };\n");
+  fprintf(f, "listen { host = \"127.0.0.1\"; port = %u; };\n", servers[i].port);
+  fprintf(f, "auth { user = \"*@*\"; class = \"users\"; flags = can_flood; };\n");
+  fprintf(f, "operator { name = \"netsim\"; user = \"*@*\"; password = \"netsim\";"
+             " encrypted = no; class = \"users\"; flags = connect, squit; };\n");
+  fprintf(f, "general { throttle_count = 0; disable_auth = yes; ping_cookie = no; };\n");
+
+  /* Uplink, then children */
+  for (unsigned int j = 0; j < server_count; ++j)
+  {
+    if (!((int)j == servers[i].parent || servers[j].parent == (int)i))
+      continue;
+
+    fprintf(f, "connect { name = \"s%u.netsim\"; host = \"127.0.0.1\"; port = %u;"
+               " send_password = \"netsim\"; accept_password = \"netsim\";"
+               " hub_mask = \"*\"; class = \"server\"; };\n",
+            j, servers[j].port);
+  }
+
+  fclose(f);
+}
+
+static void
+start_server(unsigned int i)
+{
+  char conf[sizeof(servers[i].dir) + 16], kline[sizeof(conf)], dline[sizeof(conf)];
+  char xline[sizeof(conf)], resv[sizeof(conf)], log[sizeof(conf)], pid[sizeof(conf)];
+  char out[sizeof(conf)];
+
+  snprintf(conf, sizeof(conf), "%s/ircd.conf", servers[i].dir);
+  snprintf(kline, sizeof(kline), "%s/kline.db", servers[i].dir);
+  snprintf(dline, sizeof(dline), "%s/dline.db", servers[i].dir);
+  snprintf(xline, sizeof(xline), "%s/xline.db", servers[i].dir);
+  snprintf(resv, sizeof(resv), "%s/resv.db", servers[i].dir);
+  snprintf(log, sizeof(log), "%s/ircd.log", servers[i].dir);
+  snprintf(pid, sizeof(pid), "%s/ircd.pid", servers[i].dir);
+  snprintf(out, sizeof(out), "%s/output", servers[i].dir);
+
+  if ((servers[i].pid = fork()) < 0)
+    fatal("fork: %s", strerror(errno));
+
+  if (servers[i].pid == 0)
+  {
+    int fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd >= 0)
+    {
+      dup2(fd, STDOUT_FILENO);
+      dup2(fd, STDERR_FILENO);
+      close(fd);
+    }
+
+    execl(ircd_path, ircd_path, "-foreground", "-configfile", conf,
+          "-klinefile", kline, "-dlinefile", dline, "-xlinefile", xline,
+          "-resvfile", resv, "-logfile", log, "-pidfile", pid, (char *)NULL);
+    _exit(127);
+  }
+}
+
+static int
+conn_connect(unsigned int port)
+{
+  struct sockaddr_in sin;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+  if (fd < 0)
+    fatal("socket: %s", strerror(errno));
+
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons(port);
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  if (connect(fd, (struct sockaddr *)&sin, sizeof(sin)))
+  {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+static void
+conn_send(struct conn *conn, const char *fmt, ...)
+{
+  char buf[LINE_MAX_LEN + 2];
+  va_list args;
+  size_t len, done = 0;
+
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf) - 2, fmt, args);
+  va_end(args);
+
+  len = strlen(buf);
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  while (done < len)
+  {
+    ssize_t n = write(conn->fd, buf + done, len - done);
+
+    if (n > 0)
+      done += n;
+    else if (n < 0 && errno == EAGAIN)
+    {
+      struct pollfd pfd = { .fd = conn->fd, .events = POLLOUT };
+      poll(&pfd, 1, 1000);
+    }
+    else
+      fatal("write to %s: %s", conn->nick, strerror(errno));
+  }
+}
+
+static void
+conn_open(struct conn *conn, unsigned int server, const char *nick)
+{
+  conn->server = server;
+  snprintf(conn->nick, sizeof(conn->nick), "%s", nick);
+
+  if ((conn->fd = conn_connect(servers[server].port)) < 0)
+    fatal("connect to s%u: %s", server, strerror(errno));
+
+  fcntl(conn->fd, F_SETFL, fcntl(conn->fd, F_GETFL) | O_NONBLOCK);
+  conn_send(conn, "NICK %s", conn->nick);
+  conn_send(conn, "USER netsim 0 * :netsim");
+}
+
+static void
+sample_add(struct samples *s, uint64_t value)
+{
+  if (s->count == s->alloc)
+  {
+    s->alloc = s->alloc ? s->alloc * 2 : 1024;
+    if ((s->v = realloc(s->v, s->alloc * sizeof(*s->v))) == NULL)
+      fatal("out of memory");
+  }
+
+  s->v[s->count++] = value;
+}
+
+static int
+sample_cmp(const void *a_, const void *b_)
+{
+  const uint64_t a = *(const uint64_t *)a_, b = *(const uint64_t *)b_;
+
+  return a < b ? -1 : a > b;
+}
+
+static uint64_t
+percentile(const struct samples *s, unsigned int p)
+{
+  return s->v[(s->count - 1) * p / 100];
+}
+
+/*
+ * Handles a line from the server; conn is the connection it came from
+ */
+static void
+conn_line(struct conn *conn, char *line)
+{
+  const char *cmd;
+  char *p;
+
+  if (strncmp(line, "PING ", 5) == 0)
+  {
+    conn_send(conn, "PONG %s", line + 5);
+    return;
+  }
+
+  if (line[0] != ':' || (p = strchr(line, ' ')) == NULL)
+    return;
+
+  cmd = p + 1;
+
+  if (strncmp(cmd, "001 ", 4) == 0)
+    conn->registered = 1;
+  else if (strncmp(cmd, "366 ", 4) == 0)
+    conn->joined = 1;
+  else if (strncmp(cmd, "PRIVMSG ", 8) == 0)
+  {
+    unsigned int seq, src;
+    unsigned long long sent;
+
+    if ((p = strstr(cmd, " :NS ")) == NULL ||
+        sscanf(p + 5, "%u %u %llu", &seq, &src, &sent) != 3 || seq != msg_seq)
+      return;
+
+    sample_add(&hop_samples[hops(src, conn->server)], now_ns() - sent);
+    ++msg_received;
+  }
+  else if (strncmp(cmd, "NOTICE ", 7) == 0)
+  {
+    if (strstr(cmd, "End of burst from ") && servers[conn->server].eob == 0)
+      servers[conn->server].eob = now_ns();
+  }
+  else if (strncmp(cmd, "QUIT ", 5) == 0)
+  {
+    if (conn == &conns[server_count])
+      ++observed_quits;
+  }
+  else if (strncmp(cmd, "JOIN ", 5) == 0)
+  {
+    if (conn == &conns[server_count])
+      ++observed_joins;
+  }
+}
+
+/*
+ * Reads whatever the servers sent, waiting up to timeout ms for it
+ */
+static void
+pump(int timeout)
+{
+  static struct pollfd *pfd;
+
+  if (pfd == NULL && (pfd = calloc(conn_count, sizeof(*pfd))) == NULL)
+    fatal("out of memory");
+
+  for (unsigned int i = 0; i < conn_count; ++i)
+  {
+    pfd[i].fd = conns[i].fd;
+    pfd[i].events = POLLIN;
+  }
+
+  if (poll(pfd, conn_count, timeout) <= 0)
+    return;
+
+  for (unsigned int i = 0; i < conn_count; ++i)
+  {
+    struct conn *conn = &conns[i];
+    char *line, *end;
+    ssize_t n;
+
+    if (!(pfd[i].revents & (POLLIN | POLLHUP | POLLERR)))
+      continue;
+
+    n = read(conn->fd, conn->buf + conn->len, sizeof(conn->buf) - conn->len - 1);
+    if (n == 0 || (n < 0 && errno != EAGAIN))
+      fatal("%s was disconnected from s%u", conn->nick, conn->server);
+    if (n < 0)
+      continue;
+
+    conn->len += n;
+    conn->buf[conn->len] = '\0';
+
+    for (line = conn->buf; (end = strstr(line, "\r\n")); line = end + 2)
+    {
+      *end = '\0';
+      conn_line(conn, line);
+    }
+
+    conn->len -= line - conn->buf;
+    memmove(conn->buf, line, conn->len);
+  }
+}
+
+/*
+ * Pumps until done() returns 1; fails after STEP_TIMEOUT
+ */
+static void
+wait_for(int (*done)(unsigned int), unsigned int arg, const char *what)
+{
+  const uint64_t deadline = now_ns() + (uint64_t)STEP_TIMEOUT * 1000000;
+
+  while (!done(arg))
+  {
+    if (now_ns() > deadline)
+      fatal("timed out waiting for %s", what);
+
+    pump(10);
+  }
+}
+
+static int
+all_registered(unsigned int first)
+{
+  for (unsigned int i = first; i < conn_count; ++i)
+    if (!conns[i].registered)
+      return 0;
+
+  return 1;
+}
+
+static int
+all_joined(unsigned int first)
+{
+  for (unsigned int i = first; i < conn_count; ++i)
+    if (!conns[i].joined)
+      return 0;
+
+  return 1;
+}
+
+static int
+eob_seen(unsigned int server)
+{
+  return servers[server].eob != 0;
+}
+
+static int
+quits_seen(unsigned int count)
+{
+  return observed_quits >= count;
+}
+
+static int
+joins_seen(unsigned int count)
+{
+  return observed_joins >= count;
+}
+
+/*
+ * Links server i to its uplink and reports the burst
+ */
+static void
+link_server(unsigned int i, const char *event)
+{
+  const uint64_t start = now_ns();
+
+  servers[i].eob = 0;
+  conn_send(&conns[i], "CONNECT s%d.netsim", servers[i].parent);
+  wait_for(eob_seen, i, "end of burst");
+
+  printf("{\"event\":\"%s\",\"server\":\"s%u.netsim\",\"uplink\":\"s%d.netsim\","
+         "\"servers\":%u,\"clients\":%u,\"ms\":%.3f}\n",
+         event, i, servers[i].parent, i + 1, (i + 1) * client_count,
+         ms(servers[i].eob - start));
+}
+
+static int
+round_done(unsigned int expected)
+{
+  return msg_received >= expected;
+}
+
+/*
+ * Sends one message from a client of server src and collects deliveries
+ */
+static void
+message_round(unsigned int src)
+{
+  const unsigned int expected = server_count * client_count - 1;
+  const uint64_t deadline = now_ns() + 5000000000ULL;
+
+  ++msg_seq;
+  msg_received = 0;
+
+  conn_send(&conns[server_count + src * client_count], "PRIVMSG #netsim :NS %u %u %llu",
+            msg_seq, src, (unsigned long long)now_ns());
+
+  while (!round_done(expected) && now_ns() < deadline)
+    pump(10);
+
+  if (msg_received < expected)
+    msg_lost += expected - msg_received;
+}
+
+static void
+report_latency(void)
+{
+  for (unsigned int h = 0; h < 2 * server_count; ++h)
+  {
+    struct samples *s = &hop_samples[h];
+
+    if (s->count == 0)
+      continue;
+
+    qsort(s->v, s->count, sizeof(*s->v), sample_cmp);
+    printf("{\"event\":\"latency\",\"hops\":%u,\"samples\":%zu,\"p50_ms\":%.3f,"
+           "\"p90_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}\n",
+           h, s->count, ms(percentile(s, 50)), ms(percentile(s, 90)),
+           ms(percentile(s, 99)), ms(s->v[s->count - 1]));
+  }
+
+  printf("{\"event\":\"messages\",\"sent\":%u,\"lost\":%lu}\n", msg_seq, msg_lost);
+}
+
+/*
+ * Splits the last server off and links it again
+ */
+static void
+split_and_relink(void)
+{
+  const unsigned int leaf = server_count - 1;
+  uint64_t start;
+
+  observed_quits = 0;
+  start = now_ns();
+  conn_send(&conns[leaf], "SQUIT s%d.netsim :netsim", servers[leaf].parent);
+  wait_for(quits_seen, client_count, "split");
+
+  printf("{\"event\":\"split\",\"server\":\"s%u.netsim\",\"clients\":%u,\"ms\":%.3f}\n",
+         leaf, client_count, ms(now_ns() - start));
+
+  observed_joins = 0;
+  start = now_ns();
+  link_server(leaf, "relink");
+  wait_for(joins_seen, client_count, "netjoin");
+
+  printf("{\"event\":\"netjoin\",\"server\":\"s%u.netsim\",\"clients\":%u,\"ms\":%.3f}\n",
+         leaf, client_count, ms(now_ns() - start));
+}
+
+static void
+usage(void)
+{
+  fprintf(stderr, "usage: netsim [-n servers] [-c clients] [-m messages] [-p port] [-d dir] [ircd]\n");
+  fprintf(stderr, "  -n  number of servers, linked as a binary tree (default 3)\n");
+  fprintf(stderr, "  -c  clients per server (default 50)\n");
+  fprintf(stderr, "  -m  messages sent to the channel (default 200)\n");
+  fprintf(stderr, "  -p  port of the first server; the others follow (default 16700)\n");
+  fprintf(stderr, "  -d  directory for configuration files and logs (default netsim.d)\n");
+  fprintf(stderr, "  ircd  path of the ircd binary (default ircd)\n");
+  exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+  for (int c = 0; (c = getopt(argc, argv, "n:c:m:p:d:h?")) != -1; )
+  {
+    switch (c)
+    {
+      case 'n':
+        server_count = atoi(optarg);
+        break;
+      case 'c':
+        client_count = atoi(optarg);
+        break;
+      case 'm':
+        message_count = atoi(optarg);
+        break;
+      case 'p':
+        base_port = atoi(optarg);
+        break;
+      case 'd':
+        workdir = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+
+  if (optind < argc)
+    ircd_path = argv[optind];
+
+  if (server_count < 1 || server_count > SERVERS_MAX ||
+      client_count < 1 || client_count > CLIENTS_MAX || base_port + server_count > 65535)
+    usage();
+
+  signal(SIGPIPE, SIG_IGN);
+
+  if (mkdir(workdir, 0755) && errno != EEXIST)
+    fatal("%s: %s", workdir, strerror(errno));
+
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    servers[i].parent = i ? ((int)i - 1) / 2 : -1;
+    servers[i].depth = i ? servers[servers[i].parent].depth + 1 : 0;
+    servers[i].port = base_port + i;
+    snprintf(servers[i].dir, sizeof(servers[i].dir), "%s/s%u", workdir, i);
+
+    if (mkdir(servers[i].dir, 0755) && errno != EEXIST)
+      fatal("%s: %s", servers[i].dir, strerror(errno));
+  }
+
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    write_conf(i);
+    start_server(i);
+  }
+
+  /* Wait for all of them to listen */
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    const uint64_t deadline = now_ns() + (uint64_t)START_TIMEOUT * 1000000;
+    int fd;
+
+    while ((fd = conn_connect(servers[i].port)) < 0)
+    {
+      if (now_ns() > deadline || waitpid(servers[i].pid, NULL, WNOHANG) == servers[i].pid)
+        fatal("s%u did not start, see %s/output", i, servers[i].dir);
+
+      usleep(50000);
+    }
+
+    close(fd);
+  }
+
+  /* Opers first, one per server, then the clients of each server */
+  conn_count = server_count + server_count * client_count;
+  if ((conns = calloc(conn_count, sizeof(*conns))) == NULL ||
+      (hop_samples = calloc(2 * server_count, sizeof(*hop_samples))) == NULL)
+    fatal("out of memory");
+
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    char nick[16];
+
+    snprintf(nick, sizeof(nick), "o%u", i);
+    conn_open(&conns[i], i, nick);
+
+    for (unsigned int j = 0; j < client_count; ++j)
+    {
+      snprintf(nick, sizeof(nick), "s%uc%u", i, j);
+      conn_open(&conns[server_count + i * client_count + j], i, nick);
+    }
+  }
+
+  wait_for(all_registered, 0, "registration");
+
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    conn_send(&conns[i], "OPER netsim netsim");
+    conn_send(&conns[i], "MODE %s +s", conns[i].nick);
+  }
+
+  for (unsigned int i = server_count; i < conn_count; ++i)
+    conn_send(&conns[i], "JOIN #netsim");
+
+  wait_for(all_joined, server_count, "channel join");
+
+  for (unsigned int i = 1; i < server_count; ++i)
+    link_server(i, "burst");
+
+  for (unsigned int i = 0; i < message_count; ++i)
+    message_round(i % server_count);
+
+  report_latency();
+
+  if (server_count > 1)
+    split_and_relink();
+
+  for (unsigned int i = 0; i < server_count; ++i)
+  {
+    kill(servers[i].pid, SIGTERM);
+    waitpid(servers[i].pid, NULL, 0);
+  }
+
+  return 0;
+}